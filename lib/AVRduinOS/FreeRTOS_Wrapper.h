@@ -16,5 +16,21 @@
 #include "FreeRTOS_Wrapper_Configuration.h"
 #include "FreeRTOS_Wrapper_Types.h"
 #include "FreeRTOS_Wrapper_Methods.h"
+#include "FreeRTOS_Wrapper_Queue.h"
+#include "FreeRTOS_Wrapper_Mutex.h"
+#include "FreeRTOS_Wrapper_Semaphore.h"
+#include "FreeRTOS_Wrapper_EventGroup.h"
+#include "FreeRTOS_Wrapper_Timer.h"
+#include "FreeRTOS_Wrapper_Buffer.h"
+#include "FreeRTOS_Wrapper_Stats.h"
+#include "FreeRTOS_Wrapper_Stack.h"
+#include "FreeRTOS_Wrapper_Trace.h"
+#include "FreeRTOS_Wrapper_Tickless.h"
+#include "FreeRTOS_Wrapper_Schedule.h"
+#include "FreeRTOS_Wrapper_Deadline.h"
+
+#ifdef __cplusplus
+  #include "FreeRTOS_Wrapper_BlockPool.hpp"
+#endif // __cplusplus
 
 #endif // __FREERTOS_WRAPPER_H__
\ No newline at end of file
@@ -0,0 +1,43 @@
+/**
+ ********************************************************************************
+ * @file    WrapperLatency.hpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Latency Benchmarks for the FreeRTOS Wrapper Primitives
+ * @version 1.0
+ * @date    2024-03-18
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#ifndef __WRAPPER_LATENCY_HPP__
+#define __WRAPPER_LATENCY_HPP__
+
+#include "benchmark_utilities.hpp"
+
+/**
+ ********************************************************************************
+ * @brief   Samples taken by each benchmark
+ ********************************************************************************
+**/
+#ifndef BENCHMARK_SAMPLES
+  #define BENCHMARK_SAMPLES 100
+#endif // BENCHMARK_SAMPLES
+
+/**
+ ********************************************************************************
+ * @brief   Run every Latency Benchmark and print the Results
+ ********************************************************************************
+ * @note    The benchmarks run in their own threads, so this function starts
+ *          the scheduler and returns once it has been stopped. Measured are
+ *          critical section entry and exit, CreateThread, DeleteThread, a
+ *          context switch between threads of equal priority, and the wake
+ *          latency from ThreadNotice to ThreadWaitforNotice returning in a
+ *          higher priority thread, from ThreadNoticeGiveFromISR in an
+ *          interrupt to ThreadNoticeTake returning, and the daemon time
+ *          between two timer callbacks expiring on the same tick.
+ ********************************************************************************
+**/
+void RunBenchmarks();
+
+#endif // __WRAPPER_LATENCY_HPP__
\ No newline at end of file
@@ -0,0 +1,110 @@
+/**
+ ********************************************************************************
+ * @file    benchmark_utilities.hpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Cycle Counting and Reporting for the FreeRTOS Wrapper Benchmarks
+ * @version 1.0
+ * @date    2024-03-18
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#ifndef __BENCHMARK_UTILITIES_HPP__
+#define __BENCHMARK_UTILITIES_HPP__
+
+#include <stdint.h>
+
+/**
+ ********************************************************************************
+ * @brief   16-bit hardware timer (1, 3, 4 or 5) counting CPU cycles
+ ********************************************************************************
+ * @note    The timer runs without a prescaler, so a single measurement must
+ *          be shorter than 65536 cycles (4 ms at 16 MHz). It must differ from
+ *          THREAD_CLOCK_TIMER; its settings are restored afterwards.
+ ********************************************************************************
+**/
+#ifndef BENCHMARK_TIMER
+  #define BENCHMARK_TIMER 1
+#endif // BENCHMARK_TIMER
+
+#if defined(__AVR__)
+typedef uint16_t benchmark_cycles_t;
+#else
+typedef uint32_t benchmark_cycles_t;
+#endif // __AVR__
+
+typedef struct __benchmark_result {
+    const char *name;
+    uint16_t samples;
+    uint32_t min;
+    uint32_t max;
+    uint32_t total;
+} benchmark_result_t;
+
+/**
+ ********************************************************************************
+ * @brief   Take over the benchmark timer and measure the cost of reading it
+ ********************************************************************************
+**/
+void BenchmarkBegin();
+
+/**
+ ********************************************************************************
+ * @brief   Restore the benchmark timer
+ ********************************************************************************
+**/
+void BenchmarkEnd();
+
+/**
+ ********************************************************************************
+ * @brief   Read the Cycle Counter
+ ********************************************************************************
+ * @note    Off the AVR the count is derived from micros() and F_CPU.
+ ********************************************************************************
+**/
+benchmark_cycles_t BenchmarkCycles();
+
+/**
+ ********************************************************************************
+ * @brief   Run a handler from an interrupt shortly after the call
+ ********************************************************************************
+ * @param[in]     handler   TYPE: void (*)(void)
+ ********************************************************************************
+ * @note    On the AVR a one-shot compare match of the benchmark timer raises
+ *          the interrupt 64 cycles later, so the handler runs as a real ISR
+ *          and may call the FromISR functions. Off the AVR it is called
+ *          directly. Only valid between BenchmarkBegin and BenchmarkEnd.
+ ********************************************************************************
+**/
+void BenchmarkInterrupt(void (*handler)(void));
+
+/**
+ ********************************************************************************
+ * @brief   Add the cycles between two readings to a result
+ ********************************************************************************
+ * @note    The cost of reading the counter, measured by BenchmarkBegin, is
+ *          taken off every sample.
+ ********************************************************************************
+**/
+void BenchmarkSample(benchmark_result_t *result, benchmark_cycles_t start, benchmark_cycles_t end);
+
+/**
+ ********************************************************************************
+ * @brief   Reset a result before sampling
+ ********************************************************************************
+**/
+void BenchmarkReset(benchmark_result_t *result, const char *name);
+
+/**
+ ********************************************************************************
+ * @brief   Print results as CSV
+ ********************************************************************************
+ * @note    One header line, then one line per result of
+ *          benchmark,samples,min_cycles,mean_cycles,max_cycles, so the output
+ *          can be captured and compared between runs.
+ ********************************************************************************
+**/
+void BenchmarkReport(const benchmark_result_t *results, uint8_t count);
+
+#endif // __BENCHMARK_UTILITIES_HPP__
\ No newline at end of file
@@ -0,0 +1,235 @@
+/**
+ ********************************************************************************
+ * @file    WrapperLatency.cpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Latency Benchmarks for the FreeRTOS Wrapper Primitives
+ * @version 1.0
+ * @date    2024-03-18
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#include "WrapperLatency.hpp"
+
+#include "FreeRTOS_Wrapper.h"
+
+#include "benchmark_utilities.hpp"
+
+typedef enum __benchmark_index {
+    BENCHMARK_CRITICAL = 0,
+    BENCHMARK_CREATE_THREAD,
+    BENCHMARK_DELETE_THREAD,
+    BENCHMARK_CONTEXT_SWITCH,
+    BENCHMARK_NOTICE_WAKE,
+    BENCHMARK_ISR_WAKE,
+    BENCHMARK_TIMER_DISPATCH,
+    BENCHMARK_COUNT
+} benchmark_index_t;
+
+static benchmark_result_t benchmark_results[BENCHMARK_COUNT];
+static volatile benchmark_cycles_t benchmark_start;
+static thread_handle_t benchmark_isr_waiter = NULL;
+
+#if (configUSE_TIMERS == 1)
+// Timers expiring on the same tick, so their callbacks run back to back
+#define BENCHMARK_TIMERS 8
+
+static volatile benchmark_cycles_t benchmark_timer_last;
+static volatile thread_time_t benchmark_timer_tick;
+#endif // configUSE_TIMERS
+
+void Benchmark_Idle(void *params __attribute__((unused))) {
+    while (true)
+        ThreadDelay(1000);
+}
+
+void Benchmark_SwitchPartner(void *params __attribute__((unused))) {
+    while (true) {
+        BenchmarkSample(&benchmark_results[BENCHMARK_CONTEXT_SWITCH], benchmark_start, BenchmarkCycles());
+        taskYIELD();
+    }
+}
+
+void Benchmark_NoticeWaiter(void *params __attribute__((unused))) {
+    thread_notice_value_t value;
+
+    while (true) {
+        if (ThreadWaitforNotice(&value, 0, 0xFFFFFFFFUL, 1000) == THREAD_SUCCESS)
+            BenchmarkSample(&benchmark_results[BENCHMARK_NOTICE_WAKE], benchmark_start, BenchmarkCycles());
+    }
+}
+
+void Benchmark_ISRWaiter(void *params __attribute__((unused))) {
+    while (true) {
+        if (ThreadNoticeTake(CLEAR, 1000) != 0)
+            BenchmarkSample(&benchmark_results[BENCHMARK_ISR_WAKE], benchmark_start, BenchmarkCycles());
+    }
+}
+
+static void Benchmark_ISRHandler() {
+    thread_isr_yield_t yield = THREAD_ISR_YIELD_INIT;
+
+    benchmark_start = BenchmarkCycles();
+    ThreadNoticeGiveFromISR(&benchmark_isr_waiter, &yield);
+    ThreadYieldFromISR(yield);
+}
+
+#if (configUSE_TIMERS == 1)
+static void Benchmark_TimerCallback(thread_timer_handle_t timer __attribute__((unused))) {
+    benchmark_cycles_t now = BenchmarkCycles();
+    thread_time_t tick = ThreadTime();
+
+    // Only callbacks of one tick are back to back
+    if (tick == benchmark_timer_tick)
+        BenchmarkSample(&benchmark_results[BENCHMARK_TIMER_DISPATCH], benchmark_timer_last, now);
+    benchmark_timer_tick = tick;
+    benchmark_timer_last = BenchmarkCycles();
+}
+#endif // configUSE_TIMERS
+
+static void BenchmarkCritical() {
+    benchmark_result_t *result = &benchmark_results[BENCHMARK_CRITICAL];
+    BenchmarkReset(result, "critical_section");
+
+    for (int i = 0; i < BENCHMARK_SAMPLES; i++) {
+        benchmark_cycles_t start = BenchmarkCycles();
+        EnterThreadCritical();
+        ExitThreadCritical();
+        BenchmarkSample(result, start, BenchmarkCycles());
+    }
+}
+
+static void BenchmarkCreateDelete() {
+    benchmark_result_t *create = &benchmark_results[BENCHMARK_CREATE_THREAD];
+    benchmark_result_t *remove = &benchmark_results[BENCHMARK_DELETE_THREAD];
+    BenchmarkReset(create, "create_thread");
+    BenchmarkReset(remove, "delete_thread");
+
+    // The thread is below the runner, so it is never switched to
+    thread_function_t config = ConfigureThread("Bench", Benchmark_Idle, THREAD_PRIORITY_LOW, 128);
+    for (int i = 0; i < BENCHMARK_SAMPLES; i++) {
+        thread_handle_t handle = NULL;
+
+        benchmark_cycles_t start = BenchmarkCycles();
+        thread_return_t retval = CreateThread(&handle, config);
+        benchmark_cycles_t end = BenchmarkCycles();
+        if (retval != THREAD_SUCCESS)
+            break;
+        BenchmarkSample(create, start, end);
+
+        start = BenchmarkCycles();
+        DeleteThread(&handle);
+        BenchmarkSample(remove, start, BenchmarkCycles());
+    }
+}
+
+static void BenchmarkContextSwitch() {
+    BenchmarkReset(&benchmark_results[BENCHMARK_CONTEXT_SWITCH], "context_switch");
+
+    thread_function_t config = ConfigureThread("Partner", Benchmark_SwitchPartner, THREAD_PRIORITY_MEDIUM, 128);
+    thread_handle_t partner = NULL;
+    if (CreateThread(&partner, config) != THREAD_SUCCESS)
+        return;
+
+    for (int i = 0; i < BENCHMARK_SAMPLES; i++) {
+        benchmark_start = BenchmarkCycles();
+        taskYIELD();
+    }
+
+    DeleteThread(&partner);
+}
+
+static void BenchmarkNoticeWake() {
+    BenchmarkReset(&benchmark_results[BENCHMARK_NOTICE_WAKE], "notice_wake");
+
+    // The waiter preempts the runner as soon as it is created and blocks
+    thread_function_t config = ConfigureThread("Waiter", Benchmark_NoticeWaiter, THREAD_PRIORITY_HIGH, 128);
+    thread_handle_t waiter = NULL;
+    if (CreateThread(&waiter, config) != THREAD_SUCCESS)
+        return;
+
+    for (int i = 0; i < BENCHMARK_SAMPLES; i++) {
+        benchmark_start = BenchmarkCycles();
+        ThreadNotice(&waiter, SET_BITWISE_OR, 1);
+    }
+
+    DeleteThread(&waiter);
+}
+
+static void BenchmarkISRWake() {
+    benchmark_result_t *result = &benchmark_results[BENCHMARK_ISR_WAKE];
+    BenchmarkReset(result, "isr_notice_wake");
+
+    // Measured from the interrupt giving the notice to the waiter running
+    thread_function_t config = ConfigureThread("ISRWait", Benchmark_ISRWaiter, THREAD_PRIORITY_HIGH, 128);
+    if (CreateThread(&benchmark_isr_waiter, config) != THREAD_SUCCESS)
+        return;
+
+    for (int i = 0; i < BENCHMARK_SAMPLES; i++) {
+        uint16_t samples = result->samples;
+        thread_time_t armed = ThreadTime();
+        BenchmarkInterrupt(Benchmark_ISRHandler);
+
+        // A lost interrupt costs a sample rather than hanging the runner
+        while (((volatile benchmark_result_t *)result)->samples == samples)
+            if (ThreadTime() - armed > 100)
+                break;
+    }
+
+    DeleteThread(&benchmark_isr_waiter);
+}
+
+static void BenchmarkTimerDispatch() {
+    benchmark_result_t *result = &benchmark_results[BENCHMARK_TIMER_DISPATCH];
+    BenchmarkReset(result, "timer_dispatch");
+
+#if (configUSE_TIMERS == 1)
+    thread_timer_handle_t timers[BENCHMARK_TIMERS] = {NULL};
+    benchmark_timer_tick = 0;
+
+    // Measured from the end of one callback to the start of the next
+    EnterThreadCritical();
+    for (thread_timer_handle_t &timer : timers) {
+        if (CreateTimer(&timer, "Bench", 50, AUTO_RELOAD, Benchmark_TimerCallback, NULL) == THREAD_SUCCESS)
+            TimerStart(&timer, 0);
+    }
+    ExitThreadCritical();
+
+    thread_time_t started = ThreadTime();
+    while (((volatile benchmark_result_t *)result)->samples < BENCHMARK_SAMPLES)
+        if (ThreadTime() - started > 2000)
+            break;
+
+    for (thread_timer_handle_t &timer : timers) {
+        if (timer != NULL)
+            DeleteTimer(&timer, 100);
+    }
+#endif // configUSE_TIMERS
+}
+
+void Benchmark_Runner(void *params __attribute__((unused))) {
+    BenchmarkBegin();
+    BenchmarkCritical();
+    BenchmarkCreateDelete();
+    BenchmarkContextSwitch();
+    BenchmarkNoticeWake();
+    BenchmarkISRWake();
+    BenchmarkTimerDispatch();
+    BenchmarkEnd();
+
+    BenchmarkReport(benchmark_results, BENCHMARK_COUNT);
+
+    StopThreadScheduler();
+}
+
+void RunBenchmarks() {
+    thread_function_t config = ConfigureThread("Runner", Benchmark_Runner, THREAD_PRIORITY_MEDIUM, 256);
+    thread_handle_t runner = NULL;
+    if (CreateThread(&runner, config) != THREAD_SUCCESS)
+        return;
+
+    StartThreadScheduler();
+
+    DeleteThread(&runner);
+}
\ No newline at end of file
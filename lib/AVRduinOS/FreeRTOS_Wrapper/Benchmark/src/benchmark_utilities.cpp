@@ -0,0 +1,146 @@
+/**
+ ********************************************************************************
+ * @file    benchmark_utilities.cpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Cycle Counting and Reporting for the FreeRTOS Wrapper Benchmarks
+ * @version 1.0
+ * @date    2024-03-18
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#include "benchmark_utilities.hpp"
+
+#include <Arduino.h>
+
+#include "FreeRTOS_Wrapper.h"
+
+#if defined(__AVR__)
+  #if (BENCHMARK_TIMER == THREAD_CLOCK_TIMER) && (THREAD_CLOCK_ENABLED == 1)
+    #error "BENCHMARK_TIMER must differ from THREAD_CLOCK_TIMER"
+  #endif
+
+  #define BENCHMARK_REGISTER_PASTE(prefix, timer, suffix) prefix##timer##suffix
+  #define BENCHMARK_REGISTER_EXPAND(prefix, timer, suffix) BENCHMARK_REGISTER_PASTE(prefix, timer, suffix)
+  #define BENCHMARK_REGISTER(prefix, suffix) BENCHMARK_REGISTER_EXPAND(prefix, BENCHMARK_TIMER, suffix)
+
+  #define BENCHMARK_TCCRA BENCHMARK_REGISTER(TCCR, A)
+  #define BENCHMARK_TCCRB BENCHMARK_REGISTER(TCCR, B)
+  #define BENCHMARK_TCNT BENCHMARK_REGISTER(TCNT, )
+  #define BENCHMARK_CS0 BENCHMARK_REGISTER(CS, 0)
+  #define BENCHMARK_OCRA BENCHMARK_REGISTER(OCR, A)
+  #define BENCHMARK_TIMSK BENCHMARK_REGISTER(TIMSK, )
+  #define BENCHMARK_TIFR BENCHMARK_REGISTER(TIFR, )
+  #define BENCHMARK_OCIEA BENCHMARK_REGISTER(OCIE, A)
+  #define BENCHMARK_OCFA BENCHMARK_REGISTER(OCF, A)
+  #define BENCHMARK_COMPA_vect BENCHMARK_REGISTER(TIMER, _COMPA_vect)
+
+  // Cycles from arming the compare match to the interrupt
+  #define BENCHMARK_INTERRUPT_DELAY 64
+
+static uint8_t benchmark_tccra;
+static uint8_t benchmark_tccrb;
+static void (*volatile benchmark_handler)(void) = NULL;
+
+ISR(BENCHMARK_COMPA_vect) {
+  // One-shot, the compare match would otherwise repeat every 65536 cycles
+  BENCHMARK_TIMSK &= ~_BV(BENCHMARK_OCIEA);
+  if (benchmark_handler != NULL)
+    benchmark_handler();
+}
+#elif !defined(F_CPU)
+  // Host builds scale micros() as if they ran on the board
+  #define F_CPU 16000000UL
+#endif // __AVR__
+
+static benchmark_cycles_t benchmark_overhead = 0;
+
+void BenchmarkBegin() {
+#if defined(__AVR__)
+  benchmark_tccra = BENCHMARK_TCCRA;
+  benchmark_tccrb = BENCHMARK_TCCRB;
+  BENCHMARK_TCCRA = 0;
+  BENCHMARK_TCCRB = _BV(BENCHMARK_CS0);
+#endif // __AVR__
+
+  // The cheapest of several back to back readings is the cost of one reading
+  benchmark_overhead = 0;
+  benchmark_cycles_t overhead = (benchmark_cycles_t)~0;
+  for (uint8_t i = 0; i < 16; i++) {
+    benchmark_cycles_t start = BenchmarkCycles();
+    benchmark_cycles_t end = BenchmarkCycles();
+    if ((benchmark_cycles_t)(end - start) < overhead)
+      overhead = end - start;
+  }
+  benchmark_overhead = overhead;
+}
+
+void BenchmarkEnd() {
+#if defined(__AVR__)
+  BENCHMARK_TIMSK &= ~_BV(BENCHMARK_OCIEA);
+  BENCHMARK_TCCRA = benchmark_tccra;
+  BENCHMARK_TCCRB = benchmark_tccrb;
+#endif // __AVR__
+}
+
+benchmark_cycles_t BenchmarkCycles() {
+#if defined(__AVR__)
+  return BENCHMARK_TCNT;
+#else
+  return (benchmark_cycles_t)(micros() * (F_CPU / 1000000UL));
+#endif // __AVR__
+}
+
+void BenchmarkInterrupt(void (*handler)(void)) {
+#if defined(__AVR__)
+  uint8_t sreg = SREG;
+  cli();
+  benchmark_handler = handler;
+  BENCHMARK_OCRA = BENCHMARK_TCNT + BENCHMARK_INTERRUPT_DELAY;
+  BENCHMARK_TIFR = _BV(BENCHMARK_OCFA);
+  BENCHMARK_TIMSK |= _BV(BENCHMARK_OCIEA);
+  SREG = sreg;
+#else
+  handler();
+#endif // __AVR__
+}
+
+void BenchmarkReset(benchmark_result_t *result, const char *name) {
+  result->name = name;
+  result->samples = 0;
+  result->min = UINT32_MAX;
+  result->max = 0;
+  result->total = 0;
+}
+
+void BenchmarkSample(benchmark_result_t *result, benchmark_cycles_t start, benchmark_cycles_t end) {
+  benchmark_cycles_t elapsed = end - start;
+  uint32_t cycles = (elapsed > benchmark_overhead) ? elapsed - benchmark_overhead : 0;
+
+  if (cycles < result->min)
+    result->min = cycles;
+  if (cycles > result->max)
+    result->max = cycles;
+  result->total += cycles;
+  result->samples++;
+}
+
+void BenchmarkReport(const benchmark_result_t *results, uint8_t count) {
+  Serial.print("benchmark,samples,min_cycles,mean_cycles,max_cycles\n");
+  for (uint8_t i = 0; i < count; i++) {
+    const benchmark_result_t *result = &results[i];
+    uint32_t mean = (result->samples != 0) ? result->total / result->samples : 0;
+
+    Serial.print(result->name);
+    Serial.print(',');
+    Serial.print((unsigned long)result->samples);
+    Serial.print(',');
+    Serial.print((unsigned long)((result->samples != 0) ? result->min : 0));
+    Serial.print(',');
+    Serial.print((unsigned long)mean);
+    Serial.print(',');
+    Serial.print((unsigned long)result->max);
+    Serial.print('\n');
+  }
+}
\ No newline at end of file
@@ -0,0 +1,178 @@
+/**
+ ********************************************************************************
+ * @file    FreeRTOS_Wrapper_BlockPool.hpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Block Pool Backed Threads and Queues for the FreeRTOS Wrapper
+ * @version 1.0
+ * @date    2024-03-18
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#ifndef __FREERTOS_WRAPPER_BLOCK_POOL_HPP__
+#define __FREERTOS_WRAPPER_BLOCK_POOL_HPP__
+
+#include <Arduino_FreeRTOS.h>
+#include <queue.h>
+
+#include "FreeRTOS_Wrapper_Types.h"
+#include "FreeRTOS_Wrapper_Methods.h"
+#include "FreeRTOS_Wrapper_Queue.h"
+
+#include "BlockPool.hpp"
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+
+/**
+ ********************************************************************************
+ * @brief   Block size needed for a pooled thread with the given stack depth
+ ********************************************************************************
+ * @note    The depth is raised to THREAD_STACK_MINIMUM like the thread's.
+ ********************************************************************************
+**/
+#define THREAD_POOL_BLOCK_SIZE(stack_size) \
+    (sizeof(StaticTask_t) + THREAD_STACK_DEPTH(stack_size) * sizeof(StackType_t))
+
+/**
+ ********************************************************************************
+ * @brief   Block size needed for a pooled queue with the given dimensions
+ ********************************************************************************
+**/
+#define THREAD_QUEUE_POOL_BLOCK_SIZE(length, item_size) \
+    (sizeof(StaticQueue_t) + (length) * (item_size))
+
+/**
+ ********************************************************************************
+ * @brief   Create a Thread with its control block and stack taken from a pool
+ ********************************************************************************
+ * @param[out]    thread    TYPE: thread_handle_t *
+ * @param[in]     function  TYPE: thread_function_t
+ * @param[inout]  pool      TYPE: BlockPool<BlockSize, Count> &
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @note    The block must be at least THREAD_POOL_BLOCK_SIZE of the configured
+ *          stack size. The thread must be deleted with DeletePooledThread so
+ *          the block goes back to the pool.
+ * @see     CreateStaticThread
+ ********************************************************************************
+**/
+template <size_t BlockSize, size_t Count>
+thread_return_t CreatePooledThread(thread_handle_t *thread,
+                                   thread_function_t function,
+                                   BlockPool<BlockSize, Count> &pool) {
+  if (function.valid != THREAD_STRUCT_VALID)
+    return THREAD_FUNCTION_INVALID;
+  if (THREAD_POOL_BLOCK_SIZE(function.stack_size) > BlockSize)
+    return THREAD_MEMORY_INVALID;
+
+  uint8_t *block = (uint8_t *)pool.Allocate();
+  if (block == NULL)
+    return THREAD_FAILURE_MEMORY_ALLOCATION;
+
+  // The control block leads the block, so the handle is the block itself
+  thread_static_memory_t memory = {
+    (StackType_t *)(block + sizeof(StaticTask_t)),
+    (StaticTask_t *)block,
+    (configSTACK_DEPTH_TYPE)((BlockSize - sizeof(StaticTask_t)) / sizeof(StackType_t))
+  };
+  thread_return_t retval = CreateStaticThread(thread, function, &memory);
+  if (retval != THREAD_SUCCESS)
+    pool.Free(block);
+  return retval;
+}
+
+/**
+ ********************************************************************************
+ * @brief   Delete a Thread created with CreatePooledThread
+ ********************************************************************************
+ * @param[inout]  thread  TYPE: thread_handle_t *
+ * @param[inout]  pool    TYPE: BlockPool<BlockSize, Count> &
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @note    A thread must not delete itself this way, as its stack would be
+ *          handed out again while it is still running on it.
+ ********************************************************************************
+**/
+template <size_t BlockSize, size_t Count>
+thread_return_t DeletePooledThread(thread_handle_t *thread,
+                                   BlockPool<BlockSize, Count> &pool) {
+  if (thread == NULL || !pool.Owns(*thread))
+    return THREAD_HANDLE_INVALID;
+
+  void *block = *thread;
+  thread_return_t retval = DeleteThread(thread);
+  if (retval == THREAD_SUCCESS)
+    pool.Free(block);
+  return retval;
+}
+
+/**
+ ********************************************************************************
+ * @brief   Create a Queue with its control block and storage taken from a pool
+ ********************************************************************************
+ * @param[out]    queue      TYPE: thread_queue_handle_t *
+ * @param[in]     length     TYPE: thread_queue_length_t
+ * @param[in]     item_size  TYPE: thread_queue_item_size_t
+ * @param[inout]  pool       TYPE: BlockPool<BlockSize, Count> &
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @note    A pool of message blocks pairs with a queue of pointers, with an
+ *          item size of sizeof(void *), to pass messages without copying them.
+ * @see     CreateStaticQueue
+ ********************************************************************************
+**/
+template <size_t BlockSize, size_t Count>
+thread_return_t CreatePooledQueue(thread_queue_handle_t *queue,
+                                  thread_queue_length_t length,
+                                  thread_queue_item_size_t item_size,
+                                  BlockPool<BlockSize, Count> &pool) {
+  if (THREAD_QUEUE_POOL_BLOCK_SIZE(length, item_size) > BlockSize)
+    return THREAD_MEMORY_INVALID;
+
+  uint8_t *block = (uint8_t *)pool.Allocate();
+  if (block == NULL)
+    return THREAD_FAILURE_MEMORY_ALLOCATION;
+
+  // The control block leads the block, so the handle is the block itself
+  thread_queue_static_memory_t memory = {
+    block + sizeof(StaticQueue_t),
+    (StaticQueue_t *)block,
+    length,
+    item_size
+  };
+  thread_return_t retval = CreateStaticQueue(queue, &memory);
+  if (retval != THREAD_SUCCESS)
+    pool.Free(block);
+  return retval;
+}
+
+/**
+ ********************************************************************************
+ * @brief   Delete a Queue created with CreatePooledQueue
+ ********************************************************************************
+ * @param[inout]  queue  TYPE: thread_queue_handle_t *
+ * @param[inout]  pool   TYPE: BlockPool<BlockSize, Count> &
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+**/
+template <size_t BlockSize, size_t Count>
+thread_return_t DeletePooledQueue(thread_queue_handle_t *queue,
+                                  BlockPool<BlockSize, Count> &pool) {
+  if (queue == NULL || !pool.Owns(*queue))
+    return THREAD_HANDLE_INVALID;
+
+  void *block = *queue;
+  thread_return_t retval = DeleteQueue(queue);
+  if (retval == THREAD_SUCCESS)
+    pool.Free(block);
+  return retval;
+}
+
+#endif // configSUPPORT_STATIC_ALLOCATION
+
+#endif // __FREERTOS_WRAPPER_BLOCK_POOL_HPP__
\ No newline at end of file
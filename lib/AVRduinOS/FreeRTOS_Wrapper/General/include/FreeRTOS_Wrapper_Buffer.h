@@ -0,0 +1,375 @@
+/**
+ ********************************************************************************
+ * @file    FreeRTOS_Wrapper_Buffer.h
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Stream and Message Buffer Wrappers for FreeRTOS
+ * @version 1.0
+ * @date    2024-03-18
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+ * @note    Stream and message buffers copy bytes in blocks rather than one
+ *          queue item at a time, between one writer and one reader. A writer
+ *          or reader may be an interrupt. A stream buffer carries a byte
+ *          stream and wakes its reader once the trigger level of bytes is
+ *          waiting. A message buffer carries whole frames of varying length,
+ *          each stored after its length.
+ *
+ *          More than one writer or reader must share the buffer under a
+ *          critical section or mutex.
+ ********************************************************************************
+**/
+
+#include <Arduino_FreeRTOS.h>
+#include <stream_buffer.h>
+#include <message_buffer.h>
+
+#include "FreeRTOS_Wrapper_Types.h"
+
+#ifndef __FREERTOS_WRAPPER_BUFFER_H__
+#define __FREERTOS_WRAPPER_BUFFER_H__
+
+#ifdef __cplusplus
+  extern "C" {
+#endif // __cplusplus
+
+/**
+ ********************************************************************************
+ * @brief   Create a Stream Buffer
+ ********************************************************************************
+ * @param[out]    buffer   TYPE: thread_stream_buffer_handle_t *
+ * @param[in]     size     TYPE: thread_buffer_size_t
+ * @param[in]     trigger  TYPE: thread_buffer_size_t
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @note    A blocked reader is woken once trigger bytes are waiting. Returns
+ *          THREAD_BUFFER_INVALID if size is 0 or trigger is 0 or above size.
+ ********************************************************************************
+**/
+thread_return_t CreateStreamBuffer(thread_stream_buffer_handle_t *buffer,
+                                   thread_buffer_size_t size,
+                                   thread_buffer_size_t trigger);
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/**
+ ********************************************************************************
+ * @brief   Create a Stream Buffer in statically allocated memory
+ ********************************************************************************
+ * @param[out]    buffer   TYPE: thread_stream_buffer_handle_t *
+ * @param[in]     trigger  TYPE: thread_buffer_size_t
+ * @param[in]     memory   TYPE: thread_buffer_static_memory_t *
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @note    The size is taken from memory reserved with
+ *          THREAD_BUFFER_STATIC_MEMORY.
+ * @see     CreateStreamBuffer
+ ********************************************************************************
+**/
+thread_return_t CreateStaticStreamBuffer(thread_stream_buffer_handle_t *buffer,
+                                         thread_buffer_size_t trigger,
+                                         thread_buffer_static_memory_t *memory);
+#endif // configSUPPORT_STATIC_ALLOCATION
+
+/**
+ ********************************************************************************
+ * @brief   Delete a Stream Buffer
+ ********************************************************************************
+ * @param[inout]  buffer  TYPE: thread_stream_buffer_handle_t *
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @note    This function deletes a stream buffer and nullifies the handle.
+ ********************************************************************************
+**/
+thread_return_t DeleteStreamBuffer(thread_stream_buffer_handle_t *buffer);
+
+/**
+ ********************************************************************************
+ * @brief   Send Bytes to a Stream Buffer
+ ********************************************************************************
+ * @param[in]     buffer    TYPE: thread_stream_buffer_handle_t *
+ * @param[in]     data      TYPE: const void *
+ * @param[in]     length    TYPE: thread_buffer_size_t
+ * @param[in]     max_wait  TYPE: thread_time_t
+ * @param[out]    sent      TYPE: thread_buffer_size_t *
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @note    Waits up to max_wait for room for every byte. Returns
+ *          THREAD_BUFFER_FULL if only part was sent, and sent, which may be
+ *          NULL, receives how many bytes were.
+ ********************************************************************************
+**/
+thread_return_t StreamBufferSend(thread_stream_buffer_handle_t *buffer,
+                                 const void *data,
+                                 thread_buffer_size_t length,
+                                 thread_time_t max_wait,
+                                 thread_buffer_size_t *sent);
+
+/**
+ ********************************************************************************
+ * @brief   Send Bytes to a Stream Buffer from an Interrupt
+ ********************************************************************************
+ * @param[in]     buffer  TYPE: thread_stream_buffer_handle_t *
+ * @param[in]     data    TYPE: const void *
+ * @param[in]     length  TYPE: thread_buffer_size_t
+ * @param[out]    sent    TYPE: thread_buffer_size_t *
+ * @param[inout]  yield   TYPE: thread_isr_yield_t *
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @note    yield is set when the bytes woke a reader of higher priority than
+ *          the interrupted thread, for ThreadYieldFromISR.
+ * @see     StreamBufferSend
+ ********************************************************************************
+**/
+thread_return_t StreamBufferSendFromISR(thread_stream_buffer_handle_t *buffer,
+                                        const void *data,
+                                        thread_buffer_size_t length,
+                                        thread_buffer_size_t *sent,
+                                        thread_isr_yield_t *yield);
+
+/**
+ ********************************************************************************
+ * @brief   Receive Bytes from a Stream Buffer
+ ********************************************************************************
+ * @param[in]     buffer    TYPE: thread_stream_buffer_handle_t *
+ * @param[out]    data      TYPE: void *
+ * @param[in]     length    TYPE: thread_buffer_size_t
+ * @param[in]     max_wait  TYPE: thread_time_t
+ * @param[out]    received  TYPE: thread_buffer_size_t *
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @note    Copies up to length bytes. Blocks up to max_wait while fewer than
+ *          the trigger level are waiting, and then takes what there is.
+ *          Returns THREAD_BUFFER_EMPTY if no byte was received.
+ ********************************************************************************
+**/
+thread_return_t StreamBufferReceive(thread_stream_buffer_handle_t *buffer,
+                                    void *data,
+                                    thread_buffer_size_t length,
+                                    thread_time_t max_wait,
+                                    thread_buffer_size_t *received);
+
+/**
+ ********************************************************************************
+ * @brief   Receive Bytes from a Stream Buffer from an Interrupt
+ ********************************************************************************
+ * @param[in]     buffer    TYPE: thread_stream_buffer_handle_t *
+ * @param[out]    data      TYPE: void *
+ * @param[in]     length    TYPE: thread_buffer_size_t
+ * @param[out]    received  TYPE: thread_buffer_size_t *
+ * @param[inout]  yield     TYPE: thread_isr_yield_t *
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @see     StreamBufferReceive, StreamBufferSendFromISR
+ ********************************************************************************
+**/
+thread_return_t StreamBufferReceiveFromISR(thread_stream_buffer_handle_t *buffer,
+                                           void *data,
+                                           thread_buffer_size_t length,
+                                           thread_buffer_size_t *received,
+                                           thread_isr_yield_t *yield);
+
+/**
+ ********************************************************************************
+ * @brief   Change the Trigger Level of a Stream Buffer
+ ********************************************************************************
+ * @param[in]     buffer   TYPE: thread_stream_buffer_handle_t *
+ * @param[in]     trigger  TYPE: thread_buffer_size_t
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @note    Returns THREAD_BUFFER_INVALID if trigger is 0 or above the size.
+ ********************************************************************************
+**/
+thread_return_t StreamBufferTrigger(thread_stream_buffer_handle_t *buffer,
+                                    thread_buffer_size_t trigger);
+
+/**
+ ********************************************************************************
+ * @brief   Empty a Stream Buffer
+ ********************************************************************************
+ * @param[in]     buffer  TYPE: thread_stream_buffer_handle_t *
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @note    Fails while a thread is blocked on the buffer.
+ ********************************************************************************
+**/
+thread_return_t StreamBufferReset(thread_stream_buffer_handle_t *buffer);
+
+/**
+ ********************************************************************************
+ * @brief   Get the Number of Bytes waiting in a Stream Buffer
+ ********************************************************************************
+ * @param[in]     buffer  TYPE: thread_stream_buffer_handle_t *
+ ********************************************************************************
+ * @return  thread_buffer_size_t, 0 for an invalid buffer
+ ********************************************************************************
+**/
+thread_buffer_size_t StreamBufferAvailable(thread_stream_buffer_handle_t *buffer);
+
+/**
+ ********************************************************************************
+ * @brief   Get the Free Space of a Stream Buffer
+ ********************************************************************************
+ * @param[in]     buffer  TYPE: thread_stream_buffer_handle_t *
+ ********************************************************************************
+ * @return  thread_buffer_size_t, 0 for an invalid buffer
+ ********************************************************************************
+**/
+thread_buffer_size_t StreamBufferSpace(thread_stream_buffer_handle_t *buffer);
+
+/**
+ ********************************************************************************
+ * @brief   Create a Message Buffer
+ ********************************************************************************
+ * @param[out]    buffer  TYPE: thread_message_buffer_handle_t *
+ * @param[in]     size    TYPE: thread_buffer_size_t
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @note    Each message takes its length in bytes plus the size of
+ *          configMESSAGE_BUFFER_LENGTH_TYPE, a size_t by default. Returns
+ *          THREAD_BUFFER_INVALID if size cannot hold more than one length.
+ ********************************************************************************
+**/
+thread_return_t CreateMessageBuffer(thread_message_buffer_handle_t *buffer,
+                                    thread_buffer_size_t size);
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/**
+ ********************************************************************************
+ * @brief   Create a Message Buffer in statically allocated memory
+ ********************************************************************************
+ * @param[out]    buffer  TYPE: thread_message_buffer_handle_t *
+ * @param[in]     memory  TYPE: thread_buffer_static_memory_t *
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @see     CreateMessageBuffer, CreateStaticStreamBuffer
+ ********************************************************************************
+**/
+thread_return_t CreateStaticMessageBuffer(thread_message_buffer_handle_t *buffer,
+                                          thread_buffer_static_memory_t *memory);
+#endif // configSUPPORT_STATIC_ALLOCATION
+
+/**
+ ********************************************************************************
+ * @brief   Delete a Message Buffer
+ ********************************************************************************
+ * @param[inout]  buffer  TYPE: thread_message_buffer_handle_t *
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @note    This function deletes a message buffer and nullifies the handle.
+ ********************************************************************************
+**/
+thread_return_t DeleteMessageBuffer(thread_message_buffer_handle_t *buffer);
+
+/**
+ ********************************************************************************
+ * @brief   Send a Message to a Message Buffer
+ ********************************************************************************
+ * @param[in]     buffer    TYPE: thread_message_buffer_handle_t *
+ * @param[in]     data      TYPE: const void *
+ * @param[in]     length    TYPE: thread_buffer_size_t
+ * @param[in]     max_wait  TYPE: thread_time_t
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @note    A message is sent whole or not at all. Returns THREAD_BUFFER_FULL
+ *          if there was no room for it within the maximum wait.
+ ********************************************************************************
+**/
+thread_return_t MessageBufferSend(thread_message_buffer_handle_t *buffer,
+                                  const void *data,
+                                  thread_buffer_size_t length,
+                                  thread_time_t max_wait);
+
+/**
+ ********************************************************************************
+ * @brief   Send a Message to a Message Buffer from an Interrupt
+ ********************************************************************************
+ * @param[in]     buffer  TYPE: thread_message_buffer_handle_t *
+ * @param[in]     data    TYPE: const void *
+ * @param[in]     length  TYPE: thread_buffer_size_t
+ * @param[inout]  yield   TYPE: thread_isr_yield_t *
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @see     MessageBufferSend, StreamBufferSendFromISR
+ ********************************************************************************
+**/
+thread_return_t MessageBufferSendFromISR(thread_message_buffer_handle_t *buffer,
+                                         const void *data,
+                                         thread_buffer_size_t length,
+                                         thread_isr_yield_t *yield);
+
+/**
+ ********************************************************************************
+ * @brief   Receive a Message from a Message Buffer
+ ********************************************************************************
+ * @param[in]     buffer    TYPE: thread_message_buffer_handle_t *
+ * @param[out]    data      TYPE: void *
+ * @param[in]     capacity  TYPE: thread_buffer_size_t
+ * @param[in]     max_wait  TYPE: thread_time_t
+ * @param[out]    length    TYPE: thread_buffer_size_t *
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @note    Returns THREAD_BUFFER_EMPTY if no message arrived within the
+ *          maximum wait, and THREAD_BUFFER_INVALID if the next message is
+ *          longer than capacity, in which case it is left in the buffer.
+ ********************************************************************************
+**/
+thread_return_t MessageBufferReceive(thread_message_buffer_handle_t *buffer,
+                                     void *data,
+                                     thread_buffer_size_t capacity,
+                                     thread_time_t max_wait,
+                                     thread_buffer_size_t *length);
+
+/**
+ ********************************************************************************
+ * @brief   Receive a Message from a Message Buffer from an Interrupt
+ ********************************************************************************
+ * @param[in]     buffer    TYPE: thread_message_buffer_handle_t *
+ * @param[out]    data      TYPE: void *
+ * @param[in]     capacity  TYPE: thread_buffer_size_t
+ * @param[out]    length    TYPE: thread_buffer_size_t *
+ * @param[inout]  yield     TYPE: thread_isr_yield_t *
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @see     MessageBufferReceive, StreamBufferSendFromISR
+ ********************************************************************************
+**/
+thread_return_t MessageBufferReceiveFromISR(thread_message_buffer_handle_t *buffer,
+                                            void *data,
+                                            thread_buffer_size_t capacity,
+                                            thread_buffer_size_t *length,
+                                            thread_isr_yield_t *yield);
+
+/**
+ ********************************************************************************
+ * @brief   Empty a Message Buffer
+ ********************************************************************************
+ * @param[in]     buffer  TYPE: thread_message_buffer_handle_t *
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @see     StreamBufferReset
+ ********************************************************************************
+**/
+thread_return_t MessageBufferReset(thread_message_buffer_handle_t *buffer);
+
+#ifdef __cplusplus
+  }
+#endif // __cplusplus
+
+#endif // __FREERTOS_WRAPPER_BUFFER_H__
\ No newline at end of file
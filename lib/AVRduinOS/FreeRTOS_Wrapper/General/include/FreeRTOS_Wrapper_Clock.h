@@ -0,0 +1,72 @@
+/**
+ ********************************************************************************
+ * @file    FreeRTOS_Wrapper_Clock.h
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Microsecond Clock for FreeRTOS Wrapper Features
+ * @version 1.0
+ * @date    2024-03-18
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+ * @note    This file is read from FreeRTOSConfig.h through the hooks header, so
+ *          it may only use plain C types.
+ ********************************************************************************
+**/
+
+#ifndef __FREERTOS_WRAPPER_CLOCK_H__
+#define __FREERTOS_WRAPPER_CLOCK_H__
+
+#include <stdint.h>
+
+#include "FreeRTOS_Wrapper_Configuration.h"
+
+#ifdef __cplusplus
+  extern "C" {
+#endif // __cplusplus
+
+#if (THREAD_CLOCK_ENABLED == 1)
+
+/**
+ ********************************************************************************
+ * @brief   Start the Microsecond Clock
+ ********************************************************************************
+ * @note    This function takes over THREAD_CLOCK_TIMER. It is called when the
+ *          scheduler starts and may be called again safely.
+ ********************************************************************************
+**/
+void ThreadClockInit(void);
+
+/**
+ ********************************************************************************
+ * @brief   Get the Microsecond Clock
+ ********************************************************************************
+ * @return  uint32_t
+ ********************************************************************************
+ * @note    This function may be called from interrupts. The count wraps after
+ *          about 71 minutes.
+ ********************************************************************************
+**/
+uint32_t ThreadClockMicros(void);
+
+/**
+ ********************************************************************************
+ * @brief   Get the Microsecond Clock without wrapping
+ ********************************************************************************
+ * @return  uint64_t
+ ********************************************************************************
+ * @note    This function may be called from interrupts. On the timer the count
+ *          is built from the 32-bit overflow count, which lasts for years. The
+ *          micros() fallback on the board and the host only sees the wraps of
+ *          micros() between readings, so it must be read at least once every
+ *          71 minutes.
+ ********************************************************************************
+**/
+uint64_t ThreadClockMicros64(void);
+
+#endif // THREAD_CLOCK_ENABLED
+
+#ifdef __cplusplus
+  }
+#endif // __cplusplus
+
+#endif // __FREERTOS_WRAPPER_CLOCK_H__
\ No newline at end of file
@@ -8,4 +8,241 @@
  ********************************************************************************
  * @copyright Copyright (c) 2024
  ********************************************************************************
-**/
\ No newline at end of file
+**/
+
+#ifndef __FREERTOS_WRAPPER_CONFIGURATION_H__
+#define __FREERTOS_WRAPPER_CONFIGURATION_H__
+
+/**
+ ********************************************************************************
+ * Kernel Hooks
+ ********************************************************************************
+ * The optional features below need trace macros and run time counters inside the
+ * kernel. Enable them by adding the following line to the end of FreeRTOSConfig.h
+ * and defining the feature flags here or through build_flags:
+ *
+ *     #include "FreeRTOS_Wrapper_Hooks.h"
+ *
+ * The hooks header then turns on the kernel options each enabled feature needs.
+ ********************************************************************************
+**/
+
+/**
+ ********************************************************************************
+ * @brief   CreateStaticThread and the other static Create functions
+ ********************************************************************************
+ * @note    Turns on configSUPPORT_STATIC_ALLOCATION, which the stock AVR
+ *          FreeRTOSConfig.h leaves off. The wrapper then supplies the idle and
+ *          timer thread memory the kernel asks for, unless the kernel or the
+ *          application already does.
+ ********************************************************************************
+**/
+#ifndef THREAD_STATIC_ALLOCATION_ENABLED
+  #define THREAD_STATIC_ALLOCATION_ENABLED 1
+#endif // THREAD_STATIC_ALLOCATION_ENABLED
+
+/**
+ ********************************************************************************
+ * @brief   Per-thread run time, CPU load and context switch statistics
+ ********************************************************************************
+**/
+#ifndef THREAD_STATS_ENABLED
+  #define THREAD_STATS_ENABLED 0
+#endif // THREAD_STATS_ENABLED
+
+/**
+ ********************************************************************************
+ * @brief   Binary trace of scheduler, queue and notification events
+ ********************************************************************************
+**/
+#ifndef THREAD_TRACE_ENABLED
+  #define THREAD_TRACE_ENABLED 0
+#endif // THREAD_TRACE_ENABLED
+
+/**
+ ********************************************************************************
+ * @brief   Number of trace records buffered in RAM, a power of two up to 128
+ ********************************************************************************
+**/
+#ifndef THREAD_TRACE_RECORDS
+  #define THREAD_TRACE_RECORDS 64
+#endif // THREAD_TRACE_RECORDS
+
+/**
+ ********************************************************************************
+ * @brief   Milliseconds the trace drain thread sleeps once the buffer is empty
+ ********************************************************************************
+**/
+#ifndef THREAD_TRACE_DRAIN_MS
+  #define THREAD_TRACE_DRAIN_MS 50
+#endif // THREAD_TRACE_DRAIN_MS
+
+/**
+ ********************************************************************************
+ * @brief   Number of threads, including the idle and timer threads, that the
+ *          kernel hooks give an id to, at most 31
+ ********************************************************************************
+ * @note    Threads created once every id is taken share id 0. The trace does
+ *          not tell them apart and the statistics count no context switches
+ *          for them.
+ ********************************************************************************
+**/
+#ifndef THREAD_HOOK_MAX_THREADS
+  #define THREAD_HOOK_MAX_THREADS 8
+#endif // THREAD_HOOK_MAX_THREADS
+
+/**
+ ********************************************************************************
+ * @brief   Number of threads, including the idle and timer threads, that the
+ *          statistics can read from the kernel at once
+ ********************************************************************************
+ * @note    ThreadStatsGet and ThreadStatsDump return THREAD_MEMORY_INVALID
+ *          with no data while more threads exist. Each one costs a
+ *          TaskStatus_t of RAM.
+ ********************************************************************************
+**/
+#ifndef THREAD_STATS_MAX_THREADS
+  #define THREAD_STATS_MAX_THREADS 12
+#endif // THREAD_STATS_MAX_THREADS
+
+/**
+ ********************************************************************************
+ * @brief   16-bit hardware timer (1, 3, 4 or 5) used as the microsecond clock
+ ********************************************************************************
+ * @note    The clock is claimed by THREAD_STATS_ENABLED, THREAD_TRACE_ENABLED,
+ *          THREAD_MUTEX_STATS_ENABLED and THREAD_TIME_MICROS_ENABLED. With any
+ *          of them set the timer is taken over when the scheduler starts, so
+ *          analogWrite on its PWM pins and libraries such as Servo must not
+ *          use it. Set to 0 to fall back to micros(), which has a 4
+ *          microsecond resolution.
+ ********************************************************************************
+**/
+#ifndef THREAD_CLOCK_TIMER
+  #define THREAD_CLOCK_TIMER 5
+#endif // THREAD_CLOCK_TIMER
+
+/**
+ ********************************************************************************
+ * @brief   Number of threads whose stacks are watched by the stack monitor
+ ********************************************************************************
+ * @note    Threads made with CreateThread or CreateStaticThread are registered
+ *          until the registry is full, and removed by the kernel's delete hook
+ *          however they are deleted. Set to 0 to remove the stack monitor.
+ ********************************************************************************
+**/
+#ifndef THREAD_STACK_MONITOR_THREADS
+  #define THREAD_STACK_MONITOR_THREADS 0
+#endif // THREAD_STACK_MONITOR_THREADS
+
+/**
+ ********************************************************************************
+ * @brief   Stack words kept free on top of the deepest use seen when suggesting
+ *          a stack size, enough for the context saved by an interrupt
+ ********************************************************************************
+**/
+#ifndef THREAD_STACK_MARGIN
+  #define THREAD_STACK_MARGIN 48
+#endif // THREAD_STACK_MARGIN
+
+/**
+ ********************************************************************************
+ * @brief   Smallest stack depth in words that a thread is created with
+ ********************************************************************************
+ * @note    Host builds run each thread on a pthread, which cannot have a stack
+ *          below PTHREAD_STACK_MIN. Leave at 0 on the board.
+ ********************************************************************************
+**/
+#ifndef THREAD_STACK_MINIMUM
+  #define THREAD_STACK_MINIMUM 0
+#endif // THREAD_STACK_MINIMUM
+
+/**
+ ********************************************************************************
+ * @brief   Lock counts, contention and hold times of every mutex
+ ********************************************************************************
+**/
+#ifndef THREAD_MUTEX_STATS_ENABLED
+  #define THREAD_MUTEX_STATS_ENABLED 0
+#endif // THREAD_MUTEX_STATS_ENABLED
+
+/**
+ ********************************************************************************
+ * @brief   Number of periodic threads whose deadlines are watched
+ ********************************************************************************
+ * @note    Threads are registered with ThreadDeadlineRegister. The registry is
+ *          scanned on every context switch, so keep it small. Set to 0 to
+ *          remove the deadline monitor.
+ ********************************************************************************
+**/
+#ifndef THREAD_DEADLINE_MONITOR_THREADS
+  #define THREAD_DEADLINE_MONITOR_THREADS 0
+#endif // THREAD_DEADLINE_MONITOR_THREADS
+
+/**
+ ********************************************************************************
+ * @brief   Microsecond time from ThreadTimeMicros and ThreadTimeMicros64
+ ********************************************************************************
+**/
+#ifndef THREAD_TIME_MICROS_ENABLED
+  #define THREAD_TIME_MICROS_ENABLED 0
+#endif // THREAD_TIME_MICROS_ENABLED
+
+/**
+ ********************************************************************************
+ * @brief   Stop the tick and sleep while every thread is blocked
+ ********************************************************************************
+ * @note    Needs the watchdog tick of the AVR port. In SLEEP_MODE_IDLE the
+ *          watchdog is stretched over the expected idle time and the tick
+ *          count is stepped on wake, so each sleep can leave the tick up to
+ *          one period late. See THREAD_TICKLESS_SLEEP_MODE for the power saved.
+ ********************************************************************************
+**/
+#ifndef THREAD_TICKLESS_IDLE_ENABLED
+  #define THREAD_TICKLESS_IDLE_ENABLED 0
+#endif // THREAD_TICKLESS_IDLE_ENABLED
+
+/**
+ ********************************************************************************
+ * @brief   Fewest idle ticks worth stopping the tick for, at least 2
+ ********************************************************************************
+**/
+#ifndef THREAD_TICKLESS_MIN_TICKS
+  #define THREAD_TICKLESS_MIN_TICKS 4
+#endif // THREAD_TICKLESS_MIN_TICKS
+
+/**
+ ********************************************************************************
+ * @brief   Sleep mode of <avr/sleep.h> entered while the tick is stopped
+ ********************************************************************************
+ * @note    SLEEP_MODE_IDLE keeps millis() and the UARTs running, and Timer0
+ *          still wakes the CPU about every millisecond. Only the core clock is
+ *          stopped between those wakes, and stretching the tick removes just
+ *          about one wake in fifteen, so the saving is close to that of idle sleep
+ *          alone. Deeper modes such as SLEEP_MODE_PWR_DOWN stop the timers,
+ *          millis() and the UARTs, and draw far less. In them the watchdog
+ *          keeps its tick period and wakes the CPU briefly for each tick, so
+ *          ticks are counted as they pass and an early wake by another
+ *          interrupt loses none of them.
+ ********************************************************************************
+**/
+#ifndef THREAD_TICKLESS_SLEEP_MODE
+  #define THREAD_TICKLESS_SLEEP_MODE SLEEP_MODE_IDLE
+#endif // THREAD_TICKLESS_SLEEP_MODE
+
+// Features that share the kernel hooks
+#if (THREAD_STATS_ENABLED == 1) || (THREAD_TRACE_ENABLED == 1) || (THREAD_TICKLESS_IDLE_ENABLED == 1) || \
+    (THREAD_STACK_MONITOR_THREADS > 0) || (THREAD_DEADLINE_MONITOR_THREADS > 0)
+  #define THREAD_HOOKS_ENABLED 1
+#else
+  #define THREAD_HOOKS_ENABLED 0
+#endif
+
+// Features that share the microsecond clock
+#if (THREAD_STATS_ENABLED == 1) || (THREAD_TRACE_ENABLED == 1) || (THREAD_MUTEX_STATS_ENABLED == 1) || \
+    (THREAD_TIME_MICROS_ENABLED == 1)
+  #define THREAD_CLOCK_ENABLED 1
+#else
+  #define THREAD_CLOCK_ENABLED 0
+#endif
+
+#endif // __FREERTOS_WRAPPER_CONFIGURATION_H__
\ No newline at end of file
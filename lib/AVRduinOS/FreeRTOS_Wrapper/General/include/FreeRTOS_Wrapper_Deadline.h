@@ -0,0 +1,108 @@
+/**
+ ********************************************************************************
+ * @file    FreeRTOS_Wrapper_Deadline.h
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Deadline Monitor for Periodic Threads
+ * @version 1.0
+ * @date    2024-03-18
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+ * @note    A periodic thread registers its thread_period_t after
+ *          ThreadPeriodInit. From then on every context switch checks whether
+ *          a registered thread is still inside a cycle past its deadline, which
+ *          catches a thread that is starved or stuck as soon as anything else
+ *          runs. ThreadPeriodWait checks again when the cycle ends, so a cycle
+ *          that finishes late without a switch is counted as well. Each cycle
+ *          is counted at most once.
+ ********************************************************************************
+**/
+
+#include <Arduino_FreeRTOS.h>
+
+#include "FreeRTOS_Wrapper_Configuration.h"
+#include "FreeRTOS_Wrapper_Types.h"
+
+#ifndef __FREERTOS_WRAPPER_DEADLINE_H__
+#define __FREERTOS_WRAPPER_DEADLINE_H__
+
+#ifdef __cplusplus
+  extern "C" {
+#endif // __cplusplus
+
+#if (THREAD_DEADLINE_MONITOR_THREADS > 0)
+
+/**
+ ********************************************************************************
+ * @brief   Watch the Deadline of the running Periodic Thread
+ ********************************************************************************
+ * @param[inout]  period        TYPE: thread_period_t *
+ * @param[in]     deadline_ms   TYPE: thread_time_t, 0 for the period
+ * @param[in]     hook          TYPE: thread_deadline_hook_t, may be NULL
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @note    Call from the periodic thread after ThreadPeriodInit. The deadline
+ *          is counted from the release of each cycle and must be from one tick
+ *          to one period long. On a miss, misses is counted and the hook is
+ *          called. It may run inside the context switch, so it must not block
+ *          and may only use FromISR functions. Returning DEADLINE_SKIP drops
+ *          the next release, so the late cycle does not also overrun the
+ *          following one. Registering the same thread again replaces its entry
+ *          and deleting the thread removes it.
+ ********************************************************************************
+**/
+thread_return_t ThreadDeadlineRegister(thread_period_t *period,
+                                       thread_time_t deadline_ms,
+                                       thread_deadline_hook_t hook);
+
+/**
+ ********************************************************************************
+ * @brief   Get the Number of Deadline Misses of every Thread
+ ********************************************************************************
+ * @return  uint32_t
+ ********************************************************************************
+**/
+uint32_t ThreadDeadlineMisses(void);
+
+/**
+ ********************************************************************************
+ * @brief   Check one Periodic Thread against its Deadline
+ ********************************************************************************
+ * @param[in]     thread  TYPE: thread_handle_t
+ * @param[inout]  period  TYPE: thread_period_t *
+ * @param[in]     now     TYPE: TickType_t
+ ********************************************************************************
+ * @note    Called with interrupts off, from the switch hook and from
+ *          ThreadPeriodWait.
+ ********************************************************************************
+**/
+void ThreadDeadlineCheck(thread_handle_t thread, thread_period_t *period, TickType_t now);
+
+/**
+ ********************************************************************************
+ * @brief   Check every registered Thread against its Deadline
+ ********************************************************************************
+ * @note    Called from traceTASK_SWITCHED_IN with the scheduler locked.
+ ********************************************************************************
+**/
+void ThreadDeadlineSwitchedIn(void);
+
+/**
+ ********************************************************************************
+ * @brief   Remove a Thread from the Deadline Monitor
+ ********************************************************************************
+ * @param[in]     thread  TYPE: void *
+ ********************************************************************************
+ * @note    Called from traceTASK_DELETE.
+ ********************************************************************************
+**/
+void ThreadDeadlineDelete(void *thread);
+
+#endif // THREAD_DEADLINE_MONITOR_THREADS
+
+#ifdef __cplusplus
+  }
+#endif // __cplusplus
+
+#endif // __FREERTOS_WRAPPER_DEADLINE_H__
\ No newline at end of file
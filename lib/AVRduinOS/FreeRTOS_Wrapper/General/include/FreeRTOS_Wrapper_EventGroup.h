@@ -0,0 +1,205 @@
+/**
+ ********************************************************************************
+ * @file    FreeRTOS_Wrapper_EventGroup.h
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Event Group Wrappers for FreeRTOS
+ * @version 1.0
+ * @date    2024-03-18
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+ * @note    An event group holds a set of flags that threads block on until
+ *          any or all of the flags they wait for are set, in place of polling
+ *          shared booleans. Bits outside THREAD_EVENT_BITS_ALL are rejected.
+ ********************************************************************************
+**/
+
+#include <Arduino_FreeRTOS.h>
+#include <event_groups.h>
+
+#include "FreeRTOS_Wrapper_Types.h"
+
+#ifndef __FREERTOS_WRAPPER_EVENT_GROUP_H__
+#define __FREERTOS_WRAPPER_EVENT_GROUP_H__
+
+#ifdef __cplusplus
+  extern "C" {
+#endif // __cplusplus
+
+/**
+ ********************************************************************************
+ * @brief   Create an Event Group
+ ********************************************************************************
+ * @param[out]    group  TYPE: thread_event_group_handle_t *
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @note    Every bit starts out clear.
+ ********************************************************************************
+**/
+thread_return_t CreateEventGroup(thread_event_group_handle_t *group);
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/**
+ ********************************************************************************
+ * @brief   Create an Event Group in statically allocated memory
+ ********************************************************************************
+ * @param[out]    group   TYPE: thread_event_group_handle_t *
+ * @param[in]     memory  TYPE: thread_event_group_static_memory_t *
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @note    The control block is reserved with THREAD_EVENT_GROUP_STATIC_MEMORY.
+ * @see     CreateEventGroup
+ ********************************************************************************
+**/
+thread_return_t CreateStaticEventGroup(thread_event_group_handle_t *group,
+                                       thread_event_group_static_memory_t *memory);
+#endif // configSUPPORT_STATIC_ALLOCATION
+
+/**
+ ********************************************************************************
+ * @brief   Delete an Event Group
+ ********************************************************************************
+ * @param[inout]  group  TYPE: thread_event_group_handle_t *
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @note    This function deletes an event group and nullifies the handle.
+ *          Threads still waiting on it are released with their bits unset.
+ ********************************************************************************
+**/
+thread_return_t DeleteEventGroup(thread_event_group_handle_t *group);
+
+/**
+ ********************************************************************************
+ * @brief   Set Bits in an Event Group
+ ********************************************************************************
+ * @param[in]     group  TYPE: thread_event_group_handle_t *
+ * @param[in]     bits   TYPE: thread_event_bits_t
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @note    Every thread whose wait is satisfied by the new bits is woken.
+ ********************************************************************************
+**/
+thread_return_t EventGroupSet(thread_event_group_handle_t *group,
+                              thread_event_bits_t bits);
+
+/**
+ ********************************************************************************
+ * @brief   Clear Bits in an Event Group
+ ********************************************************************************
+ * @param[in]     group  TYPE: thread_event_group_handle_t *
+ * @param[in]     bits   TYPE: thread_event_bits_t
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+**/
+thread_return_t EventGroupClear(thread_event_group_handle_t *group,
+                                thread_event_bits_t bits);
+
+/**
+ ********************************************************************************
+ * @brief   Get the Bits of an Event Group
+ ********************************************************************************
+ * @param[in]     group  TYPE: thread_event_group_handle_t *
+ ********************************************************************************
+ * @return  thread_event_bits_t
+ ********************************************************************************
+ * @note    Returns 0 for an invalid event group.
+ ********************************************************************************
+**/
+thread_event_bits_t EventGroupGet(thread_event_group_handle_t *group);
+
+/**
+ ********************************************************************************
+ * @brief   Wait for Bits in an Event Group
+ ********************************************************************************
+ * @param[in]     group     TYPE: thread_event_group_handle_t *
+ * @param[in]     bits      TYPE: thread_event_bits_t
+ * @param[in]     wait      TYPE: thread_event_wait_t
+ * @param[in]     clear     TYPE: bool
+ * @param[in]     max_wait  TYPE: thread_time_t
+ * @param[out]    result    TYPE: thread_event_bits_t *
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @note    Blocks until any (WAIT_ANY) or all (WAIT_ALL) of the bits are set.
+ *          With clear set, the bits waited for are cleared on success in the
+ *          same step, so no other thread sees them. result, which may be
+ *          NULL, receives the bits of the group when the wait ended.
+ *          Returns THREAD_EVENT_TIMEOUT if the bits were not set within the
+ *          maximum wait.
+ ********************************************************************************
+**/
+thread_return_t EventGroupWait(thread_event_group_handle_t *group,
+                               thread_event_bits_t bits,
+                               thread_event_wait_t wait,
+                               bool clear,
+                               thread_time_t max_wait,
+                               thread_event_bits_t *result);
+
+/**
+ ********************************************************************************
+ * @brief   Set Bits and wait for every Thread of a Rendezvous
+ ********************************************************************************
+ * @param[in]     group     TYPE: thread_event_group_handle_t *
+ * @param[in]     set_bits  TYPE: thread_event_bits_t
+ * @param[in]     bits      TYPE: thread_event_bits_t
+ * @param[in]     max_wait  TYPE: thread_time_t
+ * @param[out]    result    TYPE: thread_event_bits_t *
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @note    Each thread of the rendezvous sets its own bit and waits for all
+ *          of them. The bits are cleared once all are set.
+ * @see     EventGroupWait
+ ********************************************************************************
+**/
+thread_return_t EventGroupSync(thread_event_group_handle_t *group,
+                               thread_event_bits_t set_bits,
+                               thread_event_bits_t bits,
+                               thread_time_t max_wait,
+                               thread_event_bits_t *result);
+
+#if (configUSE_TIMERS == 1) && (INCLUDE_xTimerPendFunctionCall == 1)
+/**
+ ********************************************************************************
+ * @brief   Set Bits in an Event Group from an Interrupt
+ ********************************************************************************
+ * @param[in]     group  TYPE: thread_event_group_handle_t *
+ * @param[in]     bits   TYPE: thread_event_bits_t
+ * @param[inout]  yield  TYPE: thread_isr_yield_t *
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @note    Setting bits may wake any number of threads, which the kernel will
+ *          not do in an interrupt, so the bits are set by the timer daemon
+ *          thread. yield is set when the daemon has a higher priority than
+ *          the interrupted thread. Returns THREAD_FAILURE_QUEUE_BLOCKED if
+ *          the timer command queue is full.
+ * @see     EventGroupSet
+ ********************************************************************************
+**/
+thread_return_t EventGroupSetFromISR(thread_event_group_handle_t *group,
+                                     thread_event_bits_t bits,
+                                     thread_isr_yield_t *yield);
+#endif // configUSE_TIMERS
+
+/**
+ ********************************************************************************
+ * @brief   Get the Bits of an Event Group from an Interrupt
+ ********************************************************************************
+ * @param[in]     group  TYPE: thread_event_group_handle_t *
+ ********************************************************************************
+ * @return  thread_event_bits_t
+ ********************************************************************************
+**/
+thread_event_bits_t EventGroupGetFromISR(thread_event_group_handle_t *group);
+
+#ifdef __cplusplus
+  }
+#endif // __cplusplus
+
+#endif // __FREERTOS_WRAPPER_EVENT_GROUP_H__
\ No newline at end of file
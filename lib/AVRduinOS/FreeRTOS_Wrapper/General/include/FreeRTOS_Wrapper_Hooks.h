@@ -0,0 +1,208 @@
+/**
+ ********************************************************************************
+ * @file    FreeRTOS_Wrapper_Hooks.h
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Kernel Hooks for FreeRTOS Wrapper Features
+ * @version 1.0
+ * @date    2024-03-18
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+ * @note    Include this file at the end of FreeRTOSConfig.h. It is read before
+ *          the kernel headers, so it may only use plain C types.
+ ********************************************************************************
+**/
+
+#ifndef __FREERTOS_WRAPPER_HOOKS_H__
+#define __FREERTOS_WRAPPER_HOOKS_H__
+
+#include "FreeRTOS_Wrapper_Configuration.h"
+
+/**
+ ********************************************************************************
+ * Trace Events
+ ********************************************************************************
+ * Event codes of the binary trace records, shared with tools/trace_decode.py.
+ * The object of a thread event is its hook id, of a queue event the queue
+ * number and of a notification the notification index.
+ ********************************************************************************
+**/
+#define THREAD_TRACE_SWITCHED_IN            0x01
+#define THREAD_TRACE_SWITCHED_OUT           0x02
+#define THREAD_TRACE_CREATE                 0x03
+#define THREAD_TRACE_DELETE                 0x04
+#define THREAD_TRACE_DELAY                  0x05
+#define THREAD_TRACE_DELAY_UNTIL            0x06
+#define THREAD_TRACE_SUSPEND                0x07
+#define THREAD_TRACE_RESUME                 0x08
+#define THREAD_TRACE_NOTIFY                 0x10
+#define THREAD_TRACE_NOTIFY_FROM_ISR        0x11
+#define THREAD_TRACE_NOTIFY_TAKE            0x12
+#define THREAD_TRACE_NOTIFY_WAIT            0x13
+#define THREAD_TRACE_QUEUE_CREATE           0x20
+#define THREAD_TRACE_QUEUE_SEND             0x21
+#define THREAD_TRACE_QUEUE_SEND_FAILED      0x22
+#define THREAD_TRACE_QUEUE_RECEIVE          0x23
+#define THREAD_TRACE_QUEUE_RECEIVE_FAILED   0x24
+#define THREAD_TRACE_QUEUE_SEND_FROM_ISR    0x25
+#define THREAD_TRACE_QUEUE_RECEIVE_FROM_ISR 0x26
+#define THREAD_TRACE_QUEUE_BLOCK_SEND       0x27
+#define THREAD_TRACE_QUEUE_BLOCK_RECEIVE    0x28
+#define THREAD_TRACE_MARK                   0x30
+#define THREAD_TRACE_OVERFLOW               0x3F
+
+#ifndef __ASSEMBLER__
+
+#include <stdint.h>
+
+#include "FreeRTOS_Wrapper_Clock.h"
+
+#ifdef __cplusplus
+  extern "C" {
+#endif // __cplusplus
+
+#if (THREAD_HOOKS_ENABLED == 1)
+/**
+ ********************************************************************************
+ * @brief   Get the Hook Id of a Thread
+ ********************************************************************************
+ * @param[in]     thread  TYPE: void *, NULL for the running thread
+ ********************************************************************************
+ * @return  uint8_t
+ ********************************************************************************
+ * @note    Ids run from 1 to THREAD_HOOK_MAX_THREADS and are handed out when a
+ *          thread is created. Id 0 is shared by every thread created once the
+ *          ids ran out.
+ ********************************************************************************
+**/
+uint8_t ThreadHookId(void *thread);
+
+/**
+ ********************************************************************************
+ * @brief   Get the Thread holding a Hook Id
+ ********************************************************************************
+ * @param[in]     id  TYPE: uint8_t
+ ********************************************************************************
+ * @return  void *, NULL if the id is free
+ ********************************************************************************
+**/
+void *ThreadHookThread(uint8_t id);
+
+void ThreadHookCreate(void *thread);
+void ThreadHookDelete(void *thread);
+void ThreadHookSwitchedIn(void);
+void ThreadHookSwitchedOut(void);
+void ThreadHookTask(uint8_t event, void *thread);
+void ThreadHookQueueCreate(void *queue);
+void ThreadHookQueue(uint8_t event, void *queue);
+void ThreadHookEvent(uint8_t event, uint8_t object);
+#endif // THREAD_HOOKS_ENABLED
+
+#if (THREAD_TICKLESS_IDLE_ENABLED == 1)
+void ThreadTicklessSleep(uint32_t expected_ticks);
+void ThreadTicklessTick(void);
+#endif // THREAD_TICKLESS_IDLE_ENABLED
+
+#ifdef __cplusplus
+  }
+#endif // __cplusplus
+
+#endif // __ASSEMBLER__
+
+#endif // __FREERTOS_WRAPPER_HOOKS_H__
+
+// Kernel options are applied on every inclusion so they win over FreeRTOSConfig.h
+
+#if (THREAD_HOOKS_ENABLED == 1)
+  #undef configUSE_TRACE_FACILITY
+  #define configUSE_TRACE_FACILITY 1
+
+  #undef traceTASK_CREATE
+  #define traceTASK_CREATE(pxNewTCB) ThreadHookCreate((void *)(pxNewTCB))
+  #undef traceTASK_DELETE
+  #define traceTASK_DELETE(pxTaskToDelete) ThreadHookDelete((void *)(pxTaskToDelete))
+  #undef traceTASK_SWITCHED_IN
+  #define traceTASK_SWITCHED_IN() ThreadHookSwitchedIn()
+#endif // THREAD_HOOKS_ENABLED
+
+#if (THREAD_STATIC_ALLOCATION_ENABLED == 1)
+  #undef configSUPPORT_STATIC_ALLOCATION
+  #define configSUPPORT_STATIC_ALLOCATION 1
+#endif // THREAD_STATIC_ALLOCATION_ENABLED
+
+#if (THREAD_STATS_ENABLED == 1)
+  #undef configGENERATE_RUN_TIME_STATS
+  #define configGENERATE_RUN_TIME_STATS 1
+  #undef INCLUDE_xTaskGetIdleTaskHandle
+  #define INCLUDE_xTaskGetIdleTaskHandle 1
+
+  #undef portCONFIGURE_TIMER_FOR_RUN_TIME_STATS
+  #define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS() ThreadClockInit()
+  #undef portGET_RUN_TIME_COUNTER_VALUE
+  #define portGET_RUN_TIME_COUNTER_VALUE() ThreadClockMicros()
+#endif // THREAD_STATS_ENABLED
+
+#if (THREAD_TRACE_ENABLED == 1)
+  #undef traceTASK_SWITCHED_OUT
+  #define traceTASK_SWITCHED_OUT() ThreadHookSwitchedOut()
+  #undef traceTASK_DELAY
+  #define traceTASK_DELAY() ThreadHookTask(THREAD_TRACE_DELAY, 0)
+  #undef traceTASK_DELAY_UNTIL
+  #define traceTASK_DELAY_UNTIL(xTimeToWake) ThreadHookTask(THREAD_TRACE_DELAY_UNTIL, 0)
+  #undef traceTASK_SUSPEND
+  #define traceTASK_SUSPEND(pxTaskToSuspend) ThreadHookTask(THREAD_TRACE_SUSPEND, (void *)(pxTaskToSuspend))
+  #undef traceTASK_RESUME
+  #define traceTASK_RESUME(pxTaskToResume) ThreadHookTask(THREAD_TRACE_RESUME, (void *)(pxTaskToResume))
+  #undef traceTASK_RESUME_FROM_ISR
+  #define traceTASK_RESUME_FROM_ISR(pxTaskToResume) ThreadHookTask(THREAD_TRACE_RESUME, (void *)(pxTaskToResume))
+
+  #undef traceTASK_NOTIFY
+  #define traceTASK_NOTIFY(uxIndexToNotify) ThreadHookEvent(THREAD_TRACE_NOTIFY, (uint8_t)(uxIndexToNotify))
+  #undef traceTASK_NOTIFY_FROM_ISR
+  #define traceTASK_NOTIFY_FROM_ISR(uxIndexToNotify) ThreadHookEvent(THREAD_TRACE_NOTIFY_FROM_ISR, (uint8_t)(uxIndexToNotify))
+  #undef traceTASK_NOTIFY_GIVE_FROM_ISR
+  #define traceTASK_NOTIFY_GIVE_FROM_ISR(uxIndexToNotify) ThreadHookEvent(THREAD_TRACE_NOTIFY_FROM_ISR, (uint8_t)(uxIndexToNotify))
+  #undef traceTASK_NOTIFY_TAKE
+  #define traceTASK_NOTIFY_TAKE(uxIndexToWaitOn) ThreadHookEvent(THREAD_TRACE_NOTIFY_TAKE, (uint8_t)(uxIndexToWaitOn))
+  #undef traceTASK_NOTIFY_WAIT
+  #define traceTASK_NOTIFY_WAIT(uxIndexToWaitOn) ThreadHookEvent(THREAD_TRACE_NOTIFY_WAIT, (uint8_t)(uxIndexToWaitOn))
+
+  #undef traceQUEUE_CREATE
+  #define traceQUEUE_CREATE(pxNewQueue) ThreadHookQueueCreate((void *)(pxNewQueue))
+  #undef traceQUEUE_SEND
+  #define traceQUEUE_SEND(pxQueue) ThreadHookQueue(THREAD_TRACE_QUEUE_SEND, (void *)(pxQueue))
+  #undef traceQUEUE_SEND_FAILED
+  #define traceQUEUE_SEND_FAILED(pxQueue) ThreadHookQueue(THREAD_TRACE_QUEUE_SEND_FAILED, (void *)(pxQueue))
+  #undef traceQUEUE_RECEIVE
+  #define traceQUEUE_RECEIVE(pxQueue) ThreadHookQueue(THREAD_TRACE_QUEUE_RECEIVE, (void *)(pxQueue))
+  #undef traceQUEUE_RECEIVE_FAILED
+  #define traceQUEUE_RECEIVE_FAILED(pxQueue) ThreadHookQueue(THREAD_TRACE_QUEUE_RECEIVE_FAILED, (void *)(pxQueue))
+  #undef traceQUEUE_SEND_FROM_ISR
+  #define traceQUEUE_SEND_FROM_ISR(pxQueue) ThreadHookQueue(THREAD_TRACE_QUEUE_SEND_FROM_ISR, (void *)(pxQueue))
+  #undef traceQUEUE_RECEIVE_FROM_ISR
+  #define traceQUEUE_RECEIVE_FROM_ISR(pxQueue) ThreadHookQueue(THREAD_TRACE_QUEUE_RECEIVE_FROM_ISR, (void *)(pxQueue))
+  #undef traceBLOCKING_ON_QUEUE_SEND
+  #define traceBLOCKING_ON_QUEUE_SEND(pxQueue) ThreadHookQueue(THREAD_TRACE_QUEUE_BLOCK_SEND, (void *)(pxQueue))
+  #undef traceBLOCKING_ON_QUEUE_RECEIVE
+  #define traceBLOCKING_ON_QUEUE_RECEIVE(pxQueue) ThreadHookQueue(THREAD_TRACE_QUEUE_BLOCK_RECEIVE, (void *)(pxQueue))
+#endif // THREAD_TRACE_ENABLED
+
+#if (THREAD_STACK_MONITOR_THREADS > 0)
+  #undef INCLUDE_uxTaskGetStackHighWaterMark
+  #define INCLUDE_uxTaskGetStackHighWaterMark 1
+#endif // THREAD_STACK_MONITOR_THREADS
+
+#if (THREAD_TICKLESS_IDLE_ENABLED == 1)
+  // The wake latency ends when the woken thread, rather than idle, is switched in
+  #undef INCLUDE_xTaskGetIdleTaskHandle
+  #define INCLUDE_xTaskGetIdleTaskHandle 1
+  #undef configUSE_TICKLESS_IDLE
+  #define configUSE_TICKLESS_IDLE 2
+  #undef configEXPECTED_IDLE_TIME_BEFORE_SLEEP
+  #define configEXPECTED_IDLE_TIME_BEFORE_SLEEP THREAD_TICKLESS_MIN_TICKS
+
+  #undef portSUPPRESS_TICKS_AND_SLEEP
+  #define portSUPPRESS_TICKS_AND_SLEEP(xExpectedIdleTime) ThreadTicklessSleep((uint32_t)(xExpectedIdleTime))
+  #undef traceTASK_INCREMENT_TICK
+  #define traceTASK_INCREMENT_TICK(xTickCount) ThreadTicklessTick()
+#endif // THREAD_TICKLESS_IDLE_ENABLED
\ No newline at end of file
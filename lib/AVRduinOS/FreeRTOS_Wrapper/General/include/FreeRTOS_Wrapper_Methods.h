@@ -34,7 +34,9 @@
  ********************************************************************************
  * @note    This function creates a thread configuration struct that can be used
  *          to create a thread. The struct is used to ensure that the thread is
- *          created with the correct parameters.
+ *          created with the correct parameters. The priority may be any level
+ *          from THREAD_PRIORITY_LOW to THREAD_PRIORITY_MAX, which is the top
+ *          level of configMAX_PRIORITIES.
  ******************************************************************************** 
 **/
 thread_function_t ConfigureThread(const char *thread_name, 
@@ -42,6 +44,58 @@ thread_function_t ConfigureThread(const char *thread_name,
                                   thread_priority_t priority, 
                                   thread_stack_size_t stack_size);
 
+/**
+ ********************************************************************************
+ * @brief   Method to create a FreeRTOS Wrapper Thread Configuration Struct with
+ *          a context pointer
+ ********************************************************************************
+ * @param[in]     thread_name TYPE: const char *
+ * @param[in]     function    TYPE: thread_loop_t
+ * @param[in]     priority    TYPE: thread_priority_t
+ * @param[in]     stack_size  TYPE: thread_stack_size_t
+ * @param[in]     parameters  TYPE: thread_parameters_t
+ ********************************************************************************
+ * @return  thread_function_t
+ ********************************************************************************
+ * @note    This function performs the same function as ConfigureThread, except
+ *          that the parameters pointer is passed to the loop function when the
+ *          thread is created. This allows one loop function to serve several
+ *          threads, each with its own context.
+ * @see     ConfigureThread
+ ********************************************************************************
+**/
+thread_function_t ConfigureThreadWithParameters(const char *thread_name,
+                                                thread_loop_t function,
+                                                thread_priority_t priority,
+                                                thread_stack_size_t stack_size,
+                                                thread_parameters_t parameters);
+
+/**
+ ********************************************************************************
+ * @brief   Assign Rate Monotonic Priorities to Thread Configurations
+ ********************************************************************************
+ * @param[inout]  threads   TYPE: thread_function_t *
+ * @param[in]     periods   TYPE: const thread_time_t *, in milliseconds
+ * @param[in]     count     TYPE: UBaseType_t
+ * @param[in]     highest   TYPE: thread_priority_t
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @note    The shortest period gets the highest priority and each longer period
+ *          the next level down, so threads share a level only when they share
+ *          a period. Returns THREAD_PRIORITY_EXHAUSTED, leaving every priority
+ *          unchanged, when there are more distinct periods than levels from
+ *          highest down to THREAD_PRIORITY_LOW, and THREAD_FUNCTION_INVALID
+ *          for an invalid configuration or highest. Keep highest below
+ *          THREAD_PRIORITY_MAX to leave room for the timer thread or threads
+ *          woken by interrupts.
+ ********************************************************************************
+**/
+thread_return_t ThreadRateMonotonic(thread_function_t *threads,
+                                    const thread_time_t *periods,
+                                    UBaseType_t count,
+                                    thread_priority_t highest);
+
 /**
  ********************************************************************************
  * @brief   Create a Thread
@@ -54,9 +108,34 @@ thread_function_t ConfigureThread(const char *thread_name,
  * @note    This function creates a thread and returns a handle to the thread.
  ********************************************************************************
 **/
-thread_return_t CreateThread(thread_handle_t *thread, 
+thread_return_t CreateThread(thread_handle_t *thread,
                              thread_function_t function);
 
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/**
+ ********************************************************************************
+ * @brief   Create a Thread in statically allocated memory
+ ********************************************************************************
+ * @param[out]    thread    TYPE: thread_handle_t *
+ * @param[in]     function  TYPE: thread_function_t
+ * @param[in]     memory    TYPE: thread_static_memory_t *
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @note    This function creates a thread on memory reserved with
+ *          THREAD_STATIC_MEMORY and returns a handle to the thread.
+ *          The reserved stack must be at least the configured stack size.
+ *          The memory must not be reused until the thread has been deleted.
+ *          On AVR this needs FreeRTOS_Wrapper_Hooks.h at the end of
+ *          FreeRTOSConfig.h with THREAD_STATIC_ALLOCATION_ENABLED set.
+ * @see     CreateThread
+ ********************************************************************************
+**/
+thread_return_t CreateStaticThread(thread_handle_t *thread,
+                                   thread_function_t function,
+                                   thread_static_memory_t *memory);
+#endif // configSUPPORT_STATIC_ALLOCATION
+
 /**
  ********************************************************************************
  * @brief   Delete a Thread object
@@ -94,6 +173,43 @@ thread_return_t ThreadDelay(thread_time_t delay_ms);
 thread_return_t ThreadDeltaDelay(thread_time_t reference_time, 
                                  thread_time_t delay_ms);
 
+/**
+ ********************************************************************************
+ * @brief   Initialize a periodic thread schedule
+ ********************************************************************************
+ * @param[out]    period     TYPE: thread_period_t *
+ * @param[in]     period_ms  TYPE: thread_time_t
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @note    The current tick is taken as the first wake time, so this should be
+ *          called by the periodic thread itself, just before its loop.
+ *          The period must be at least one tick long.
+ ********************************************************************************
+**/
+thread_return_t ThreadPeriodInit(thread_period_t *period,
+                                 thread_time_t period_ms);
+
+/**
+ ********************************************************************************
+ * @brief   Delay the current thread until its next period
+ ********************************************************************************
+ * @param[inout]  period  TYPE: thread_period_t *
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @note    The wake time is kept in the period struct and advanced by exactly
+ *          one period on every call, so the loop does not drift regardless of
+ *          how long each cycle takes.
+ *          If the cycle took longer than the period, the function returns
+ *          immediately with THREAD_PERIOD_OVERRUN, counts the overrun and
+ *          records the lateness in milliseconds if it is the worst so far.
+ *          A cycle ending exactly on the next wake time is not an overrun.
+ * @see     ThreadPeriodInit
+ ********************************************************************************
+**/
+thread_return_t ThreadPeriodWait(thread_period_t *period);
+
 /**
  ********************************************************************************
  * @brief   Start a thread
@@ -125,6 +241,38 @@ thread_return_t StopThread(thread_handle_t thread);
 **/
 thread_time_t ThreadTime();
 
+#if (THREAD_TIME_MICROS_ENABLED == 1)
+/**
+ ********************************************************************************
+ * @brief   Get the current time in microseconds
+ ********************************************************************************
+ * @return  uint32_t
+ ********************************************************************************
+ * @note    The time comes from the hardware timer of the microsecond clock
+ *          rather than the tick, so it resolves one microsecond and keeps
+ *          counting while the tick is stopped in idle. The timer counts half
+ *          microseconds at 16 MHz, but the result is in whole microseconds. The clock
+ *          starts with the scheduler. The count wraps after about 71 minutes,
+ *          so take differences of two readings as uint32_t.
+ ********************************************************************************
+**/
+uint32_t ThreadTimeMicros();
+
+/**
+ ********************************************************************************
+ * @brief   Get the current time in microseconds without wrapping
+ ********************************************************************************
+ * @return  uint64_t
+ ********************************************************************************
+ * @note    This function costs a 64-bit multiply more than ThreadTimeMicros.
+ *          Without the timer, on the board or the host, the wraps of micros()
+ *          are counted between readings, so read it at least once every 71
+ *          minutes.
+ ********************************************************************************
+**/
+uint64_t ThreadTimeMicros64();
+#endif // THREAD_TIME_MICROS_ENABLED
+
 /**
  ********************************************************************************
  * @brief   Enter a critical section
@@ -236,6 +384,93 @@ thread_return_t ThreadNoticeQueryIndex(thread_handle_t *thread,
                                        thread_notice_value_t *previous_value, 
                                        thread_notice_index_t index);
 
+/**
+ ********************************************************************************
+ * @brief   Set a notice on a thread from an interrupt
+ ********************************************************************************
+ * @param[in]     thread  TYPE: thread_handle_t *
+ * @param[in]     action  TYPE: thread_notice_give_action_t
+ * @param[in]     value   TYPE: thread_notice_value_t
+ * @param[inout]  yield   TYPE: thread_isr_yield_t *
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @note    yield is set when the notice woke a thread of higher priority than
+ *          the interrupted one, for ThreadYieldFromISR at the end of the
+ *          interrupt. It may be NULL.
+ * @see     ThreadNotice
+ ********************************************************************************
+**/
+thread_return_t ThreadNoticeFromISR(thread_handle_t *thread,
+                                    thread_notice_give_action_t action,
+                                    thread_notice_value_t value,
+                                    thread_isr_yield_t *yield);
+
+/**
+ ********************************************************************************
+ * @brief   Set a notice on a thread at a specific index from an interrupt
+ ********************************************************************************
+ * @param[in]     thread  TYPE: thread_handle_t *
+ * @param[in]     action  TYPE: thread_notice_give_action_t
+ * @param[in]     value   TYPE: thread_notice_value_t
+ * @param[in]     index   TYPE: thread_notice_index_t
+ * @param[inout]  yield   TYPE: thread_isr_yield_t *
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @see     ThreadNoticeFromISR
+ ********************************************************************************
+**/
+thread_return_t ThreadNoticeIndexFromISR(thread_handle_t *thread,
+                                         thread_notice_give_action_t action,
+                                         thread_notice_value_t value,
+                                         thread_notice_index_t index,
+                                         thread_isr_yield_t *yield);
+
+/**
+ ********************************************************************************
+ * @brief   Query and notice on a thread from an interrupt
+ ********************************************************************************
+ * @param[in]     thread          TYPE: thread_handle_t *
+ * @param[in]     action          TYPE: thread_notice_give_action_t
+ * @param[in]     value           TYPE: thread_notice_value_t
+ * @param[out]    previous_value  TYPE: thread_notice_value_t *
+ * @param[inout]  yield           TYPE: thread_isr_yield_t *
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @see     ThreadNoticeQuery, ThreadNoticeFromISR
+ ********************************************************************************
+**/
+thread_return_t ThreadNoticeQueryFromISR(thread_handle_t *thread,
+                                         thread_notice_give_action_t action,
+                                         thread_notice_value_t value,
+                                         thread_notice_value_t *previous_value,
+                                         thread_isr_yield_t *yield);
+
+/**
+ ********************************************************************************
+ * @brief   Query and notice on a thread at a specific index from an interrupt
+ ********************************************************************************
+ * @param[in]     thread          TYPE: thread_handle_t *
+ * @param[in]     action          TYPE: thread_notice_give_action_t
+ * @param[in]     value           TYPE: thread_notice_value_t
+ * @param[out]    previous_value  TYPE: thread_notice_value_t *
+ * @param[in]     index           TYPE: thread_notice_index_t
+ * @param[inout]  yield           TYPE: thread_isr_yield_t *
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @see     ThreadNoticeQuery, ThreadNoticeFromISR
+ ********************************************************************************
+**/
+thread_return_t ThreadNoticeQueryIndexFromISR(thread_handle_t *thread,
+                                              thread_notice_give_action_t action,
+                                              thread_notice_value_t value,
+                                              thread_notice_value_t *previous_value,
+                                              thread_notice_index_t index,
+                                              thread_isr_yield_t *yield);
+
 /**
  ********************************************************************************
  * @brief   Wait for a notice on a thread
@@ -314,6 +549,41 @@ thread_return_t ThreadNoticeGive(thread_handle_t *thread);
 thread_return_t ThreadNoticeGiveIndex(thread_handle_t *thread, 
                                       thread_notice_index_t index);
 
+/**
+ ********************************************************************************
+ * @brief   Give a notice to a thread from an interrupt
+ ********************************************************************************
+ * @param[in]     thread  TYPE: thread_handle_t *
+ * @param[inout]  yield   TYPE: thread_isr_yield_t *
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @note    This is the cheapest way for an interrupt to wake a thread. Defer
+ *          the work of the interrupt to the thread, which waits with
+ *          ThreadNoticeTake, and end the interrupt with ThreadYieldFromISR.
+ * @see     ThreadNoticeGive, ThreadNoticeFromISR
+ ********************************************************************************
+**/
+thread_return_t ThreadNoticeGiveFromISR(thread_handle_t *thread,
+                                        thread_isr_yield_t *yield);
+
+/**
+ ********************************************************************************
+ * @brief   Give a notice to a thread at a specific index from an interrupt
+ ********************************************************************************
+ * @param[in]     thread  TYPE: thread_handle_t *
+ * @param[in]     index   TYPE: thread_notice_index_t
+ * @param[inout]  yield   TYPE: thread_isr_yield_t *
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @see     ThreadNoticeGiveFromISR
+ ********************************************************************************
+**/
+thread_return_t ThreadNoticeGiveIndexFromISR(thread_handle_t *thread,
+                                             thread_notice_index_t index,
+                                             thread_isr_yield_t *yield);
+
 /**
  ********************************************************************************
  * @brief   Take a notice from a thread
@@ -426,6 +696,13 @@ void StartThreadScheduler();
  *******************************************************************************
  * @brief   Stop the Thread Scheduler
  *******************************************************************************
+ * @note    Execution resumes after the StartThreadScheduler call, with the
+ *          threads left in place for DeleteThread. The AVR port cannot end
+ *          the scheduler, so there the wrapper stops the watchdog tick and
+ *          jumps back by itself. The kernel is left as it stood, so reset
+ *          the MCU before starting the scheduler again, as the test runner
+ *          does before each test. Call it from a thread only.
+ *******************************************************************************
 **/
 void StopThreadScheduler();
 
@@ -452,6 +729,52 @@ void ResumeThreadScheduler();
 **/
 thread_handle_t GetSelfThreadHandle();
 
+/**
+ *******************************************************************************
+ * @brief   Switch to a thread woken by an interrupt
+ *******************************************************************************
+ * @param[in]     yield  TYPE: thread_isr_yield_t
+ *******************************************************************************
+ * @note    Call as the last statement of an interrupt with the flag that its
+ *          FromISR calls have set. If one of them woke a thread of higher
+ *          priority than the interrupted one, the interrupt returns into that
+ *          thread instead of waiting for the next tick.
+ *
+ *              thread_isr_yield_t yield = THREAD_ISR_YIELD_INIT;
+ *              SemaphoreGiveFromISR(&adc_ready, &yield);
+ *              ThreadYieldFromISR(yield);
+ *******************************************************************************
+**/
+void ThreadYieldFromISR(thread_isr_yield_t yield);
+
+/**
+ *******************************************************************************
+ * @brief   Convert a FreeRTOS return value to a wrapper return value
+ *******************************************************************************
+ * @param[in]     return_in  TYPE: BaseType_t
+ *******************************************************************************
+ * @return  thread_return_t
+ *******************************************************************************
+**/
+thread_return_t ThreadAssert(BaseType_t return_in);
+
+/**
+ *******************************************************************************
+ * @brief   Convert a FreeRTOS queue return value to a wrapper return value
+ *******************************************************************************
+ * @param[in]     return_in  TYPE: BaseType_t
+ * @param[in]     failure    TYPE: thread_return_t, returned for a full or
+ *                           empty queue
+ *******************************************************************************
+ * @return  thread_return_t
+ *******************************************************************************
+ * @note    Shared by the queue, semaphore, event group, timer and buffer
+ *          wrappers, whose kernel calls report a timeout as errQUEUE_FULL or
+ *          errQUEUE_EMPTY.
+ *******************************************************************************
+**/
+thread_return_t QueueAssert(BaseType_t return_in, thread_return_t failure);
+
 #ifdef __cplusplus
   }
 #endif // __cplusplus
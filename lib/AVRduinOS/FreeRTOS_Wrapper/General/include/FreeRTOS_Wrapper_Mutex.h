@@ -0,0 +1,188 @@
+/**
+ ********************************************************************************
+ * @file    FreeRTOS_Wrapper_Mutex.h
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Mutex Wrappers for FreeRTOS
+ * @version 1.0
+ * @date    2024-03-18
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+ * @note    Unlike EnterThreadCritical, a mutex leaves interrupts and the
+ *          scheduler running. A thread that blocks on a mutex lends its
+ *          priority to the holder until the mutex is unlocked, so a low
+ *          priority holder cannot be starved by medium priority threads.
+ ********************************************************************************
+**/
+
+#include <Arduino_FreeRTOS.h>
+#include <semphr.h>
+
+#include "FreeRTOS_Wrapper_Configuration.h"
+#include "FreeRTOS_Wrapper_Types.h"
+
+#ifndef __FREERTOS_WRAPPER_MUTEX_H__
+#define __FREERTOS_WRAPPER_MUTEX_H__
+
+#ifdef __cplusplus
+  extern "C" {
+#endif // __cplusplus
+
+/**
+ ********************************************************************************
+ * @brief   Create a Mutex
+ ********************************************************************************
+ * @param[out]    mutex  TYPE: thread_mutex_t *
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @note    A mutex may only be unlocked by the thread that locked it and must
+ *          not be used from interrupts. The mutex must start out as
+ *          THREAD_MUTEX_INIT or deleted, creating it again while it exists
+ *          returns THREAD_HANDLE_INVALID.
+ ********************************************************************************
+**/
+thread_return_t CreateMutex(thread_mutex_t *mutex);
+
+#if (configUSE_RECURSIVE_MUTEXES == 1)
+/**
+ ********************************************************************************
+ * @brief   Create a Recursive Mutex
+ ********************************************************************************
+ * @param[out]    mutex  TYPE: thread_mutex_t *
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @note    The holder may lock a recursive mutex again. It is released once
+ *          it has been unlocked as many times as it was locked.
+ ********************************************************************************
+**/
+thread_return_t CreateRecursiveMutex(thread_mutex_t *mutex);
+#endif // configUSE_RECURSIVE_MUTEXES
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/**
+ ********************************************************************************
+ * @brief   Create a Mutex in statically allocated memory
+ ********************************************************************************
+ * @param[out]    mutex   TYPE: thread_mutex_t *
+ * @param[in]     memory  TYPE: thread_mutex_static_memory_t *
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @note    The control block is reserved with THREAD_MUTEX_STATIC_MEMORY.
+ * @see     CreateMutex
+ ********************************************************************************
+**/
+thread_return_t CreateStaticMutex(thread_mutex_t *mutex,
+                                  thread_mutex_static_memory_t *memory);
+
+#if (configUSE_RECURSIVE_MUTEXES == 1)
+/**
+ ********************************************************************************
+ * @brief   Create a Recursive Mutex in statically allocated memory
+ ********************************************************************************
+ * @param[out]    mutex   TYPE: thread_mutex_t *
+ * @param[in]     memory  TYPE: thread_mutex_static_memory_t *
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @see     CreateRecursiveMutex
+ ********************************************************************************
+**/
+thread_return_t CreateStaticRecursiveMutex(thread_mutex_t *mutex,
+                                           thread_mutex_static_memory_t *memory);
+#endif // configUSE_RECURSIVE_MUTEXES
+#endif // configSUPPORT_STATIC_ALLOCATION
+
+/**
+ ********************************************************************************
+ * @brief   Delete a Mutex
+ ********************************************************************************
+ * @param[inout]  mutex  TYPE: thread_mutex_t *
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @note    This function deletes a mutex and nullifies the handle. A mutex
+ *          must not be deleted while it is locked.
+ ********************************************************************************
+**/
+thread_return_t DeleteMutex(thread_mutex_t *mutex);
+
+/**
+ ********************************************************************************
+ * @brief   Lock a Mutex
+ ********************************************************************************
+ * @param[in]     mutex     TYPE: thread_mutex_t *
+ * @param[in]     max_wait  TYPE: thread_time_t
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @note    Returns THREAD_MUTEX_TIMEOUT if the mutex was not unlocked within
+ *          the maximum wait.
+ ********************************************************************************
+**/
+thread_return_t MutexLock(thread_mutex_t *mutex,
+                          thread_time_t max_wait);
+
+/**
+ ********************************************************************************
+ * @brief   Unlock a Mutex
+ ********************************************************************************
+ * @param[in]     mutex  TYPE: thread_mutex_t *
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @note    Returns THREAD_MUTEX_NOT_HOLDER if the calling thread does not hold
+ *          the mutex.
+ ********************************************************************************
+**/
+thread_return_t MutexUnlock(thread_mutex_t *mutex);
+
+/**
+ ********************************************************************************
+ * @brief   Get the Thread holding a Mutex
+ ********************************************************************************
+ * @param[in]     mutex  TYPE: thread_mutex_t *
+ ********************************************************************************
+ * @return  thread_handle_t, NULL if the mutex is unlocked or invalid
+ ********************************************************************************
+**/
+thread_handle_t MutexHolder(thread_mutex_t *mutex);
+
+#if (THREAD_MUTEX_STATS_ENABLED == 1)
+/**
+ ********************************************************************************
+ * @brief   Get the Statistics of a Mutex
+ ********************************************************************************
+ * @param[in]     mutex  TYPE: thread_mutex_t *
+ * @param[out]    stats  TYPE: thread_mutex_stats_t *
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @note    A contention is a lock that had to wait, an inversion a contention
+ *          where the holder ran below the waiting thread's priority and so
+ *          inherited it. Times are in microseconds; a recursive mutex is held
+ *          from its first lock to its last unlock.
+ ********************************************************************************
+**/
+thread_return_t MutexStatsGet(thread_mutex_t *mutex,
+                              thread_mutex_stats_t *stats);
+
+/**
+ ********************************************************************************
+ * @brief   Clear the Statistics of a Mutex
+ ********************************************************************************
+ * @param[in]     mutex  TYPE: thread_mutex_t *
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+**/
+thread_return_t MutexStatsClear(thread_mutex_t *mutex);
+#endif // THREAD_MUTEX_STATS_ENABLED
+
+#ifdef __cplusplus
+  }
+#endif // __cplusplus
+
+#endif // __FREERTOS_WRAPPER_MUTEX_H__
\ No newline at end of file
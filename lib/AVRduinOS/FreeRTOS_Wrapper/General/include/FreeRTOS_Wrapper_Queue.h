@@ -0,0 +1,273 @@
+/**
+ ********************************************************************************
+ * @file    FreeRTOS_Wrapper_Queue.h
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Queue Wrappers for FreeRTOS
+ * @version 1.0
+ * @date    2024-03-18
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#include <Arduino_FreeRTOS.h>
+#include <queue.h>
+
+#include "FreeRTOS_Wrapper_Types.h"
+
+#ifndef __FREERTOS_WRAPPER_QUEUE_H__
+#define __FREERTOS_WRAPPER_QUEUE_H__
+
+#ifdef __cplusplus
+  extern "C" {
+#endif // __cplusplus
+
+/**
+ ********************************************************************************
+ * @brief   Create a Queue
+ ********************************************************************************
+ * @param[out]    queue       TYPE: thread_queue_handle_t *
+ * @param[in]     length      TYPE: thread_queue_length_t
+ * @param[in]     item_size   TYPE: thread_queue_item_size_t
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @note    This function creates a queue that holds up to length items, each
+ *          copied in and out by value. It is intended for small items; larger
+ *          items should be passed through a zero-copy queue.
+ ********************************************************************************
+**/
+thread_return_t CreateQueue(thread_queue_handle_t *queue,
+                            thread_queue_length_t length,
+                            thread_queue_item_size_t item_size);
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/**
+ ********************************************************************************
+ * @brief   Create a Queue in statically allocated memory
+ ********************************************************************************
+ * @param[out]    queue   TYPE: thread_queue_handle_t *
+ * @param[in]     memory  TYPE: thread_queue_static_memory_t *
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @note    The length and item size are taken from memory reserved with
+ *          THREAD_QUEUE_STATIC_MEMORY.
+ * @see     CreateQueue
+ ********************************************************************************
+**/
+thread_return_t CreateStaticQueue(thread_queue_handle_t *queue,
+                                  thread_queue_static_memory_t *memory);
+#endif // configSUPPORT_STATIC_ALLOCATION
+
+/**
+ ********************************************************************************
+ * @brief   Delete a Queue
+ ********************************************************************************
+ * @param[inout]  queue  TYPE: thread_queue_handle_t *
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @note    This function deletes a queue and nullifies the handle.
+ ********************************************************************************
+**/
+thread_return_t DeleteQueue(thread_queue_handle_t *queue);
+
+/**
+ ********************************************************************************
+ * @brief   Copy an item to the back of a Queue
+ ********************************************************************************
+ * @param[in]     queue     TYPE: thread_queue_handle_t *
+ * @param[in]     item      TYPE: const void *
+ * @param[in]     max_wait  TYPE: thread_time_t
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @note    Returns THREAD_QUEUE_FULL if no space became available within the
+ *          maximum wait.
+ ********************************************************************************
+**/
+thread_return_t QueueSend(thread_queue_handle_t *queue,
+                          const void *item,
+                          thread_time_t max_wait);
+
+/**
+ ********************************************************************************
+ * @brief   Copy an item to the front of a Queue
+ ********************************************************************************
+ * @param[in]     queue     TYPE: thread_queue_handle_t *
+ * @param[in]     item      TYPE: const void *
+ * @param[in]     max_wait  TYPE: thread_time_t
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @see     QueueSend
+ ********************************************************************************
+**/
+thread_return_t QueueSendFront(thread_queue_handle_t *queue,
+                               const void *item,
+                               thread_time_t max_wait);
+
+/**
+ ********************************************************************************
+ * @brief   Copy an item out of a Queue and remove it
+ ********************************************************************************
+ * @param[in]     queue     TYPE: thread_queue_handle_t *
+ * @param[out]    item      TYPE: void *
+ * @param[in]     max_wait  TYPE: thread_time_t
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @note    Returns THREAD_QUEUE_EMPTY if no item arrived within the maximum
+ *          wait.
+ ********************************************************************************
+**/
+thread_return_t QueueReceive(thread_queue_handle_t *queue,
+                             void *item,
+                             thread_time_t max_wait);
+
+/**
+ ********************************************************************************
+ * @brief   Copy an item out of a Queue without removing it
+ ********************************************************************************
+ * @param[in]     queue     TYPE: thread_queue_handle_t *
+ * @param[out]    item      TYPE: void *
+ * @param[in]     max_wait  TYPE: thread_time_t
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @see     QueueReceive
+ ********************************************************************************
+**/
+thread_return_t QueuePeek(thread_queue_handle_t *queue,
+                          void *item,
+                          thread_time_t max_wait);
+
+/**
+ ********************************************************************************
+ * @brief   Get the number of items waiting in a Queue
+ ********************************************************************************
+ * @param[in]     queue  TYPE: thread_queue_handle_t *
+ ********************************************************************************
+ * @return  thread_queue_length_t
+ ********************************************************************************
+ * @note    Returns 0 for an invalid queue.
+ ********************************************************************************
+**/
+thread_queue_length_t QueueCount(thread_queue_handle_t *queue);
+
+/**
+ ********************************************************************************
+ * @brief   Create a Zero-Copy Queue
+ ********************************************************************************
+ * @param[out]    queue       TYPE: thread_zero_copy_queue_t *
+ * @param[in]     length      TYPE: thread_queue_length_t
+ * @param[in]     block_size  TYPE: thread_queue_item_size_t
+ * @param[in]     storage     TYPE: void *
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @note    A zero-copy queue passes pointers to blocks from a fixed pool
+ *          instead of copying items. The pool is carved out of storage, which
+ *          must be reserved with THREAD_QUEUE_BLOCK_STORAGE using the same
+ *          block size and length. The storage also holds a bitmap of the
+ *          blocks handed out, which lets release catch double releases.
+ *          A producer acquires a free block, fills it and sends it; the
+ *          consumer receives the block, uses it and releases it to the pool.
+ *          The queue must start out as THREAD_ZERO_COPY_QUEUE_INIT or deleted,
+ *          creating it again while it exists returns THREAD_HANDLE_INVALID.
+ ********************************************************************************
+**/
+thread_return_t CreateZeroCopyQueue(thread_zero_copy_queue_t *queue,
+                                    thread_queue_length_t length,
+                                    thread_queue_item_size_t block_size,
+                                    void *storage);
+
+/**
+ ********************************************************************************
+ * @brief   Delete a Zero-Copy Queue
+ ********************************************************************************
+ * @param[inout]  queue  TYPE: thread_zero_copy_queue_t *
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @note    The block storage is not freed, it belongs to the caller.
+ ********************************************************************************
+**/
+thread_return_t DeleteZeroCopyQueue(thread_zero_copy_queue_t *queue);
+
+/**
+ ********************************************************************************
+ * @brief   Take a free block from a Zero-Copy Queue's pool
+ ********************************************************************************
+ * @param[in]     queue     TYPE: thread_zero_copy_queue_t *
+ * @param[out]    block     TYPE: void **
+ * @param[in]     max_wait  TYPE: thread_time_t
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @note    Returns THREAD_QUEUE_EMPTY if no block was released within the
+ *          maximum wait.
+ ********************************************************************************
+**/
+thread_return_t QueueAcquireBlock(thread_zero_copy_queue_t *queue,
+                                  void **block,
+                                  thread_time_t max_wait);
+
+/**
+ ********************************************************************************
+ * @brief   Send a filled block through a Zero-Copy Queue
+ ********************************************************************************
+ * @param[in]     queue     TYPE: thread_zero_copy_queue_t *
+ * @param[in]     block     TYPE: void *
+ * @param[in]     max_wait  TYPE: thread_time_t
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @note    Only the pointer is copied. The sender must not touch the block
+ *          after a successful send.
+ ********************************************************************************
+**/
+thread_return_t QueueSendBlock(thread_zero_copy_queue_t *queue,
+                               void *block,
+                               thread_time_t max_wait);
+
+/**
+ ********************************************************************************
+ * @brief   Receive a filled block from a Zero-Copy Queue
+ ********************************************************************************
+ * @param[in]     queue     TYPE: thread_zero_copy_queue_t *
+ * @param[out]    block     TYPE: void **
+ * @param[in]     max_wait  TYPE: thread_time_t
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @note    The receiver owns the block until it is released.
+ ********************************************************************************
+**/
+thread_return_t QueueReceiveBlock(thread_zero_copy_queue_t *queue,
+                                  void **block,
+                                  thread_time_t max_wait);
+
+/**
+ ********************************************************************************
+ * @brief   Return a block to a Zero-Copy Queue's pool
+ ********************************************************************************
+ * @param[in]     queue  TYPE: thread_zero_copy_queue_t *
+ * @param[in]     block  TYPE: void *
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @note    Returns THREAD_MEMORY_INVALID for a pointer that is not a block of
+ *          the pool, or for a block that was not acquired since it was last
+ *          released.
+ ********************************************************************************
+**/
+thread_return_t QueueReleaseBlock(thread_zero_copy_queue_t *queue,
+                                  void *block);
+
+#ifdef __cplusplus
+  }
+#endif // __cplusplus
+
+#endif // __FREERTOS_WRAPPER_QUEUE_H__
\ No newline at end of file
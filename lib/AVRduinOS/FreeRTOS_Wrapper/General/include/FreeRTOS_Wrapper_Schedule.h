@@ -0,0 +1,99 @@
+/**
+ ********************************************************************************
+ * @file    FreeRTOS_Wrapper_Schedule.h
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Schedulability Analysis for FreeRTOS
+ * @version 1.0
+ * @date    2024-03-18
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+ * @note    A schedule table pairs each thread configuration with its period,
+ *          deadline and worst case execution time (WCET):
+ *
+ *              thread_schedule_t schedule[] = {
+ *                  {&control_config, 20, 0, 4000},
+ *                  {&logger_config, 200, 0, 30000},
+ *              };
+ *
+ *          ThreadScheduleAnalyze checks the table at boot, before the threads
+ *          are created. With THREAD_STATS_ENABLED each periodic thread can then
+ *          wrap its cycle in ThreadScheduleBegin and ThreadScheduleEnd to
+ *          compare the CPU time it really takes with the declared WCET.
+ ********************************************************************************
+**/
+
+#include <Arduino_FreeRTOS.h>
+
+#include "FreeRTOS_Wrapper_Configuration.h"
+#include "FreeRTOS_Wrapper_Types.h"
+
+#ifndef __FREERTOS_WRAPPER_SCHEDULE_H__
+#define __FREERTOS_WRAPPER_SCHEDULE_H__
+
+#ifdef __cplusplus
+  extern "C" {
+#endif // __cplusplus
+
+/**
+ ********************************************************************************
+ * @brief   Analyze whether a Table of Periodic Threads is Schedulable
+ ********************************************************************************
+ * @param[inout]  schedule  TYPE: thread_schedule_t *
+ * @param[in]     count     TYPE: UBaseType_t
+ * @param[out]    report    TYPE: thread_schedule_report_t *
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @note    Utilization and the Liu-Layland bound are reported in tenths of a
+ *          percent. Passing the bound is enough for the set to be schedulable
+ *          under rate monotonic priorities, failing it is not proof of the
+ *          opposite. The response time analysis is exact for fixed priorities
+ *          and fills in response_us of every entry, counting threads of equal
+ *          priority as interference both ways. Returns
+ *          THREAD_SCHEDULE_OVERLOAD when any response exceeds its deadline,
+ *          first_miss being that entry, or count when none does. A deadline of
+ *          0 is the period. Interrupts and the tick are not counted, so keep
+ *          some margin below the deadlines.
+ ********************************************************************************
+**/
+thread_return_t ThreadScheduleAnalyze(thread_schedule_t *schedule,
+                                      UBaseType_t count,
+                                      thread_schedule_report_t *report);
+
+#if (THREAD_STATS_ENABLED == 1)
+
+/**
+ ********************************************************************************
+ * @brief   Mark the Start of a Cycle of a Periodic Thread
+ ********************************************************************************
+ * @param[inout]  entry   TYPE: thread_schedule_t *
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+**/
+thread_return_t ThreadScheduleBegin(thread_schedule_t *entry);
+
+/**
+ ********************************************************************************
+ * @brief   Mark the End of a Cycle of a Periodic Thread
+ ********************************************************************************
+ * @param[inout]  entry   TYPE: thread_schedule_t *
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @note    The CPU time since ThreadScheduleBegin, without the time the thread
+ *          was preempted, is kept as exec_last_us and exec_max_us. Returns
+ *          THREAD_SCHEDULE_WCET_OVERRUN and counts wcet_overruns when it is
+ *          above the declared WCET, which voids the analysis.
+ ********************************************************************************
+**/
+thread_return_t ThreadScheduleEnd(thread_schedule_t *entry);
+
+#endif // THREAD_STATS_ENABLED
+
+#ifdef __cplusplus
+  }
+#endif // __cplusplus
+
+#endif // __FREERTOS_WRAPPER_SCHEDULE_H__
\ No newline at end of file
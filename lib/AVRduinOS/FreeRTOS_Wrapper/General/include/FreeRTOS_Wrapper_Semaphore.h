@@ -0,0 +1,193 @@
+/**
+ ********************************************************************************
+ * @file    FreeRTOS_Wrapper_Semaphore.h
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Semaphore Wrappers for FreeRTOS
+ * @version 1.0
+ * @date    2024-03-18
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+ * @note    A semaphore is not tied to a thread the way a notice is. Any number
+ *          of threads and interrupts may give it and any number of threads
+ *          may wait on it, the highest priority waiter being woken first.
+ ********************************************************************************
+**/
+
+#include <Arduino_FreeRTOS.h>
+#include <semphr.h>
+
+#include "FreeRTOS_Wrapper_Types.h"
+
+#ifndef __FREERTOS_WRAPPER_SEMAPHORE_H__
+#define __FREERTOS_WRAPPER_SEMAPHORE_H__
+
+#ifdef __cplusplus
+  extern "C" {
+#endif // __cplusplus
+
+/**
+ ********************************************************************************
+ * @brief   Create a Binary Semaphore
+ ********************************************************************************
+ * @param[out]    semaphore  TYPE: thread_semaphore_handle_t *
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @note    The semaphore starts out taken. Gives while it is already given
+ *          are lost, so it signals that an event happened, not how often.
+ ********************************************************************************
+**/
+thread_return_t CreateBinarySemaphore(thread_semaphore_handle_t *semaphore);
+
+/**
+ ********************************************************************************
+ * @brief   Create a Counting Semaphore
+ ********************************************************************************
+ * @param[out]    semaphore      TYPE: thread_semaphore_handle_t *
+ * @param[in]     max_count      TYPE: thread_semaphore_count_t
+ * @param[in]     initial_count  TYPE: thread_semaphore_count_t
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @note    Returns THREAD_SEMAPHORE_INVALID if max_count is 0 or below
+ *          initial_count.
+ ********************************************************************************
+**/
+thread_return_t CreateCountingSemaphore(thread_semaphore_handle_t *semaphore,
+                                        thread_semaphore_count_t max_count,
+                                        thread_semaphore_count_t initial_count);
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/**
+ ********************************************************************************
+ * @brief   Create a Binary Semaphore in statically allocated memory
+ ********************************************************************************
+ * @param[out]    semaphore  TYPE: thread_semaphore_handle_t *
+ * @param[in]     memory     TYPE: thread_semaphore_static_memory_t *
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @note    The control block is reserved with THREAD_SEMAPHORE_STATIC_MEMORY.
+ * @see     CreateBinarySemaphore
+ ********************************************************************************
+**/
+thread_return_t CreateStaticBinarySemaphore(thread_semaphore_handle_t *semaphore,
+                                            thread_semaphore_static_memory_t *memory);
+
+/**
+ ********************************************************************************
+ * @brief   Create a Counting Semaphore in statically allocated memory
+ ********************************************************************************
+ * @param[out]    semaphore      TYPE: thread_semaphore_handle_t *
+ * @param[in]     max_count      TYPE: thread_semaphore_count_t
+ * @param[in]     initial_count  TYPE: thread_semaphore_count_t
+ * @param[in]     memory         TYPE: thread_semaphore_static_memory_t *
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @see     CreateCountingSemaphore
+ ********************************************************************************
+**/
+thread_return_t CreateStaticCountingSemaphore(thread_semaphore_handle_t *semaphore,
+                                              thread_semaphore_count_t max_count,
+                                              thread_semaphore_count_t initial_count,
+                                              thread_semaphore_static_memory_t *memory);
+#endif // configSUPPORT_STATIC_ALLOCATION
+
+/**
+ ********************************************************************************
+ * @brief   Delete a Semaphore
+ ********************************************************************************
+ * @param[inout]  semaphore  TYPE: thread_semaphore_handle_t *
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @note    This function deletes a semaphore and nullifies the handle. No
+ *          thread may be waiting on it.
+ ********************************************************************************
+**/
+thread_return_t DeleteSemaphore(thread_semaphore_handle_t *semaphore);
+
+/**
+ ********************************************************************************
+ * @brief   Give a Semaphore
+ ********************************************************************************
+ * @param[in]     semaphore  TYPE: thread_semaphore_handle_t *
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @note    Returns THREAD_SEMAPHORE_FULL if the count is already at its
+ *          maximum, or a binary semaphore is already given.
+ ********************************************************************************
+**/
+thread_return_t SemaphoreGive(thread_semaphore_handle_t *semaphore);
+
+/**
+ ********************************************************************************
+ * @brief   Take a Semaphore
+ ********************************************************************************
+ * @param[in]     semaphore  TYPE: thread_semaphore_handle_t *
+ * @param[in]     max_wait   TYPE: thread_time_t
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @note    Returns THREAD_SEMAPHORE_TIMEOUT if the semaphore was not given
+ *          within the maximum wait.
+ ********************************************************************************
+**/
+thread_return_t SemaphoreTake(thread_semaphore_handle_t *semaphore,
+                              thread_time_t max_wait);
+
+/**
+ ********************************************************************************
+ * @brief   Give a Semaphore from an Interrupt
+ ********************************************************************************
+ * @param[in]     semaphore  TYPE: thread_semaphore_handle_t *
+ * @param[inout]  yield      TYPE: thread_isr_yield_t *
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @note    yield is set when the give woke a thread of higher priority than
+ *          the interrupted one and is left alone otherwise, so one flag can
+ *          collect every FromISR call of an interrupt for ThreadYieldFromISR.
+ *          When yield is NULL the switch waits for the next tick.
+ * @see     SemaphoreGive
+ ********************************************************************************
+**/
+thread_return_t SemaphoreGiveFromISR(thread_semaphore_handle_t *semaphore,
+                                     thread_isr_yield_t *yield);
+
+/**
+ ********************************************************************************
+ * @brief   Take a Semaphore from an Interrupt without waiting
+ ********************************************************************************
+ * @param[in]     semaphore  TYPE: thread_semaphore_handle_t *
+ * @param[inout]  yield      TYPE: thread_isr_yield_t *
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @see     SemaphoreGiveFromISR
+ ********************************************************************************
+**/
+thread_return_t SemaphoreTakeFromISR(thread_semaphore_handle_t *semaphore,
+                                     thread_isr_yield_t *yield);
+
+/**
+ ********************************************************************************
+ * @brief   Get the Count of a Semaphore
+ ********************************************************************************
+ * @param[in]     semaphore  TYPE: thread_semaphore_handle_t *
+ ********************************************************************************
+ * @return  thread_semaphore_count_t
+ ********************************************************************************
+ * @note    Returns 0 for an invalid semaphore, and 1 for a given binary one.
+ ********************************************************************************
+**/
+thread_semaphore_count_t SemaphoreCount(thread_semaphore_handle_t *semaphore);
+
+#ifdef __cplusplus
+  }
+#endif // __cplusplus
+
+#endif // __FREERTOS_WRAPPER_SEMAPHORE_H__
\ No newline at end of file
@@ -0,0 +1,112 @@
+/**
+ ********************************************************************************
+ * @file    FreeRTOS_Wrapper_Stack.h
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Stack Monitor Wrappers for FreeRTOS
+ * @version 1.0
+ * @date    2024-03-18
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#include <Arduino_FreeRTOS.h>
+
+#include "FreeRTOS_Wrapper_Configuration.h"
+#include "FreeRTOS_Wrapper_Types.h"
+
+#ifndef __FREERTOS_WRAPPER_STACK_H__
+#define __FREERTOS_WRAPPER_STACK_H__
+
+#ifdef __cplusplus
+  extern "C" {
+#endif // __cplusplus
+
+#if (THREAD_STACK_MONITOR_THREADS > 0)
+
+/**
+ ********************************************************************************
+ * @brief   Report the Stack Use of every registered Thread
+ ********************************************************************************
+ * @param[out]    reports   TYPE: thread_stack_report_t *
+ * @param[inout]  count     TYPE: UBaseType_t *
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @note    On entry count holds the length of reports, on return the number of
+ *          entries filled in. The high water mark is the fewest stack words
+ *          that have ever been free; a value near zero means the thread is
+ *          about to overflow. The stack of each thread is scanned, so this
+ *          takes longer the larger the stacks are.
+ ********************************************************************************
+**/
+thread_return_t ThreadStackReport(thread_stack_report_t *reports, UBaseType_t *count);
+
+/**
+ ********************************************************************************
+ * @brief   Suggest a Stack Size from the deepest Stack Use seen
+ ********************************************************************************
+ * @param[in]     stack_size        TYPE: configSTACK_DEPTH_TYPE
+ * @param[in]     high_water_mark   TYPE: configSTACK_DEPTH_TYPE
+ ********************************************************************************
+ * @return  configSTACK_DEPTH_TYPE
+ ********************************************************************************
+ * @note    The suggestion is the words used plus an eighth, plus
+ *          THREAD_STACK_MARGIN, rounded up to a multiple of 8. It is only as
+ *          good as the run that produced the high water mark, so take it after
+ *          every path of the thread has been exercised.
+ ********************************************************************************
+**/
+configSTACK_DEPTH_TYPE ThreadStackSuggestSize(configSTACK_DEPTH_TYPE stack_size,
+                                              configSTACK_DEPTH_TYPE high_water_mark);
+
+/**
+ ********************************************************************************
+ * @brief   Thread Function that reports the Stack Use periodically
+ ********************************************************************************
+ * @param[in]     params  TYPE: thread_stack_monitor_t *
+ ********************************************************************************
+ * @note    Pass a thread_stack_monitor_t that outlives the thread through
+ *          ConfigureThreadWithParameters. Its report callback runs on the
+ *          monitor thread every period_ms with the reports of every registered
+ *          thread. The monitor needs THREAD_STACK_MONITOR_THREADS reports of
+ *          stack on top of what the callback uses.
+ ********************************************************************************
+**/
+void ThreadStackMonitor(void *params);
+
+/**
+ ********************************************************************************
+ * @brief   Register a Thread with the Stack Monitor
+ ********************************************************************************
+ * @param[in]     thread      TYPE: thread_handle_t
+ * @param[in]     stack_size  TYPE: configSTACK_DEPTH_TYPE
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @note    Called by CreateThread and CreateStaticThread with the scheduler
+ *          suspended. THREAD_MEMORY_INVALID is returned when the registry is
+ *          full; the thread still runs but is not reported.
+ ********************************************************************************
+**/
+thread_return_t ThreadStackRegister(thread_handle_t thread, configSTACK_DEPTH_TYPE stack_size);
+
+/**
+ ********************************************************************************
+ * @brief   Remove a Thread from the Stack Monitor
+ ********************************************************************************
+ * @param[in]     thread  TYPE: thread_handle_t
+ ********************************************************************************
+ * @note    Called from traceTASK_DELETE, so a thread is removed however it
+ *          is deleted, vTaskDelete(NULL) included.
+ ********************************************************************************
+**/
+void ThreadStackUnregister(thread_handle_t thread);
+
+#endif // THREAD_STACK_MONITOR_THREADS
+
+#ifdef __cplusplus
+  }
+#endif // __cplusplus
+
+#endif // __FREERTOS_WRAPPER_STACK_H__
\ No newline at end of file
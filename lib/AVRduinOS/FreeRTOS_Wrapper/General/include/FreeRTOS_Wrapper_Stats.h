@@ -0,0 +1,165 @@
+/**
+ ********************************************************************************
+ * @file    FreeRTOS_Wrapper_Stats.h
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Run Time Statistics Wrappers for FreeRTOS
+ * @version 1.0
+ * @date    2024-03-18
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <Arduino_FreeRTOS.h>
+
+#include "FreeRTOS_Wrapper_Configuration.h"
+#include "FreeRTOS_Wrapper_Types.h"
+
+#ifndef __FREERTOS_WRAPPER_STATS_H__
+#define __FREERTOS_WRAPPER_STATS_H__
+
+#ifdef __cplusplus
+  extern "C" {
+#endif // __cplusplus
+
+#if (THREAD_STATS_ENABLED == 1)
+
+/**
+ ********************************************************************************
+ * @brief   Size of the ThreadStatsDump header in bytes
+ ********************************************************************************
+ * @note    uint8_t thread count, uint32_t total run time in microseconds,
+ *          uint32_t total context switches, uint8_t CPU load in percent.
+ ********************************************************************************
+**/
+#define THREAD_STATS_DUMP_HEADER_SIZE 10
+
+/**
+ ********************************************************************************
+ * @brief   Size of one ThreadStatsDump thread record in bytes
+ ********************************************************************************
+ * @note    uint8_t thread id, uint8_t priority, uint32_t run time in
+ *          microseconds, uint32_t context switches, then the thread name padded
+ *          with zeros to configMAX_TASK_NAME_LEN.
+ ********************************************************************************
+**/
+#define THREAD_STATS_DUMP_RECORD_SIZE (10 + configMAX_TASK_NAME_LEN)
+
+/**
+ ********************************************************************************
+ * @brief   Buffer size needed to dump the statistics of a number of threads
+ ********************************************************************************
+**/
+#define THREAD_STATS_DUMP_SIZE(threads) \
+    (THREAD_STATS_DUMP_HEADER_SIZE + (threads) * THREAD_STATS_DUMP_RECORD_SIZE)
+
+/**
+ ********************************************************************************
+ * @brief   Get the Statistics of every Thread
+ ********************************************************************************
+ * @param[out]    stats   TYPE: thread_stats_t *
+ * @param[inout]  count   TYPE: UBaseType_t *
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @note    On entry count holds the length of stats, on return the number of
+ *          entries filled in. Run times are in microseconds since the scheduler
+ *          started and cpu_percent is each thread's share of that time.
+ *          THREAD_MEMORY_INVALID is returned while more than
+ *          THREAD_STATS_MAX_THREADS threads exist.
+ ********************************************************************************
+**/
+thread_return_t ThreadStatsGet(thread_stats_t *stats, UBaseType_t *count);
+
+/**
+ ********************************************************************************
+ * @brief   Get the CPU Load
+ ********************************************************************************
+ * @param[inout]  window  TYPE: thread_stats_window_t *
+ ********************************************************************************
+ * @return  uint8_t
+ ********************************************************************************
+ * @note    This function returns the percentage of time not spent in the idle
+ *          thread since the previous call with the same window, or since the
+ *          scheduler started for a zeroed window. Each caller keeps its own
+ *          window, so callers do not shorten each other's measurement.
+ ********************************************************************************
+**/
+uint8_t ThreadStatsCpuLoad(thread_stats_window_t *window);
+
+/**
+ ********************************************************************************
+ * @brief   Get the Number of Context Switches
+ ********************************************************************************
+ * @return  uint32_t
+ ********************************************************************************
+**/
+uint32_t ThreadStatsSwitches(void);
+
+/**
+ ********************************************************************************
+ * @brief   Get the Run Time of the running Thread
+ ********************************************************************************
+ * @return  uint32_t
+ ********************************************************************************
+ * @note    The microseconds the calling thread has run, including the slice
+ *          it is running now. Unlike the microsecond clock it stops while the
+ *          thread is preempted, so the difference of two readings is the CPU
+ *          time spent between them.
+ ********************************************************************************
+**/
+uint32_t ThreadStatsRunTime(void);
+
+/**
+ ********************************************************************************
+ * @brief   Dump the Statistics of every Thread in a packed binary format
+ ********************************************************************************
+ * @param[out]    buffer  TYPE: uint8_t *
+ * @param[inout]  size    TYPE: size_t *
+ * @param[inout]  window  TYPE: thread_stats_window_t *
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @note    On entry size holds the length of buffer, on return the number of
+ *          bytes written. Multi-byte fields are little endian. Use
+ *          THREAD_STATS_DUMP_SIZE to size the buffer; THREAD_MEMORY_INVALID is
+ *          returned if it cannot hold every thread. The CPU load is measured
+ *          over window as in ThreadStatsCpuLoad, or since the scheduler started
+ *          when window is NULL. No formatting is done on the target, so the
+ *          dump can be written straight to Serial.
+ ********************************************************************************
+**/
+thread_return_t ThreadStatsDump(uint8_t *buffer, size_t *size, thread_stats_window_t *window);
+
+/**
+ ********************************************************************************
+ * @brief   Clear the Statistics of a new Thread
+ ********************************************************************************
+ * @param[in]     id  TYPE: uint8_t
+ ********************************************************************************
+ * @note    Called from traceTASK_CREATE with the id given by the kernel hooks.
+ ********************************************************************************
+**/
+void ThreadStatsCreate(uint8_t id);
+
+/**
+ ********************************************************************************
+ * @brief   Count a Context Switch into the running Thread
+ ********************************************************************************
+ * @param[in]     id  TYPE: uint8_t
+ ********************************************************************************
+ * @note    Called from traceTASK_SWITCHED_IN with the scheduler locked.
+ ********************************************************************************
+**/
+void ThreadStatsSwitchedIn(uint8_t id);
+
+#endif // THREAD_STATS_ENABLED
+
+#ifdef __cplusplus
+  }
+#endif // __cplusplus
+
+#endif // __FREERTOS_WRAPPER_STATS_H__
\ No newline at end of file
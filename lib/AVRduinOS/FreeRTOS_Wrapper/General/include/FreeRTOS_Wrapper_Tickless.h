@@ -0,0 +1,76 @@
+/**
+ ********************************************************************************
+ * @file    FreeRTOS_Wrapper_Tickless.h
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Tickless Idle for FreeRTOS
+ * @version 1.0
+ * @date    2024-03-18
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+ * @note    With THREAD_TICKLESS_IDLE_ENABLED set to 1 the idle thread sleeps in
+ *          THREAD_TICKLESS_SLEEP_MODE whenever no thread is due for
+ *          THREAD_TICKLESS_MIN_TICKS or more. In SLEEP_MODE_IDLE the watchdog
+ *          is set to the longest period that ends before the next thread
+ *          wakes and the tick count is stepped over the ticks slept through.
+ *          Deeper modes keep the watchdog at the tick period and count each
+ *          tick as it passes. Host builds never sleep.
+ ********************************************************************************
+**/
+
+#include <Arduino_FreeRTOS.h>
+
+#include "FreeRTOS_Wrapper_Configuration.h"
+#include "FreeRTOS_Wrapper_Types.h"
+
+#ifndef __FREERTOS_WRAPPER_TICKLESS_H__
+#define __FREERTOS_WRAPPER_TICKLESS_H__
+
+#ifdef __cplusplus
+  extern "C" {
+#endif // __cplusplus
+
+#if (THREAD_TICKLESS_IDLE_ENABLED == 1)
+
+/**
+ ********************************************************************************
+ * @brief   Get the Tickless Idle Counters
+ ********************************************************************************
+ * @param[out]    stats   TYPE: thread_tickless_stats_t *
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @note    The counters cover every sleep since the last clear. A sleep ended
+ *          by the watchdog counts its whole period. One ended early by another
+ *          interrupt counts the ticks measured on the microsecond clock in
+ *          SLEEP_MODE_IDLE, or the watchdog ticks that passed in deeper
+ *          modes. Wake latency is the microseconds from the watchdog interrupt
+ *          to the woken thread being switched in, catching up the tick count
+ *          and the context switch included.
+ ********************************************************************************
+**/
+thread_return_t ThreadTicklessStatsGet(thread_tickless_stats_t *stats);
+
+/**
+ ********************************************************************************
+ * @brief   Clear the Tickless Idle Counters
+ ********************************************************************************
+**/
+void ThreadTicklessStatsClear(void);
+
+/**
+ ********************************************************************************
+ * @brief   Take the Wake Latency when a woken Thread is switched in
+ ********************************************************************************
+ * @note    Called from traceTASK_SWITCHED_IN.
+ ********************************************************************************
+**/
+void ThreadTicklessSwitchedIn(void);
+
+#endif // THREAD_TICKLESS_IDLE_ENABLED
+
+#ifdef __cplusplus
+  }
+#endif // __cplusplus
+
+#endif // __FREERTOS_WRAPPER_TICKLESS_H__
\ No newline at end of file
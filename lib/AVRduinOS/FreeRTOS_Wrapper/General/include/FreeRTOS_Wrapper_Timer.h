@@ -0,0 +1,289 @@
+/**
+ ********************************************************************************
+ * @file    FreeRTOS_Wrapper_Timer.h
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Software Timer Wrappers for FreeRTOS
+ * @version 1.0
+ * @date    2024-03-18
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+ * @note    A software timer runs a callback once (ONE_SHOT) or every period
+ *          (AUTO_RELOAD) in the timer daemon thread, so a small periodic job
+ *          needs a control block of a few dozen bytes in place of a thread
+ *          with its own stack. All callbacks share the daemon stack of
+ *          configTIMER_TASK_STACK_DEPTH words and run at
+ *          configTIMER_TASK_PRIORITY.
+ *
+ *          The daemon runs the callbacks of one tick one after another, so
+ *          a tick sustains about
+ *
+ *              (F_CPU * portTICK_PERIOD_MS / 1000) / (dispatch + callback)
+ *
+ *          callbacks, where dispatch is the timer_dispatch result of the
+ *          latency benchmarks in cycles. A 15 ms tick at 16 MHz is 240000
+ *          cycles, so short callbacks are bound by the time they leave the
+ *          threads below the daemon rather than by the daemon. A callback
+ *          must not block, and one slow callback delays every later one.
+ *
+ *          Start, stop, reset, change period and delete are commands queued
+ *          to the daemon. max_wait bounds the wait for room in the queue of
+ *          configTIMER_QUEUE_LENGTH commands, and THREAD_TIMER_QUEUE_FULL is
+ *          returned when there was none.
+ ********************************************************************************
+**/
+
+#include <Arduino_FreeRTOS.h>
+#include <timers.h>
+
+#include "FreeRTOS_Wrapper_Types.h"
+
+#ifndef __FREERTOS_WRAPPER_TIMER_H__
+#define __FREERTOS_WRAPPER_TIMER_H__
+
+#ifdef __cplusplus
+  extern "C" {
+#endif // __cplusplus
+
+#if (configUSE_TIMERS == 1)
+/**
+ ********************************************************************************
+ * @brief   Create a Timer
+ ********************************************************************************
+ * @param[out]    timer     TYPE: thread_timer_handle_t *
+ * @param[in]     name      TYPE: const char *
+ * @param[in]     period    TYPE: thread_time_t
+ * @param[in]     mode      TYPE: thread_timer_mode_t
+ * @param[in]     callback  TYPE: thread_timer_callback_t
+ * @param[in]     context   TYPE: void *
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @note    The timer is created stopped. The period is in milliseconds and
+ *          must be at least one tick, otherwise THREAD_TIMER_INVALID is
+ *          returned. A NULL callback returns THREAD_FUNCTION_INVALID. The
+ *          callback reads the context with TimerContext.
+ ********************************************************************************
+**/
+thread_return_t CreateTimer(thread_timer_handle_t *timer,
+                            const char *name,
+                            thread_time_t period,
+                            thread_timer_mode_t mode,
+                            thread_timer_callback_t callback,
+                            void *context);
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/**
+ ********************************************************************************
+ * @brief   Create a Timer in statically allocated memory
+ ********************************************************************************
+ * @param[out]    timer     TYPE: thread_timer_handle_t *
+ * @param[in]     name      TYPE: const char *
+ * @param[in]     period    TYPE: thread_time_t
+ * @param[in]     mode      TYPE: thread_timer_mode_t
+ * @param[in]     callback  TYPE: thread_timer_callback_t
+ * @param[in]     context   TYPE: void *
+ * @param[in]     memory    TYPE: thread_timer_static_memory_t *
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @note    The control block is reserved with THREAD_TIMER_STATIC_MEMORY.
+ * @see     CreateTimer
+ ********************************************************************************
+**/
+thread_return_t CreateStaticTimer(thread_timer_handle_t *timer,
+                                  const char *name,
+                                  thread_time_t period,
+                                  thread_timer_mode_t mode,
+                                  thread_timer_callback_t callback,
+                                  void *context,
+                                  thread_timer_static_memory_t *memory);
+#endif // configSUPPORT_STATIC_ALLOCATION
+
+/**
+ ********************************************************************************
+ * @brief   Delete a Timer
+ ********************************************************************************
+ * @param[inout]  timer     TYPE: thread_timer_handle_t *
+ * @param[in]     max_wait  TYPE: thread_time_t
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @note    This function stops and deletes a timer and nullifies the handle.
+ *          The handle is kept if the command could not be queued.
+ ********************************************************************************
+**/
+thread_return_t DeleteTimer(thread_timer_handle_t *timer,
+                            thread_time_t max_wait);
+
+/**
+ ********************************************************************************
+ * @brief   Start a Timer
+ ********************************************************************************
+ * @param[in]     timer     TYPE: thread_timer_handle_t *
+ * @param[in]     max_wait  TYPE: thread_time_t
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @note    The period is counted from the call. Starting a running timer
+ *          restarts it.
+ ********************************************************************************
+**/
+thread_return_t TimerStart(thread_timer_handle_t *timer,
+                           thread_time_t max_wait);
+
+/**
+ ********************************************************************************
+ * @brief   Stop a Timer
+ ********************************************************************************
+ * @param[in]     timer     TYPE: thread_timer_handle_t *
+ * @param[in]     max_wait  TYPE: thread_time_t
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+**/
+thread_return_t TimerStop(thread_timer_handle_t *timer,
+                          thread_time_t max_wait);
+
+/**
+ ********************************************************************************
+ * @brief   Restart the Period of a Timer
+ ********************************************************************************
+ * @param[in]     timer     TYPE: thread_timer_handle_t *
+ * @param[in]     max_wait  TYPE: thread_time_t
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @note    Resetting a timer before it expires pushes the expiry out, as a
+ *          watchdog is fed.
+ ********************************************************************************
+**/
+thread_return_t TimerReset(thread_timer_handle_t *timer,
+                           thread_time_t max_wait);
+
+/**
+ ********************************************************************************
+ * @brief   Change the Period of a Timer
+ ********************************************************************************
+ * @param[in]     timer     TYPE: thread_timer_handle_t *
+ * @param[in]     period    TYPE: thread_time_t
+ * @param[in]     max_wait  TYPE: thread_time_t
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @note    The new period is counted from the call and starts a stopped
+ *          timer.
+ ********************************************************************************
+**/
+thread_return_t TimerChangePeriod(thread_timer_handle_t *timer,
+                                  thread_time_t period,
+                                  thread_time_t max_wait);
+
+/**
+ ********************************************************************************
+ * @brief   Start a Timer from an Interrupt
+ ********************************************************************************
+ * @param[in]     timer  TYPE: thread_timer_handle_t *
+ * @param[inout]  yield  TYPE: thread_isr_yield_t *
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @note    yield is set when the daemon has a higher priority than the
+ *          interrupted thread, for ThreadYieldFromISR.
+ * @see     TimerStart
+ ********************************************************************************
+**/
+thread_return_t TimerStartFromISR(thread_timer_handle_t *timer,
+                                  thread_isr_yield_t *yield);
+
+/**
+ ********************************************************************************
+ * @brief   Stop a Timer from an Interrupt
+ ********************************************************************************
+ * @param[in]     timer  TYPE: thread_timer_handle_t *
+ * @param[inout]  yield  TYPE: thread_isr_yield_t *
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @see     TimerStop, TimerStartFromISR
+ ********************************************************************************
+**/
+thread_return_t TimerStopFromISR(thread_timer_handle_t *timer,
+                                 thread_isr_yield_t *yield);
+
+/**
+ ********************************************************************************
+ * @brief   Restart the Period of a Timer from an Interrupt
+ ********************************************************************************
+ * @param[in]     timer  TYPE: thread_timer_handle_t *
+ * @param[inout]  yield  TYPE: thread_isr_yield_t *
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @see     TimerReset, TimerStartFromISR
+ ********************************************************************************
+**/
+thread_return_t TimerResetFromISR(thread_timer_handle_t *timer,
+                                  thread_isr_yield_t *yield);
+
+/**
+ ********************************************************************************
+ * @brief   Change the Period of a Timer from an Interrupt
+ ********************************************************************************
+ * @param[in]     timer   TYPE: thread_timer_handle_t *
+ * @param[in]     period  TYPE: thread_time_t
+ * @param[inout]  yield   TYPE: thread_isr_yield_t *
+ ********************************************************************************
+ * @return  thread_return_t
+ ********************************************************************************
+ * @see     TimerChangePeriod, TimerStartFromISR
+ ********************************************************************************
+**/
+thread_return_t TimerChangePeriodFromISR(thread_timer_handle_t *timer,
+                                         thread_time_t period,
+                                         thread_isr_yield_t *yield);
+
+/**
+ ********************************************************************************
+ * @brief   Check whether a Timer is running
+ ********************************************************************************
+ * @param[in]     timer  TYPE: thread_timer_handle_t *
+ ********************************************************************************
+ * @return  bool
+ ********************************************************************************
+ * @note    A one-shot timer stops after it expires. Commands still in the
+ *          queue are not yet reflected.
+ ********************************************************************************
+**/
+bool TimerActive(thread_timer_handle_t *timer);
+
+/**
+ ********************************************************************************
+ * @brief   Get the Period of a Timer
+ ********************************************************************************
+ * @param[in]     timer  TYPE: thread_timer_handle_t *
+ ********************************************************************************
+ * @return  thread_time_t, in milliseconds, 0 for an invalid timer
+ ********************************************************************************
+**/
+thread_time_t TimerPeriod(thread_timer_handle_t *timer);
+
+/**
+ ********************************************************************************
+ * @brief   Get the Context a Timer was created with
+ ********************************************************************************
+ * @param[in]     timer  TYPE: thread_timer_handle_t
+ ********************************************************************************
+ * @return  void *
+ ********************************************************************************
+ * @note    Takes the handle by value, as the callback receives it.
+ ********************************************************************************
+**/
+void *TimerContext(thread_timer_handle_t timer);
+#endif // configUSE_TIMERS
+
+#ifdef __cplusplus
+  }
+#endif // __cplusplus
+
+#endif // __FREERTOS_WRAPPER_TIMER_H__
\ No newline at end of file
@@ -0,0 +1,135 @@
+/**
+ ********************************************************************************
+ * @file    FreeRTOS_Wrapper_Trace.h
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Binary Trace Recorder for FreeRTOS
+ * @version 1.0
+ * @date    2024-03-18
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#include <stdint.h>
+
+#include <Arduino_FreeRTOS.h>
+
+#include "FreeRTOS_Wrapper_Configuration.h"
+#include "FreeRTOS_Wrapper_Types.h"
+#include "FreeRTOS_Wrapper_Hooks.h"
+
+#ifndef __FREERTOS_WRAPPER_TRACE_H__
+#define __FREERTOS_WRAPPER_TRACE_H__
+
+#ifdef __cplusplus
+  extern "C" {
+#endif // __cplusplus
+
+#if (THREAD_TRACE_ENABLED == 1)
+
+/**
+ ********************************************************************************
+ * @brief   Size of one packed trace record in bytes
+ ********************************************************************************
+ * @note    uint8_t event, uint8_t object, uint32_t time in microseconds, little
+ *          endian. The event codes are the THREAD_TRACE_* values in
+ *          FreeRTOS_Wrapper_Hooks.h.
+ ********************************************************************************
+**/
+#define THREAD_TRACE_RECORD_SIZE 6
+
+/**
+ ********************************************************************************
+ * @brief   Start recording Trace Events
+ ********************************************************************************
+ * @note    The names of every living thread are queued for the drain thread
+ *          so the host can label the timeline.
+ ********************************************************************************
+**/
+void ThreadTraceStart(void);
+
+/**
+ ********************************************************************************
+ * @brief   Stop recording Trace Events
+ ********************************************************************************
+ * @note    Records already buffered are still handed out by ThreadTraceRead.
+ ********************************************************************************
+**/
+void ThreadTraceStop(void);
+
+/**
+ ********************************************************************************
+ * @brief   Record a User Mark
+ ********************************************************************************
+ * @param[in]     value   TYPE: uint8_t
+ ********************************************************************************
+ * @note    This function may be called from interrupts. It costs the same as a
+ *          kernel event, far less than a Print, so it can bracket code being
+ *          timed without distorting it.
+ ********************************************************************************
+**/
+void ThreadTraceMark(uint8_t value);
+
+/**
+ ********************************************************************************
+ * @brief   Take buffered Trace Records
+ ********************************************************************************
+ * @param[out]    buffer    TYPE: uint8_t *
+ * @param[in]     records   TYPE: uint8_t
+ ********************************************************************************
+ * @return  uint8_t  Number of records written
+ ********************************************************************************
+ * @note    Up to records packed records of THREAD_TRACE_RECORD_SIZE bytes are
+ *          written to buffer. Only one thread may read the trace.
+ ********************************************************************************
+**/
+uint8_t ThreadTraceRead(uint8_t *buffer, uint8_t records);
+
+/**
+ ********************************************************************************
+ * @brief   Thread Function that drains the Trace over a Serial Port
+ ********************************************************************************
+ * @param[in]     params  TYPE: HardwareSerial *, NULL for Serial
+ ********************************************************************************
+ * @note    Records and thread names are sent in frames of
+ *          0xA5, type, length, payload, checksum, where type 0x01 holds packed
+ *          records, type 0x02 holds a hook id followed by the thread name, and
+ *          the checksum is the 8-bit sum of type, length and payload. Decode
+ *          the stream with tools/trace_decode.py. Run the thread at the lowest
+ *          priority so draining only uses idle time.
+ ********************************************************************************
+**/
+void ThreadTraceDrain(void *params);
+
+/**
+ ********************************************************************************
+ * @brief   Record a Trace Event
+ ********************************************************************************
+ * @param[in]     event   TYPE: uint8_t
+ * @param[in]     object  TYPE: uint8_t
+ ********************************************************************************
+ * @note    Called from the kernel hooks. A record that does not fit is
+ *          counted and reported with a THREAD_TRACE_OVERFLOW record once
+ *          there is room again.
+ ********************************************************************************
+**/
+void ThreadTraceRecord(uint8_t event, uint8_t object);
+
+/**
+ ********************************************************************************
+ * @brief   Record the Creation of a Thread
+ ********************************************************************************
+ * @param[in]     id  TYPE: uint8_t
+ ********************************************************************************
+ * @note    Called from traceTASK_CREATE with the id given by the kernel hooks.
+ ********************************************************************************
+**/
+void ThreadTraceCreate(uint8_t id);
+
+#endif // THREAD_TRACE_ENABLED
+
+#ifdef __cplusplus
+  }
+#endif // __cplusplus
+
+#endif // __FREERTOS_WRAPPER_TRACE_H__
\ No newline at end of file
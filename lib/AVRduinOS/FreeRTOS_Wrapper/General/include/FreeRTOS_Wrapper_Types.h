@@ -20,16 +20,52 @@
 #include <stdbool.h>
 
 #include <Arduino_FreeRTOS.h>
+#include <queue.h>
+#include <semphr.h>
+#include <event_groups.h>
+#include <timers.h>
+#include <stream_buffer.h>
+#include <message_buffer.h>
+
+#include "FreeRTOS_Wrapper_Configuration.h"
 
 typedef TaskHandle_t thread_handle_t;
 typedef TaskFunction_t thread_loop_t;
+typedef void *thread_parameters_t;
 typedef const configSTACK_DEPTH_TYPE thread_stack_size_t;
 typedef TickType_t thread_time_t;
 typedef uint32_t thread_notice_value_t;
 typedef UBaseType_t thread_notice_index_t;
+typedef QueueHandle_t thread_queue_handle_t;
+typedef UBaseType_t thread_queue_length_t;
+typedef UBaseType_t thread_queue_item_size_t;
+typedef SemaphoreHandle_t thread_mutex_handle_t;
+typedef SemaphoreHandle_t thread_semaphore_handle_t;
+typedef UBaseType_t thread_semaphore_count_t;
+typedef BaseType_t thread_isr_yield_t;
+typedef EventGroupHandle_t thread_event_group_handle_t;
+typedef EventBits_t thread_event_bits_t;
+typedef TimerHandle_t thread_timer_handle_t;
+typedef TimerCallbackFunction_t thread_timer_callback_t;
+typedef StreamBufferHandle_t thread_stream_buffer_handle_t;
+typedef MessageBufferHandle_t thread_message_buffer_handle_t;
+typedef size_t thread_buffer_size_t;
 
 #define THREAD_MILLISEC portTICK_PERIOD_MS
 
+// Starting value of the yield flag an interrupt passes to FromISR functions
+#define THREAD_ISR_YIELD_INIT pdFALSE
+
+// Starting value of a mutex before it is created, like a NULL handle
+#define THREAD_MUTEX_INIT { NULL }
+
+// Starting value of a zero-copy queue before it is created
+#define THREAD_ZERO_COPY_QUEUE_INIT { NULL, NULL, 0, 0, NULL, NULL }
+
+// Bits of an event group free for use, the top byte belongs to the kernel
+#define THREAD_EVENT_BITS_ALL \
+    ((thread_event_bits_t)(((thread_event_bits_t)1 << ((sizeof(thread_event_bits_t) - 1) * 8)) - 1))
+
 typedef enum __thread_return {
     THREAD_SUCCESS = 0,
     THREAD_FAILURE_MEMORY_ALLOCATION,
@@ -39,13 +75,41 @@ typedef enum __thread_return {
     THREAD_FUNCTION_INVALID,
     THREAD_NOTICE_INDEX_INVALID,
     THREAD_FAILURE_UNKNOWN,
+    THREAD_MEMORY_INVALID,
+    THREAD_PERIOD_INVALID,
+    THREAD_PERIOD_OVERRUN,
+    THREAD_QUEUE_INVALID,
+    THREAD_QUEUE_FULL,
+    THREAD_QUEUE_EMPTY,
+    THREAD_MUTEX_TIMEOUT,
+    THREAD_MUTEX_NOT_HOLDER,
+    THREAD_SEMAPHORE_INVALID,
+    THREAD_SEMAPHORE_FULL,
+    THREAD_SEMAPHORE_TIMEOUT,
+    THREAD_EVENT_BITS_INVALID,
+    THREAD_EVENT_TIMEOUT,
+    THREAD_TIMER_INVALID,
+    THREAD_TIMER_QUEUE_FULL,
+    THREAD_BUFFER_INVALID,
+    THREAD_BUFFER_FULL,
+    THREAD_BUFFER_EMPTY,
+    THREAD_PRIORITY_EXHAUSTED,
+    THREAD_SCHEDULE_OVERLOAD,
+    THREAD_SCHEDULE_WCET_OVERRUN,
+    THREAD_PERIOD_DEADLINE_MISSED,
 } thread_return_t;
 
+// LOW, MEDIUM and HIGH are fixed levels below THREAD_PRIORITY_MAX
+#if (configMAX_PRIORITIES < 4)
+  #error "The FreeRTOS Wrapper requires configMAX_PRIORITIES of 4 or more"
+#endif // configMAX_PRIORITIES
+
 typedef enum __thread_priority {
     THREAD_PRIORITY_IDLE = tskIDLE_PRIORITY,
     THREAD_PRIORITY_LOW,
     THREAD_PRIORITY_MEDIUM,
-    THREAD_PRIORITY_HIGH
+    THREAD_PRIORITY_HIGH,
+    THREAD_PRIORITY_MAX = configMAX_PRIORITIES - 1
 } thread_priority_t;
 
 typedef enum __thread_notice_give_action {
@@ -61,6 +125,16 @@ typedef enum __thread_notice_take_action {
   CLEAR = pdTRUE
 } thread_notice_take_action_t;
 
+typedef enum __thread_event_wait {
+  WAIT_ANY = pdFALSE,
+  WAIT_ALL = pdTRUE
+} thread_event_wait_t;
+
+typedef enum __thread_timer_mode {
+  ONE_SHOT = pdFALSE,
+  AUTO_RELOAD = pdTRUE
+} thread_timer_mode_t;
+
 typedef enum __thread_valid {
         THREAD_STRUCT_VALID = 0,
         THREAD_NAME_NOT_PROVIDED,
@@ -75,9 +149,288 @@ typedef struct __thread_function {
     thread_priority_t priority;
     thread_stack_size_t stack_size;
     const char *thread_name;
+    thread_parameters_t parameters;
     thread_valid_t valid;
 } thread_function_t;
 
+typedef enum __thread_deadline_action {
+    DEADLINE_CONTINUE = 0,
+    DEADLINE_SKIP
+} thread_deadline_action_t;
+
+struct __thread_period;
+typedef thread_deadline_action_t (*thread_deadline_hook_t)(thread_handle_t thread, struct __thread_period *period);
+
+typedef struct __thread_period {
+    TickType_t last_wake;
+    TickType_t period;
+    uint32_t cycles;
+    uint32_t overruns;
+    thread_time_t worst_lateness;
+#if (THREAD_DEADLINE_MONITOR_THREADS > 0)
+    TickType_t deadline;
+    uint32_t misses;
+    uint32_t skips;
+    thread_deadline_hook_t hook;
+    volatile bool waiting;
+    volatile bool missed;
+    volatile bool skip;
+#endif // THREAD_DEADLINE_MONITOR_THREADS
+} thread_period_t;
+
+typedef struct __thread_zero_copy_queue {
+    thread_queue_handle_t queue;
+    thread_queue_handle_t free_blocks;
+    thread_queue_item_size_t block_size;
+    thread_queue_length_t length;
+    uint8_t *storage;
+    uint8_t *acquired;
+} thread_zero_copy_queue_t;
+
+typedef struct __thread_mutex_stats {
+    uint32_t locks;
+    uint32_t contentions;
+    uint32_t inversions;
+    uint32_t timeouts;
+    uint32_t wait_max;
+    uint32_t hold_max;
+    uint32_t hold_total;
+} thread_mutex_stats_t;
+
+typedef struct __thread_mutex {
+    thread_mutex_handle_t handle;
+    thread_handle_t holder;
+    UBaseType_t depth;
+    bool recursive;
+#if (THREAD_MUTEX_STATS_ENABLED == 1)
+    uint32_t taken_at;
+    thread_mutex_stats_t stats;
+#endif // THREAD_MUTEX_STATS_ENABLED
+} thread_mutex_t;
+
+typedef struct __thread_stats {
+    thread_handle_t thread;
+    const char *thread_name;
+    UBaseType_t priority;
+    uint32_t run_time;
+    uint32_t switches;
+    uint8_t cpu_percent;
+} thread_stats_t;
+
+typedef struct __thread_stats_window {
+    uint32_t total;
+    uint32_t idle;
+} thread_stats_window_t;
+
+typedef struct __thread_schedule {
+    thread_function_t *thread;
+    thread_time_t period_ms;
+    thread_time_t deadline_ms;
+    uint32_t wcet_us;
+    uint32_t response_us;
+    uint32_t cycles;
+    uint32_t exec_last_us;
+    uint32_t exec_max_us;
+    uint32_t wcet_overruns;
+    uint32_t started_at;
+} thread_schedule_t;
+
+typedef struct __thread_schedule_report {
+    uint16_t utilization;
+    uint16_t liu_layland_bound;
+    bool liu_layland_pass;
+    bool response_time_pass;
+    UBaseType_t first_miss;
+} thread_schedule_report_t;
+
+typedef struct __thread_tickless_stats {
+    uint32_t sleeps;
+    uint32_t early_wakes;
+    uint32_t slept_ticks;
+    uint32_t slept_ms;
+    uint32_t wake_latency_last;
+    uint32_t wake_latency_max;
+} thread_tickless_stats_t;
+
+typedef struct __thread_trace_record {
+    uint8_t event;
+    uint8_t object;
+    uint32_t time;
+} thread_trace_record_t;
+
+typedef struct __thread_stack_report {
+    thread_handle_t thread;
+    const char *thread_name;
+    configSTACK_DEPTH_TYPE stack_size;
+    configSTACK_DEPTH_TYPE high_water_mark;
+    configSTACK_DEPTH_TYPE suggested_size;
+} thread_stack_report_t;
+
+typedef void (*thread_stack_report_callback_t)(const thread_stack_report_t *reports, UBaseType_t count);
+
+typedef struct __thread_stack_monitor {
+    thread_time_t period_ms;
+    thread_stack_report_callback_t report;
+} thread_stack_monitor_t;
+
+/**
+ ********************************************************************************
+ * @brief   Stack depth a thread is created with, raised to THREAD_STACK_MINIMUM
+ ********************************************************************************
+**/
+#if (THREAD_STACK_MINIMUM > 0)
+  #define THREAD_STACK_DEPTH(stack_size) \
+    (((stack_size) < THREAD_STACK_MINIMUM) ? THREAD_STACK_MINIMUM : (stack_size))
+#else
+  #define THREAD_STACK_DEPTH(stack_size) (stack_size)
+#endif // THREAD_STACK_MINIMUM
+
+/**
+ ********************************************************************************
+ * @brief   Size of one block in a zero-copy queue, rounded up to pointer alignment
+ ********************************************************************************
+**/
+#define THREAD_QUEUE_BLOCK_STRIDE(block_size) \
+    ((((block_size) + sizeof(void *) - 1) / sizeof(void *)) * sizeof(void *))
+
+/**
+ ********************************************************************************
+ * @brief   Size of the bitmap of acquired blocks kept after a zero-copy pool,
+ *          rounded up to pointer alignment
+ ********************************************************************************
+**/
+#define THREAD_QUEUE_BLOCK_FLAGS_SIZE(length) \
+    (((((length) + 7) / 8 + sizeof(void *) - 1) / sizeof(void *)) * sizeof(void *))
+
+/**
+ ********************************************************************************
+ * @brief   Reserve the block pool for a zero-copy queue
+ ********************************************************************************
+ * @param[in]     name        Identifier of the storage array to declare
+ * @param[in]     block_size  Size of one block in bytes
+ * @param[in]     length      Number of blocks, equal to the queue length
+ ********************************************************************************
+**/
+#define THREAD_QUEUE_BLOCK_STORAGE(name, block_size, length) \
+    static void *name[((THREAD_QUEUE_BLOCK_STRIDE(block_size) * (length)) + \
+                       THREAD_QUEUE_BLOCK_FLAGS_SIZE(length)) / sizeof(void *)]
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+typedef struct __thread_static_memory {
+    StackType_t *stack;
+    StaticTask_t *control_block;
+    configSTACK_DEPTH_TYPE stack_size;
+} thread_static_memory_t;
+
+/**
+ ********************************************************************************
+ * @brief   Reserve the stack and control block for a statically allocated thread
+ ********************************************************************************
+ * @param[in]     name        Identifier of the thread_static_memory_t to declare
+ * @param[in]     stack_size  Stack depth in words, as given to ConfigureThread
+ ********************************************************************************
+ * @note    The memory is reserved at compile time, so a thread created on it
+ *          with CreateStaticThread never touches the FreeRTOS heap. The stack
+ *          is raised to THREAD_STACK_MINIMUM like the thread that uses it.
+ ********************************************************************************
+**/
+#define THREAD_STATIC_MEMORY(name, stack_size) \
+    static StackType_t name##_stack[THREAD_STACK_DEPTH(stack_size)]; \
+    static StaticTask_t name##_control_block; \
+    static thread_static_memory_t name = { name##_stack, &name##_control_block, (stack_size) }
+
+typedef struct __thread_queue_static_memory {
+    uint8_t *storage;
+    StaticQueue_t *control_block;
+    thread_queue_length_t length;
+    thread_queue_item_size_t item_size;
+} thread_queue_static_memory_t;
+
+/**
+ ********************************************************************************
+ * @brief   Reserve the storage and control block for a statically allocated queue
+ ********************************************************************************
+ * @param[in]     name        Identifier of the thread_queue_static_memory_t
+ * @param[in]     length      Number of items the queue can hold
+ * @param[in]     item_size   Size of one item in bytes
+ ********************************************************************************
+**/
+#define THREAD_QUEUE_STATIC_MEMORY(name, length, item_size) \
+    static uint8_t name##_storage[(length) * (item_size)]; \
+    static StaticQueue_t name##_control_block; \
+    static thread_queue_static_memory_t name = { name##_storage, &name##_control_block, (length), (item_size) }
+
+typedef StaticSemaphore_t thread_mutex_static_memory_t;
+
+/**
+ ********************************************************************************
+ * @brief   Reserve the control block for a statically allocated mutex
+ ********************************************************************************
+ * @param[in]     name  Identifier of the thread_mutex_static_memory_t to declare
+ ********************************************************************************
+**/
+#define THREAD_MUTEX_STATIC_MEMORY(name) \
+    static thread_mutex_static_memory_t name
+
+typedef StaticSemaphore_t thread_semaphore_static_memory_t;
+
+/**
+ ********************************************************************************
+ * @brief   Reserve the control block for a statically allocated semaphore
+ ********************************************************************************
+ * @param[in]     name  Identifier of the thread_semaphore_static_memory_t
+ ********************************************************************************
+**/
+#define THREAD_SEMAPHORE_STATIC_MEMORY(name) \
+    static thread_semaphore_static_memory_t name
+
+typedef StaticEventGroup_t thread_event_group_static_memory_t;
+
+/**
+ ********************************************************************************
+ * @brief   Reserve the control block for a statically allocated event group
+ ********************************************************************************
+ * @param[in]     name  Identifier of the thread_event_group_static_memory_t
+ ********************************************************************************
+**/
+#define THREAD_EVENT_GROUP_STATIC_MEMORY(name) \
+    static thread_event_group_static_memory_t name
+
+typedef StaticTimer_t thread_timer_static_memory_t;
+
+/**
+ ********************************************************************************
+ * @brief   Reserve the control block for a statically allocated timer
+ ********************************************************************************
+ * @param[in]     name  Identifier of the thread_timer_static_memory_t to declare
+ ********************************************************************************
+**/
+#define THREAD_TIMER_STATIC_MEMORY(name) \
+    static thread_timer_static_memory_t name
+
+typedef struct __thread_buffer_static_memory {
+    uint8_t *storage;
+    StaticStreamBuffer_t *control_block;
+    thread_buffer_size_t size;
+} thread_buffer_static_memory_t;
+
+/**
+ ********************************************************************************
+ * @brief   Reserve the storage and control block for a static stream or message buffer
+ ********************************************************************************
+ * @param[in]     name  Identifier of the thread_buffer_static_memory_t to declare
+ * @param[in]     size  Capacity in bytes, including the length of each message
+ ********************************************************************************
+ * @note    One byte more than the capacity is reserved, as the kernel keeps
+ *          the buffer from filling up completely.
+ ********************************************************************************
+**/
+#define THREAD_BUFFER_STATIC_MEMORY(name, size) \
+    static uint8_t name##_storage[(size) + 1]; \
+    static StaticStreamBuffer_t name##_control_block; \
+    static thread_buffer_static_memory_t name = { name##_storage, &name##_control_block, (size) }
+#endif // configSUPPORT_STATIC_ALLOCATION
+
 #ifdef __cplusplus
   }
 #endif // __cplusplus
@@ -0,0 +1,248 @@
+/**
+ ********************************************************************************
+ * @file    FreeRTOS_Wrapper_Buffer.c
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Stream and Message Buffer Wrappers for FreeRTOS
+ * @version 1.0
+ * @date    2024-03-18
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#include "FreeRTOS_Wrapper_Buffer.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <Arduino_FreeRTOS.h>
+#include <stream_buffer.h>
+#include <message_buffer.h>
+
+#include "FreeRTOS_Wrapper_Types.h"
+#include "FreeRTOS_Wrapper_Methods.h"
+
+#ifndef configMESSAGE_BUFFER_LENGTH_TYPE
+  #define configMESSAGE_BUFFER_LENGTH_TYPE size_t
+#endif // configMESSAGE_BUFFER_LENGTH_TYPE
+
+static thread_return_t BufferCheck(thread_stream_buffer_handle_t *buffer, thread_buffer_size_t size, thread_buffer_size_t trigger);
+
+thread_return_t CreateStreamBuffer(thread_stream_buffer_handle_t *buffer, thread_buffer_size_t size, thread_buffer_size_t trigger) {
+  thread_return_t retval = BufferCheck(buffer, size, trigger);
+  if (retval != THREAD_SUCCESS)
+    return retval;
+
+  *buffer = xStreamBufferCreate(size, trigger);
+  return (*buffer != NULL) ? THREAD_SUCCESS : THREAD_FAILURE_MEMORY_ALLOCATION;
+}
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+thread_return_t CreateStaticStreamBuffer(thread_stream_buffer_handle_t *buffer, thread_buffer_size_t trigger, thread_buffer_static_memory_t *memory) {
+  if (buffer == NULL || *buffer != NULL)
+    return THREAD_HANDLE_INVALID;
+  if (memory == NULL)
+    return THREAD_MEMORY_INVALID;
+  thread_return_t retval = BufferCheck(buffer, memory->size, trigger);
+  if (retval != THREAD_SUCCESS)
+    return retval;
+
+  *buffer = xStreamBufferCreateStatic(memory->size, trigger, memory->storage, memory->control_block);
+  return (*buffer != NULL) ? THREAD_SUCCESS : THREAD_FAILURE_UNKNOWN;
+}
+#endif // configSUPPORT_STATIC_ALLOCATION
+
+thread_return_t DeleteStreamBuffer(thread_stream_buffer_handle_t *buffer) {
+  if (buffer == NULL || *buffer == NULL)
+    return THREAD_HANDLE_INVALID;
+
+  vStreamBufferDelete(*buffer);
+  *buffer = NULL;
+  return THREAD_SUCCESS;
+}
+
+thread_return_t StreamBufferSend(thread_stream_buffer_handle_t *buffer, const void *data, thread_buffer_size_t length, thread_time_t max_wait, thread_buffer_size_t *sent) {
+  if (buffer == NULL || *buffer == NULL)
+    return THREAD_HANDLE_INVALID;
+  if (data == NULL)
+    return THREAD_MEMORY_INVALID;
+
+  thread_buffer_size_t count = xStreamBufferSend(*buffer, data, length, pdMS_TO_TICKS(max_wait));
+  if (sent != NULL)
+    *sent = count;
+  return QueueAssert((count == length) ? pdPASS : errQUEUE_FULL, THREAD_BUFFER_FULL);
+}
+
+thread_return_t StreamBufferSendFromISR(thread_stream_buffer_handle_t *buffer, const void *data, thread_buffer_size_t length, thread_buffer_size_t *sent, thread_isr_yield_t *yield) {
+  if (buffer == NULL || *buffer == NULL)
+    return THREAD_HANDLE_INVALID;
+  if (data == NULL)
+    return THREAD_MEMORY_INVALID;
+
+  thread_buffer_size_t count = xStreamBufferSendFromISR(*buffer, data, length, yield);
+  if (sent != NULL)
+    *sent = count;
+  return QueueAssert((count == length) ? pdPASS : errQUEUE_FULL, THREAD_BUFFER_FULL);
+}
+
+thread_return_t StreamBufferReceive(thread_stream_buffer_handle_t *buffer, void *data, thread_buffer_size_t length, thread_time_t max_wait, thread_buffer_size_t *received) {
+  if (buffer == NULL || *buffer == NULL)
+    return THREAD_HANDLE_INVALID;
+  if (data == NULL)
+    return THREAD_MEMORY_INVALID;
+
+  thread_buffer_size_t count = xStreamBufferReceive(*buffer, data, length, pdMS_TO_TICKS(max_wait));
+  if (received != NULL)
+    *received = count;
+  return QueueAssert((count != 0) ? pdPASS : errQUEUE_EMPTY, THREAD_BUFFER_EMPTY);
+}
+
+thread_return_t StreamBufferReceiveFromISR(thread_stream_buffer_handle_t *buffer, void *data, thread_buffer_size_t length, thread_buffer_size_t *received, thread_isr_yield_t *yield) {
+  if (buffer == NULL || *buffer == NULL)
+    return THREAD_HANDLE_INVALID;
+  if (data == NULL)
+    return THREAD_MEMORY_INVALID;
+
+  thread_buffer_size_t count = xStreamBufferReceiveFromISR(*buffer, data, length, yield);
+  if (received != NULL)
+    *received = count;
+  return QueueAssert((count != 0) ? pdPASS : errQUEUE_EMPTY, THREAD_BUFFER_EMPTY);
+}
+
+thread_return_t StreamBufferTrigger(thread_stream_buffer_handle_t *buffer, thread_buffer_size_t trigger) {
+  if (buffer == NULL || *buffer == NULL)
+    return THREAD_HANDLE_INVALID;
+  if (trigger == 0)
+    return THREAD_BUFFER_INVALID;
+
+  // The kernel refuses a trigger level above the size of the buffer
+  BaseType_t retval = xStreamBufferSetTriggerLevel(*buffer, trigger);
+  return QueueAssert(retval, THREAD_BUFFER_INVALID);
+}
+
+thread_return_t StreamBufferReset(thread_stream_buffer_handle_t *buffer) {
+  if (buffer == NULL || *buffer == NULL)
+    return THREAD_HANDLE_INVALID;
+
+  BaseType_t retval = xStreamBufferReset(*buffer);
+  return ThreadAssert(retval);
+}
+
+thread_buffer_size_t StreamBufferAvailable(thread_stream_buffer_handle_t *buffer) {
+  if (buffer == NULL || *buffer == NULL)
+    return 0;
+
+  return xStreamBufferBytesAvailable(*buffer);
+}
+
+thread_buffer_size_t StreamBufferSpace(thread_stream_buffer_handle_t *buffer) {
+  if (buffer == NULL || *buffer == NULL)
+    return 0;
+
+  return xStreamBufferSpacesAvailable(*buffer);
+}
+
+thread_return_t CreateMessageBuffer(thread_message_buffer_handle_t *buffer, thread_buffer_size_t size) {
+  thread_return_t retval = BufferCheck(buffer, size, 1);
+  if (retval != THREAD_SUCCESS)
+    return retval;
+  if (size <= sizeof(configMESSAGE_BUFFER_LENGTH_TYPE))
+    return THREAD_BUFFER_INVALID;
+
+  *buffer = xMessageBufferCreate(size);
+  return (*buffer != NULL) ? THREAD_SUCCESS : THREAD_FAILURE_MEMORY_ALLOCATION;
+}
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+thread_return_t CreateStaticMessageBuffer(thread_message_buffer_handle_t *buffer, thread_buffer_static_memory_t *memory) {
+  if (buffer == NULL || *buffer != NULL)
+    return THREAD_HANDLE_INVALID;
+  if (memory == NULL)
+    return THREAD_MEMORY_INVALID;
+  thread_return_t retval = BufferCheck(buffer, memory->size, 1);
+  if (retval != THREAD_SUCCESS)
+    return retval;
+  if (memory->size <= sizeof(configMESSAGE_BUFFER_LENGTH_TYPE))
+    return THREAD_BUFFER_INVALID;
+
+  *buffer = xMessageBufferCreateStatic(memory->size, memory->storage, memory->control_block);
+  return (*buffer != NULL) ? THREAD_SUCCESS : THREAD_FAILURE_UNKNOWN;
+}
+#endif // configSUPPORT_STATIC_ALLOCATION
+
+thread_return_t DeleteMessageBuffer(thread_message_buffer_handle_t *buffer) {
+  if (buffer == NULL || *buffer == NULL)
+    return THREAD_HANDLE_INVALID;
+
+  vMessageBufferDelete(*buffer);
+  *buffer = NULL;
+  return THREAD_SUCCESS;
+}
+
+thread_return_t MessageBufferSend(thread_message_buffer_handle_t *buffer, const void *data, thread_buffer_size_t length, thread_time_t max_wait) {
+  if (buffer == NULL || *buffer == NULL)
+    return THREAD_HANDLE_INVALID;
+  if (data == NULL)
+    return THREAD_MEMORY_INVALID;
+
+  thread_buffer_size_t count = xMessageBufferSend(*buffer, data, length, pdMS_TO_TICKS(max_wait));
+  return QueueAssert((count == length) ? pdPASS : errQUEUE_FULL, THREAD_BUFFER_FULL);
+}
+
+thread_return_t MessageBufferSendFromISR(thread_message_buffer_handle_t *buffer, const void *data, thread_buffer_size_t length, thread_isr_yield_t *yield) {
+  if (buffer == NULL || *buffer == NULL)
+    return THREAD_HANDLE_INVALID;
+  if (data == NULL)
+    return THREAD_MEMORY_INVALID;
+
+  thread_buffer_size_t count = xMessageBufferSendFromISR(*buffer, data, length, yield);
+  return QueueAssert((count == length) ? pdPASS : errQUEUE_FULL, THREAD_BUFFER_FULL);
+}
+
+thread_return_t MessageBufferReceive(thread_message_buffer_handle_t *buffer, void *data, thread_buffer_size_t capacity, thread_time_t max_wait, thread_buffer_size_t *length) {
+  if (buffer == NULL || *buffer == NULL)
+    return THREAD_HANDLE_INVALID;
+  if (data == NULL)
+    return THREAD_MEMORY_INVALID;
+
+  thread_buffer_size_t count = xMessageBufferReceive(*buffer, data, capacity, pdMS_TO_TICKS(max_wait));
+  if (length != NULL)
+    *length = count;
+  if (count == 0 && xMessageBufferNextLengthBytes(*buffer) > capacity)
+    return THREAD_BUFFER_INVALID;
+  return QueueAssert((count != 0) ? pdPASS : errQUEUE_EMPTY, THREAD_BUFFER_EMPTY);
+}
+
+thread_return_t MessageBufferReceiveFromISR(thread_message_buffer_handle_t *buffer, void *data, thread_buffer_size_t capacity, thread_buffer_size_t *length, thread_isr_yield_t *yield) {
+  if (buffer == NULL || *buffer == NULL)
+    return THREAD_HANDLE_INVALID;
+  if (data == NULL)
+    return THREAD_MEMORY_INVALID;
+
+  thread_buffer_size_t count = xMessageBufferReceiveFromISR(*buffer, data, capacity, yield);
+  if (length != NULL)
+    *length = count;
+  if (count == 0 && xMessageBufferNextLengthBytes(*buffer) > capacity)
+    return THREAD_BUFFER_INVALID;
+  return QueueAssert((count != 0) ? pdPASS : errQUEUE_EMPTY, THREAD_BUFFER_EMPTY);
+}
+
+thread_return_t MessageBufferReset(thread_message_buffer_handle_t *buffer) {
+  if (buffer == NULL || *buffer == NULL)
+    return THREAD_HANDLE_INVALID;
+
+  BaseType_t retval = xMessageBufferReset(*buffer);
+  return ThreadAssert(retval);
+}
+
+// Message buffers are stream buffers to the kernel and share the check
+static thread_return_t BufferCheck(thread_stream_buffer_handle_t *buffer, thread_buffer_size_t size, thread_buffer_size_t trigger) {
+  if (buffer == NULL)
+    return THREAD_HANDLE_INVALID;
+  if (*buffer != NULL)
+    return THREAD_HANDLE_INVALID;
+  if (size == 0 || trigger == 0 || trigger > size)
+    return THREAD_BUFFER_INVALID;
+
+  return THREAD_SUCCESS;
+}
\ No newline at end of file
@@ -0,0 +1,139 @@
+/**
+ ********************************************************************************
+ * @file    FreeRTOS_Wrapper_Clock.c
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Microsecond Clock for FreeRTOS Wrapper Features
+ * @version 1.0
+ * @date    2024-03-18
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#include "FreeRTOS_Wrapper_Clock.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <Arduino.h>
+
+#include "FreeRTOS_Wrapper_Configuration.h"
+
+#if (THREAD_CLOCK_ENABLED == 1)
+
+#if defined(__AVR__) && (THREAD_CLOCK_TIMER != 0)
+  #include <avr/io.h>
+  #include <avr/interrupt.h>
+
+  #define CLOCK_REGISTER_PASTE(prefix, timer, suffix) prefix##timer##suffix
+  #define CLOCK_REGISTER_EXPAND(prefix, timer, suffix) CLOCK_REGISTER_PASTE(prefix, timer, suffix)
+  #define CLOCK_REGISTER(prefix, suffix) CLOCK_REGISTER_EXPAND(prefix, THREAD_CLOCK_TIMER, suffix)
+
+  #define CLOCK_TCCRA CLOCK_REGISTER(TCCR, A)
+  #define CLOCK_TCCRB CLOCK_REGISTER(TCCR, B)
+  #define CLOCK_TCNT CLOCK_REGISTER(TCNT, )
+  #define CLOCK_TIFR CLOCK_REGISTER(TIFR, )
+  #define CLOCK_TIMSK CLOCK_REGISTER(TIMSK, )
+  #define CLOCK_TOV CLOCK_REGISTER(TOV, )
+  #define CLOCK_TOIE CLOCK_REGISTER(TOIE, )
+  #define CLOCK_CS1 CLOCK_REGISTER(CS, 1)
+  #define CLOCK_OVF_vect CLOCK_REGISTER(TIMER, _OVF_vect)
+
+  // The timer runs at F_CPU / 8, so each count is a whole fraction of a microsecond
+  #if (F_CPU == 16000000UL)
+    #define CLOCK_COUNTS_PER_MICROS 2
+  #elif (F_CPU == 8000000UL)
+    #define CLOCK_COUNTS_PER_MICROS 1
+  #else
+    #error "THREAD_CLOCK_TIMER requires F_CPU of 8 MHz or 16 MHz"
+  #endif
+
+static volatile uint32_t clock_overflows = 0;
+static bool clock_running = false;
+
+ISR(CLOCK_OVF_vect) {
+  clock_overflows++;
+}
+#endif // __AVR__ && THREAD_CLOCK_TIMER
+
+void ThreadClockInit(void) {
+#if defined(__AVR__) && (THREAD_CLOCK_TIMER != 0)
+  uint8_t sreg = SREG;
+  cli();
+  if (!clock_running) {
+    CLOCK_TCCRA = 0;
+    CLOCK_TCCRB = _BV(CLOCK_CS1);
+    CLOCK_TCNT = 0;
+    CLOCK_TIFR = _BV(CLOCK_TOV);
+    CLOCK_TIMSK |= _BV(CLOCK_TOIE);
+    clock_running = true;
+  }
+  SREG = sreg;
+#endif // __AVR__ && THREAD_CLOCK_TIMER
+}
+
+#if defined(__AVR__) && (THREAD_CLOCK_TIMER != 0)
+static uint32_t ClockRead(uint16_t *count) {
+  uint8_t sreg = SREG;
+  cli();
+  *count = CLOCK_TCNT;
+  uint32_t overflows = clock_overflows;
+  // An overflow that is still pending belongs to this reading if the count has already wrapped
+  if ((CLOCK_TIFR & _BV(CLOCK_TOV)) && *count < 0x8000)
+    overflows++;
+  SREG = sreg;
+  return overflows;
+}
+#elif defined(__AVR__)
+static uint32_t clock_last = 0;
+static uint32_t clock_wraps = 0;
+#else
+// Last 64-bit reading, whose upper half counts the wraps of micros()
+static uint64_t clock_last = 0;
+#endif // __AVR__ && THREAD_CLOCK_TIMER
+
+uint32_t ThreadClockMicros(void) {
+#if defined(__AVR__) && (THREAD_CLOCK_TIMER != 0)
+  uint16_t count;
+  uint32_t overflows = ClockRead(&count);
+
+  return overflows * (65536UL / CLOCK_COUNTS_PER_MICROS) + count / CLOCK_COUNTS_PER_MICROS;
+#else
+  return micros();
+#endif // __AVR__ && THREAD_CLOCK_TIMER
+}
+
+uint64_t ThreadClockMicros64(void) {
+#if defined(__AVR__) && (THREAD_CLOCK_TIMER != 0)
+  uint16_t count;
+  uint32_t overflows = ClockRead(&count);
+
+  return (uint64_t)overflows * (65536UL / CLOCK_COUNTS_PER_MICROS) + count / CLOCK_COUNTS_PER_MICROS;
+#elif defined(__AVR__)
+  // micros() wraps at 32 bits, so the wraps are counted between readings
+  uint8_t sreg = SREG;
+  cli();
+  uint32_t now = micros();
+  if (now < clock_last)
+    clock_wraps++;
+  clock_last = now;
+  uint32_t wraps = clock_wraps;
+  SREG = sreg;
+
+  return ((uint64_t)wraps << 32) | now;
+#else
+  // Threads of the host read concurrently, so the reading only moves forward
+  // if no other reading was stored since this one started
+  uint64_t last = __atomic_load_n(&clock_last, __ATOMIC_ACQUIRE);
+  for (;;) {
+    uint32_t now = micros();
+    uint64_t next = (last & ~(uint64_t)UINT32_MAX) | now;
+    if (next < last)
+      next += (uint64_t)1 << 32;
+    if (__atomic_compare_exchange_n(&clock_last, &last, next, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+      return next;
+  }
+#endif // __AVR__ && THREAD_CLOCK_TIMER
+}
+
+#endif // THREAD_CLOCK_ENABLED
\ No newline at end of file
@@ -0,0 +1,110 @@
+/**
+ ********************************************************************************
+ * @file    FreeRTOS_Wrapper_Deadline.c
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Deadline Monitor for Periodic Threads
+ * @version 1.0
+ * @date    2024-03-18
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#include "FreeRTOS_Wrapper_Deadline.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <Arduino_FreeRTOS.h>
+
+#include "FreeRTOS_Wrapper_Configuration.h"
+#include "FreeRTOS_Wrapper_Types.h"
+
+#if (THREAD_DEADLINE_MONITOR_THREADS > 0)
+
+typedef struct __deadline_entry {
+  thread_handle_t thread;
+  thread_period_t *period;
+} deadline_entry_t;
+
+static deadline_entry_t deadline_registry[THREAD_DEADLINE_MONITOR_THREADS];
+static uint32_t deadline_misses = 0;
+
+thread_return_t ThreadDeadlineRegister(thread_period_t *period, thread_time_t deadline_ms, thread_deadline_hook_t hook) {
+  if (period == NULL)
+    return THREAD_MEMORY_INVALID;
+
+  TickType_t deadline = (deadline_ms != 0) ? pdMS_TO_TICKS(deadline_ms) : period->period;
+  if (deadline == 0 || deadline > period->period)
+    return THREAD_PERIOD_INVALID;
+
+  thread_handle_t thread = xTaskGetCurrentTaskHandle();
+  thread_return_t retval = THREAD_MEMORY_INVALID;
+  taskENTER_CRITICAL();
+  period->deadline = deadline;
+  period->misses = 0;
+  period->skips = 0;
+  period->hook = hook;
+  period->waiting = false;
+  period->missed = false;
+  period->skip = false;
+
+  // An entry of the same thread is replaced before a free one is taken
+  deadline_entry_t *entry = NULL;
+  for (UBaseType_t i = 0; i < THREAD_DEADLINE_MONITOR_THREADS; i++) {
+    if (deadline_registry[i].thread == thread) {
+      entry = &deadline_registry[i];
+      break;
+    }
+    if (entry == NULL && deadline_registry[i].thread == NULL)
+      entry = &deadline_registry[i];
+  }
+  if (entry != NULL) {
+    entry->thread = thread;
+    entry->period = period;
+    retval = THREAD_SUCCESS;
+  }
+  taskEXIT_CRITICAL();
+  return retval;
+}
+
+uint32_t ThreadDeadlineMisses(void) {
+  taskENTER_CRITICAL();
+  uint32_t misses = deadline_misses;
+  taskEXIT_CRITICAL();
+
+  return misses;
+}
+
+void ThreadDeadlineCheck(thread_handle_t thread, thread_period_t *period, TickType_t now) {
+  // last_wake is the release of the running cycle until the thread waits for the next one
+  if (period->deadline == 0 || period->waiting || period->missed)
+    return;
+  if ((TickType_t)(now - period->last_wake) <= period->deadline)
+    return;
+
+  period->missed = true;
+  period->misses++;
+  deadline_misses++;
+  if (period->hook != NULL && period->hook(thread, period) == DEADLINE_SKIP)
+    period->skip = true;
+}
+
+void ThreadDeadlineSwitchedIn(void) {
+  TickType_t now = xTaskGetTickCountFromISR();
+  for (UBaseType_t i = 0; i < THREAD_DEADLINE_MONITOR_THREADS; i++)
+    if (deadline_registry[i].thread != NULL)
+      ThreadDeadlineCheck(deadline_registry[i].thread, deadline_registry[i].period, now);
+}
+
+void ThreadDeadlineDelete(void *thread) {
+  for (UBaseType_t i = 0; i < THREAD_DEADLINE_MONITOR_THREADS; i++) {
+    if (deadline_registry[i].thread == (thread_handle_t)thread) {
+      deadline_registry[i].thread = NULL;
+      deadline_registry[i].period = NULL;
+    }
+  }
+}
+
+#endif // THREAD_DEADLINE_MONITOR_THREADS
\ No newline at end of file
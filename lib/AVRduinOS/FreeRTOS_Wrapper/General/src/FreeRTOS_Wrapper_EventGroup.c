@@ -0,0 +1,133 @@
+/**
+ ********************************************************************************
+ * @file    FreeRTOS_Wrapper_EventGroup.c
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Event Group Wrappers for FreeRTOS
+ * @version 1.0
+ * @date    2024-03-18
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#include "FreeRTOS_Wrapper_EventGroup.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <Arduino_FreeRTOS.h>
+#include <event_groups.h>
+
+#include "FreeRTOS_Wrapper_Types.h"
+#include "FreeRTOS_Wrapper_Methods.h"
+
+static thread_return_t EventGroupCheck(thread_event_group_handle_t *group, thread_event_bits_t bits);
+
+thread_return_t CreateEventGroup(thread_event_group_handle_t *group) {
+  if (group == NULL || *group != NULL)
+    return THREAD_HANDLE_INVALID;
+
+  *group = xEventGroupCreate();
+  return (*group != NULL) ? THREAD_SUCCESS : THREAD_FAILURE_MEMORY_ALLOCATION;
+}
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+thread_return_t CreateStaticEventGroup(thread_event_group_handle_t *group, thread_event_group_static_memory_t *memory) {
+  if (group == NULL || *group != NULL)
+    return THREAD_HANDLE_INVALID;
+  if (memory == NULL)
+    return THREAD_MEMORY_INVALID;
+
+  *group = xEventGroupCreateStatic(memory);
+  return (*group != NULL) ? THREAD_SUCCESS : THREAD_FAILURE_UNKNOWN;
+}
+#endif // configSUPPORT_STATIC_ALLOCATION
+
+thread_return_t DeleteEventGroup(thread_event_group_handle_t *group) {
+  if (group == NULL || *group == NULL)
+    return THREAD_HANDLE_INVALID;
+
+  vEventGroupDelete(*group);
+  *group = NULL;
+  return THREAD_SUCCESS;
+}
+
+thread_return_t EventGroupSet(thread_event_group_handle_t *group, thread_event_bits_t bits) {
+  thread_return_t retval = EventGroupCheck(group, bits);
+  if (retval != THREAD_SUCCESS)
+    return retval;
+
+  xEventGroupSetBits(*group, bits);
+  return THREAD_SUCCESS;
+}
+
+thread_return_t EventGroupClear(thread_event_group_handle_t *group, thread_event_bits_t bits) {
+  thread_return_t retval = EventGroupCheck(group, bits);
+  if (retval != THREAD_SUCCESS)
+    return retval;
+
+  xEventGroupClearBits(*group, bits);
+  return THREAD_SUCCESS;
+}
+
+thread_event_bits_t EventGroupGet(thread_event_group_handle_t *group) {
+  if (group == NULL || *group == NULL)
+    return 0;
+
+  return xEventGroupGetBits(*group);
+}
+
+thread_return_t EventGroupWait(thread_event_group_handle_t *group, thread_event_bits_t bits, thread_event_wait_t wait, bool clear, thread_time_t max_wait, thread_event_bits_t *result) {
+  thread_return_t retval = EventGroupCheck(group, bits);
+  if (retval != THREAD_SUCCESS)
+    return retval;
+
+  thread_event_bits_t value = xEventGroupWaitBits(*group, bits, clear ? pdTRUE : pdFALSE, (BaseType_t)wait, pdMS_TO_TICKS(max_wait));
+  if (result != NULL)
+    *result = value;
+
+  // The kernel returns the bits either way, the wait decides which it was
+  bool met = (wait == WAIT_ALL) ? ((value & bits) == bits) : ((value & bits) != 0);
+  return met ? THREAD_SUCCESS : THREAD_EVENT_TIMEOUT;
+}
+
+thread_return_t EventGroupSync(thread_event_group_handle_t *group, thread_event_bits_t set_bits, thread_event_bits_t bits, thread_time_t max_wait, thread_event_bits_t *result) {
+  thread_return_t retval = EventGroupCheck(group, bits);
+  if (retval != THREAD_SUCCESS)
+    return retval;
+  if ((set_bits & ~THREAD_EVENT_BITS_ALL) != 0)
+    return THREAD_EVENT_BITS_INVALID;
+
+  thread_event_bits_t value = xEventGroupSync(*group, set_bits, bits, pdMS_TO_TICKS(max_wait));
+  if (result != NULL)
+    *result = value;
+
+  return ((value & bits) == bits) ? THREAD_SUCCESS : THREAD_EVENT_TIMEOUT;
+}
+
+#if (configUSE_TIMERS == 1) && (INCLUDE_xTimerPendFunctionCall == 1)
+thread_return_t EventGroupSetFromISR(thread_event_group_handle_t *group, thread_event_bits_t bits, thread_isr_yield_t *yield) {
+  thread_return_t retval = EventGroupCheck(group, bits);
+  if (retval != THREAD_SUCCESS)
+    return retval;
+
+  BaseType_t result = xEventGroupSetBitsFromISR(*group, bits, yield);
+  return QueueAssert(result, THREAD_FAILURE_QUEUE_BLOCKED);
+}
+#endif // configUSE_TIMERS
+
+thread_event_bits_t EventGroupGetFromISR(thread_event_group_handle_t *group) {
+  if (group == NULL || *group == NULL)
+    return 0;
+
+  return xEventGroupGetBitsFromISR(*group);
+}
+
+static thread_return_t EventGroupCheck(thread_event_group_handle_t *group, thread_event_bits_t bits) {
+  if (group == NULL || *group == NULL)
+    return THREAD_HANDLE_INVALID;
+  if (bits == 0 || (bits & ~THREAD_EVENT_BITS_ALL) != 0)
+    return THREAD_EVENT_BITS_INVALID;
+
+  return THREAD_SUCCESS;
+}
\ No newline at end of file
@@ -0,0 +1,148 @@
+/**
+ ********************************************************************************
+ * @file    FreeRTOS_Wrapper_Hooks.c
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Kernel Hooks for FreeRTOS Wrapper Features
+ * @version 1.0
+ * @date    2024-03-18
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+// FreeRTOSConfig.h must be read before the hooks header can apply its kernel options
+#include <Arduino_FreeRTOS.h>
+#include <queue.h>
+
+#include "FreeRTOS_Wrapper_Hooks.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "FreeRTOS_Wrapper_Configuration.h"
+#include "FreeRTOS_Wrapper_Types.h"
+#include "FreeRTOS_Wrapper_Deadline.h"
+#include "FreeRTOS_Wrapper_Stack.h"
+#include "FreeRTOS_Wrapper_Stats.h"
+#include "FreeRTOS_Wrapper_Tickless.h"
+#include "FreeRTOS_Wrapper_Trace.h"
+
+#if (THREAD_HOOKS_ENABLED == 1)
+
+#if (THREAD_HOOK_MAX_THREADS > 31)
+  #error "THREAD_HOOK_MAX_THREADS must be at most 31"
+#endif
+
+#if (configUSE_TRACE_FACILITY != 1)
+  #error "Wrapper features using kernel hooks require FreeRTOS_Wrapper_Hooks.h at the end of FreeRTOSConfig.h"
+#endif
+
+static void *hook_threads[THREAD_HOOK_MAX_THREADS + 1];
+static uint8_t hook_queues = 0;
+
+uint8_t ThreadHookId(void *thread) {
+  if (thread == NULL)
+    thread = xTaskGetCurrentTaskHandle();
+
+  UBaseType_t id = uxTaskGetTaskNumber((thread_handle_t)thread);
+  return (id <= THREAD_HOOK_MAX_THREADS) ? (uint8_t)id : 0;
+}
+
+void *ThreadHookThread(uint8_t id) {
+  return (id != 0 && id <= THREAD_HOOK_MAX_THREADS) ? hook_threads[id] : NULL;
+}
+
+void ThreadHookCreate(void *thread) {
+  uint8_t id = 0;
+  for (uint8_t i = 1; i <= THREAD_HOOK_MAX_THREADS; i++) {
+    if (hook_threads[i] == NULL) {
+      hook_threads[i] = thread;
+      id = i;
+      break;
+    }
+  }
+  vTaskSetTaskNumber((thread_handle_t)thread, id);
+
+#if (THREAD_STATS_ENABLED == 1)
+  ThreadStatsCreate(id);
+#endif // THREAD_STATS_ENABLED
+#if (THREAD_TRACE_ENABLED == 1)
+  ThreadTraceCreate(id);
+#endif // THREAD_TRACE_ENABLED
+}
+
+void ThreadHookDelete(void *thread) {
+  uint8_t id = ThreadHookId(thread);
+
+#if (THREAD_TRACE_ENABLED == 1)
+  ThreadTraceRecord(THREAD_TRACE_DELETE, id);
+#endif // THREAD_TRACE_ENABLED
+#if (THREAD_STACK_MONITOR_THREADS > 0)
+  ThreadStackUnregister((thread_handle_t)thread);
+#endif // THREAD_STACK_MONITOR_THREADS
+#if (THREAD_DEADLINE_MONITOR_THREADS > 0)
+  ThreadDeadlineDelete(thread);
+#endif // THREAD_DEADLINE_MONITOR_THREADS
+  if (id != 0)
+    hook_threads[id] = NULL;
+}
+
+void ThreadHookSwitchedIn(void) {
+#if (THREAD_STATS_ENABLED == 1) || (THREAD_TRACE_ENABLED == 1)
+  uint8_t id = ThreadHookId(NULL);
+#endif // THREAD_STATS_ENABLED || THREAD_TRACE_ENABLED
+
+#if (THREAD_STATS_ENABLED == 1)
+  ThreadStatsSwitchedIn(id);
+#endif // THREAD_STATS_ENABLED
+#if (THREAD_TRACE_ENABLED == 1)
+  ThreadTraceRecord(THREAD_TRACE_SWITCHED_IN, id);
+#endif // THREAD_TRACE_ENABLED
+#if (THREAD_TICKLESS_IDLE_ENABLED == 1)
+  ThreadTicklessSwitchedIn();
+#endif // THREAD_TICKLESS_IDLE_ENABLED
+#if (THREAD_DEADLINE_MONITOR_THREADS > 0)
+  ThreadDeadlineSwitchedIn();
+#endif // THREAD_DEADLINE_MONITOR_THREADS
+}
+
+void ThreadHookSwitchedOut(void) {
+#if (THREAD_TRACE_ENABLED == 1)
+  ThreadTraceRecord(THREAD_TRACE_SWITCHED_OUT, ThreadHookId(NULL));
+#endif // THREAD_TRACE_ENABLED
+}
+
+void ThreadHookTask(uint8_t event, void *thread) {
+#if (THREAD_TRACE_ENABLED == 1)
+  ThreadTraceRecord(event, ThreadHookId(thread));
+#endif // THREAD_TRACE_ENABLED
+  (void)event;
+  (void)thread;
+}
+
+void ThreadHookQueueCreate(void *queue) {
+  // Queue numbers wrap after 255 queues, which only matters to the trace
+  vQueueSetQueueNumber((thread_queue_handle_t)queue, ++hook_queues);
+
+#if (THREAD_TRACE_ENABLED == 1)
+  ThreadTraceRecord(THREAD_TRACE_QUEUE_CREATE, hook_queues);
+#endif // THREAD_TRACE_ENABLED
+}
+
+void ThreadHookQueue(uint8_t event, void *queue) {
+#if (THREAD_TRACE_ENABLED == 1)
+  ThreadTraceRecord(event, (uint8_t)uxQueueGetQueueNumber((thread_queue_handle_t)queue));
+#endif // THREAD_TRACE_ENABLED
+  (void)event;
+  (void)queue;
+}
+
+void ThreadHookEvent(uint8_t event, uint8_t object) {
+#if (THREAD_TRACE_ENABLED == 1)
+  ThreadTraceRecord(event, object);
+#endif // THREAD_TRACE_ENABLED
+  (void)event;
+  (void)object;
+}
+
+#endif // THREAD_HOOKS_ENABLED
\ No newline at end of file
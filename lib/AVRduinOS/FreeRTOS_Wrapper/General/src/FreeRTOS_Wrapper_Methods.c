@@ -17,11 +17,30 @@
 
 #include <Arduino_FreeRTOS.h>
 
+#include "FreeRTOS_Wrapper_Configuration.h"
 #include "FreeRTOS_Wrapper_Types.h"
+#include "FreeRTOS_Wrapper_Clock.h"
+#include "FreeRTOS_Wrapper_Deadline.h"
+#include "FreeRTOS_Wrapper_Stack.h"
 
-thread_return_t ThreadAssert(BaseType_t return_in);
+#if defined(__AVR__)
+  #include <setjmp.h>
+  #include <avr/interrupt.h>
+  #include <avr/wdt.h>
+
+  #if !defined(portUSE_WDTO)
+    #error "StopThreadScheduler requires the watchdog tick of the port"
+  #endif // portUSE_WDTO
+
+// Where StopThreadScheduler returns to, as vPortEndScheduler does nothing here
+static jmp_buf scheduler_exit;
+#endif // __AVR__
 
 thread_function_t ConfigureThread(const char *thread_name, thread_loop_t function, thread_priority_t priority, thread_stack_size_t stack_size) {
+  return ConfigureThreadWithParameters(thread_name, function, priority, stack_size, NULL);
+}
+
+thread_function_t ConfigureThreadWithParameters(const char *thread_name, thread_loop_t function, thread_priority_t priority, thread_stack_size_t stack_size, thread_parameters_t parameters) {
   if (thread_name == NULL) 
     return (thread_function_t) { .valid = THREAD_NAME_NOT_PROVIDED };
   if (strlen(thread_name) > configMAX_TASK_NAME_LEN) 
@@ -30,7 +49,7 @@ thread_function_t ConfigureThread(const char *thread_name, thread_loop_t functio
     return (thread_function_t) { .valid = THREAD_NAME_NOT_PROVIDED };
   if (stack_size == 0) 
     return (thread_function_t) { .valid = THREAD_STACK_SIZE_INVALID };
-  if (priority > THREAD_PRIORITY_HIGH || priority < THREAD_PRIORITY_LOW) 
+  if (priority > THREAD_PRIORITY_MAX || priority < THREAD_PRIORITY_LOW) 
     return (thread_function_t) { .valid = THREAD_PRIORITY_INVALID };        
 
   return (thread_function_t) {
@@ -38,10 +57,48 @@ thread_function_t ConfigureThread(const char *thread_name, thread_loop_t functio
     .priority = priority,
     .stack_size = stack_size,
     .thread_name = thread_name,
+    .parameters = parameters,
     .valid = THREAD_STRUCT_VALID,
   };
 }
 
+static bool RateMonotonicFirst(const thread_time_t *periods, UBaseType_t index) {
+  for (UBaseType_t i = 0; i < index; i++)
+    if (periods[i] == periods[index])
+      return false;
+  return true;
+}
+
+thread_return_t ThreadRateMonotonic(thread_function_t *threads, const thread_time_t *periods, UBaseType_t count, thread_priority_t highest) {
+  if (threads == NULL || periods == NULL)
+    return THREAD_MEMORY_INVALID;
+  if (highest > THREAD_PRIORITY_MAX || highest < THREAD_PRIORITY_LOW)
+    return THREAD_FUNCTION_INVALID;
+  for (UBaseType_t i = 0; i < count; i++) {
+    if (threads[i].valid != THREAD_STRUCT_VALID)
+      return THREAD_FUNCTION_INVALID;
+    if (periods[i] == 0)
+      return THREAD_PERIOD_INVALID;
+  }
+
+  // Each distinct period takes one level, counted at its first occurrence
+  UBaseType_t distinct = 0;
+  for (UBaseType_t i = 0; i < count; i++)
+    if (RateMonotonicFirst(periods, i))
+      distinct++;
+  if (distinct > (UBaseType_t)(highest - THREAD_PRIORITY_LOW + 1))
+    return THREAD_PRIORITY_EXHAUSTED;
+
+  for (UBaseType_t i = 0; i < count; i++) {
+    UBaseType_t rank = 0;
+    for (UBaseType_t j = 0; j < count; j++)
+      if (periods[j] < periods[i] && RateMonotonicFirst(periods, j))
+        rank++;
+    threads[i].priority = (thread_priority_t)(highest - rank);
+  }
+  return THREAD_SUCCESS;
+}
+
 thread_return_t CreateThread(thread_handle_t *thread, thread_function_t function) {
   if (thread == NULL) 
     return THREAD_HANDLE_INVALID;
@@ -50,10 +107,74 @@ thread_return_t CreateThread(thread_handle_t *thread, thread_function_t function
   if (function.valid != THREAD_STRUCT_VALID) 
     return THREAD_FUNCTION_INVALID;
 
-  BaseType_t retval = xTaskCreate(function.function, function.thread_name, function.stack_size, NULL, function.priority, thread);
+  configSTACK_DEPTH_TYPE stack_size = THREAD_STACK_DEPTH(function.stack_size);
+#if (THREAD_STACK_MONITOR_THREADS > 0)
+  // A higher priority thread must not run, and maybe delete itself, before it is registered
+  vTaskSuspendAll();
+#endif // THREAD_STACK_MONITOR_THREADS
+  BaseType_t retval = xTaskCreate(function.function, function.thread_name, stack_size, function.parameters, function.priority, thread);
+#if (THREAD_STACK_MONITOR_THREADS > 0)
+  if (retval == pdPASS)
+    ThreadStackRegister(*thread, stack_size);
+  xTaskResumeAll();
+#endif // THREAD_STACK_MONITOR_THREADS
   return ThreadAssert(retval);
 }
 
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+thread_return_t CreateStaticThread(thread_handle_t *thread, thread_function_t function, thread_static_memory_t *memory) {
+  if (thread == NULL)
+    return THREAD_HANDLE_INVALID;
+  if (*thread != NULL)
+    return THREAD_HANDLE_INVALID;
+  if (function.valid != THREAD_STRUCT_VALID)
+    return THREAD_FUNCTION_INVALID;
+  if (memory == NULL || memory->stack == NULL || memory->control_block == NULL)
+    return THREAD_MEMORY_INVALID;
+
+  // The kernel is given the raised depth, so the memory must hold that rather than the request
+  configSTACK_DEPTH_TYPE stack_size = THREAD_STACK_DEPTH(function.stack_size);
+  if (memory->stack_size < stack_size)
+    return THREAD_MEMORY_INVALID;
+
+#if (THREAD_STACK_MONITOR_THREADS > 0)
+  vTaskSuspendAll();
+#endif // THREAD_STACK_MONITOR_THREADS
+  *thread = xTaskCreateStatic(function.function, function.thread_name, stack_size, function.parameters, function.priority, memory->stack, memory->control_block);
+#if (THREAD_STACK_MONITOR_THREADS > 0)
+  if (*thread != NULL)
+    ThreadStackRegister(*thread, stack_size);
+  xTaskResumeAll();
+#endif // THREAD_STACK_MONITOR_THREADS
+  return (*thread != NULL) ? THREAD_SUCCESS : THREAD_FAILURE_UNKNOWN;
+}
+
+#if (configKERNEL_PROVIDED_STATIC_MEMORY != 1)
+// Weak, so a port or sketch that already supplies the idle and timer memory keeps its own
+void vApplicationGetIdleTaskMemory(StaticTask_t **control_block, StackType_t **stack, configSTACK_DEPTH_TYPE *stack_size) __attribute__((weak));
+void vApplicationGetIdleTaskMemory(StaticTask_t **control_block, StackType_t **stack, configSTACK_DEPTH_TYPE *stack_size) {
+  static StaticTask_t idle_control_block;
+  static StackType_t idle_stack[configMINIMAL_STACK_SIZE];
+
+  *control_block = &idle_control_block;
+  *stack = idle_stack;
+  *stack_size = configMINIMAL_STACK_SIZE;
+}
+
+#if (configUSE_TIMERS == 1)
+void vApplicationGetTimerTaskMemory(StaticTask_t **control_block, StackType_t **stack, configSTACK_DEPTH_TYPE *stack_size) __attribute__((weak));
+void vApplicationGetTimerTaskMemory(StaticTask_t **control_block, StackType_t **stack, configSTACK_DEPTH_TYPE *stack_size) {
+  static StaticTask_t timer_control_block;
+  static StackType_t timer_stack[configTIMER_TASK_STACK_DEPTH];
+
+  *control_block = &timer_control_block;
+  *stack = timer_stack;
+  *stack_size = configTIMER_TASK_STACK_DEPTH;
+}
+#endif // configUSE_TIMERS
+#endif // configKERNEL_PROVIDED_STATIC_MEMORY
+#endif // configSUPPORT_STATIC_ALLOCATION
+
 thread_return_t DeleteThread(thread_handle_t *thread) {
   if (thread == NULL) 
     return THREAD_HANDLE_INVALID;
@@ -76,6 +197,83 @@ thread_return_t ThreadDeltaDelay(thread_time_t reference_time, thread_time_t del
   return ThreadAssert(retval);
 }
 
+thread_return_t ThreadPeriodInit(thread_period_t *period, thread_time_t period_ms) {
+  if (period == NULL)
+    return THREAD_FAILURE_UNKNOWN;
+  if (pdMS_TO_TICKS(period_ms) == 0)
+    return THREAD_PERIOD_INVALID;
+
+  *period = (thread_period_t) {
+    .last_wake = xTaskGetTickCount(),
+    .period = pdMS_TO_TICKS(period_ms),
+    .cycles = 0,
+    .overruns = 0,
+    .worst_lateness = 0,
+#if (THREAD_DEADLINE_MONITOR_THREADS > 0)
+    .deadline = 0,
+    .misses = 0,
+    .skips = 0,
+    .hook = NULL,
+    .waiting = false,
+    .missed = false,
+    .skip = false,
+#endif // THREAD_DEADLINE_MONITOR_THREADS
+  };
+  return THREAD_SUCCESS;
+}
+
+thread_return_t ThreadPeriodWait(thread_period_t *period) {
+  if (period == NULL)
+    return THREAD_FAILURE_UNKNOWN;
+  if (period->period == 0)
+    return THREAD_PERIOD_INVALID;
+
+  // Unsigned arithmetic keeps the lateness correct across tick count overflow
+  TickType_t elapsed = xTaskGetTickCount() - period->last_wake;
+  TickType_t release = period->period;
+  period->cycles++;
+
+#if (THREAD_DEADLINE_MONITOR_THREADS > 0)
+  // The switch hook stops checking the cycle once it waits for the next release
+  bool missed = false;
+  if (period->deadline != 0) {
+    taskENTER_CRITICAL();
+    ThreadDeadlineCheck(xTaskGetCurrentTaskHandle(), period, period->last_wake + elapsed);
+    missed = period->missed;
+    bool skip = period->skip;
+    period->missed = false;
+    period->skip = false;
+    period->waiting = true;
+    taskEXIT_CRITICAL();
+
+    if (skip) {
+      period->last_wake += period->period;
+      release += period->period;
+      period->skips++;
+    }
+  }
+#endif // THREAD_DEADLINE_MONITOR_THREADS
+
+  xTaskDelayUntil(&period->last_wake, period->period);
+#if (THREAD_DEADLINE_MONITOR_THREADS > 0)
+  period->waiting = false;
+#endif // THREAD_DEADLINE_MONITOR_THREADS
+
+  // A cycle ending on the release tick is on time, though the kernel does not delay it
+  if (elapsed > release) {
+    thread_time_t lateness = THREAD_MILLISEC * (elapsed - release);
+    if (lateness > period->worst_lateness)
+      period->worst_lateness = lateness;
+    period->overruns++;
+    return THREAD_PERIOD_OVERRUN;
+  }
+#if (THREAD_DEADLINE_MONITOR_THREADS > 0)
+  if (missed)
+    return THREAD_PERIOD_DEADLINE_MISSED;
+#endif // THREAD_DEADLINE_MONITOR_THREADS
+  return THREAD_SUCCESS;
+}
+
 thread_return_t StartThread(thread_handle_t thread) {
   if (thread == NULL) 
     return THREAD_HANDLE_INVALID;
@@ -96,6 +294,16 @@ thread_time_t ThreadTime() {
   return THREAD_MILLISEC * xTaskGetTickCount();
 }
 
+#if (THREAD_TIME_MICROS_ENABLED == 1)
+uint32_t ThreadTimeMicros() {
+  return ThreadClockMicros();
+}
+
+uint64_t ThreadTimeMicros64() {
+  return ThreadClockMicros64();
+}
+#endif // THREAD_TIME_MICROS_ENABLED
+
 void EnterThreadCritical() {
   taskENTER_CRITICAL();
 }
@@ -133,6 +341,36 @@ thread_return_t ThreadNoticeQueryIndex(thread_handle_t *thread, thread_notice_gi
   return ThreadAssert(retval);
 }
 
+thread_return_t ThreadNoticeFromISR(thread_handle_t *thread, thread_notice_give_action_t action, thread_notice_value_t value, thread_isr_yield_t *yield) {
+  return ThreadNoticeIndexFromISR(thread, action, value, 0, yield);
+}
+
+thread_return_t ThreadNoticeIndexFromISR(thread_handle_t *thread, thread_notice_give_action_t action, thread_notice_value_t value, thread_notice_index_t index, thread_isr_yield_t *yield) {
+  if (thread == NULL)
+    return THREAD_HANDLE_INVALID;
+  if (index >= configTASK_NOTIFICATION_ARRAY_ENTRIES)
+    return THREAD_NOTICE_INDEX_INVALID;
+
+  BaseType_t retval = xTaskNotifyIndexedFromISR(*thread, index, value, action, yield);
+  return ThreadAssert(retval);
+}
+
+thread_return_t ThreadNoticeQueryFromISR(thread_handle_t *thread, thread_notice_give_action_t action, thread_notice_value_t value, thread_notice_value_t *previous_value, thread_isr_yield_t *yield) {
+  return ThreadNoticeQueryIndexFromISR(thread, action, value, previous_value, 0, yield);
+}
+
+thread_return_t ThreadNoticeQueryIndexFromISR(thread_handle_t *thread, thread_notice_give_action_t action, thread_notice_value_t value, thread_notice_value_t *previous_value, thread_notice_index_t index, thread_isr_yield_t *yield) {
+  if (thread == NULL)
+    return THREAD_HANDLE_INVALID;
+  if (previous_value == NULL)
+    return THREAD_FAILURE_UNKNOWN;
+  if (index >= configTASK_NOTIFICATION_ARRAY_ENTRIES)
+    return THREAD_NOTICE_INDEX_INVALID;
+
+  BaseType_t retval = xTaskNotifyAndQueryIndexedFromISR(*thread, index, value, action, previous_value, yield);
+  return ThreadAssert(retval);
+}
+
 thread_return_t ThreadWaitforNotice(thread_notice_value_t *value, thread_notice_value_t entry_clear_bits, thread_notice_value_t exit_clear_bits, thread_time_t max_wait) {
   return ThreadWaitforNoticeIndex(value, entry_clear_bits, exit_clear_bits, max_wait, 0);
 }
@@ -161,6 +399,21 @@ thread_return_t ThreadNoticeGiveIndex(thread_handle_t *thread, thread_notice_ind
   return ThreadAssert(retval);
 }
 
+thread_return_t ThreadNoticeGiveFromISR(thread_handle_t *thread, thread_isr_yield_t *yield) {
+  return ThreadNoticeGiveIndexFromISR(thread, 0, yield);
+}
+
+thread_return_t ThreadNoticeGiveIndexFromISR(thread_handle_t *thread, thread_notice_index_t index, thread_isr_yield_t *yield) {
+  if (thread == NULL)
+    return THREAD_HANDLE_INVALID;
+  if (index >= configTASK_NOTIFICATION_ARRAY_ENTRIES)
+    return THREAD_NOTICE_INDEX_INVALID;
+
+  // Giving only increments the value, so the kernel has nothing to report
+  vTaskNotifyGiveIndexedFromISR(*thread, index, yield);
+  return THREAD_SUCCESS;
+}
+
 thread_notice_value_t ThreadNoticeTake(thread_notice_take_action_t action, thread_time_t max_wait) {
   return ThreadNoticeTakeIndex(action, max_wait, 0);
 }
@@ -200,11 +453,26 @@ thread_notice_value_t ThreadNoticeValueClearIndex(thread_handle_t *thread, threa
 }
 
 void StartThreadScheduler() {
+#if defined(__AVR__)
+  if (setjmp(scheduler_exit) != 0) {
+    // vTaskEndScheduler left interrupts off, but millis() and Serial need them
+    sei();
+    return;
+  }
+#endif // __AVR__
+#if (THREAD_TIME_MICROS_ENABLED == 1)
+  ThreadClockInit();
+#endif // THREAD_TIME_MICROS_ENABLED
   vTaskStartScheduler();
 }
 
 void StopThreadScheduler() {
   vTaskEndScheduler();
+#if defined(__AVR__)
+  // vPortEndScheduler leaves the tick armed, which would keep switching threads
+  wdt_disable();
+  longjmp(scheduler_exit, 1);
+#endif // __AVR__
 }
 
 void SuspendThreadScheduler() {
@@ -219,6 +487,18 @@ thread_handle_t GetSelfThreadHandle() {
   return xTaskGetCurrentTaskHandle();
 }
 
+void ThreadYieldFromISR(thread_isr_yield_t yield) {
+  // The AVR port's portYIELD_FROM_ISR takes no flag, other ports test it themselves
+#if defined(portEND_SWITCHING_ISR)
+  portEND_SWITCHING_ISR(yield);
+#elif defined(__AVR__)
+  if (yield != pdFALSE)
+    portYIELD_FROM_ISR();
+#else
+  portYIELD_FROM_ISR(yield);
+#endif // portEND_SWITCHING_ISR
+}
+
 thread_return_t ThreadAssert(BaseType_t return_in) {
   switch (return_in) {
     case pdPASS:
@@ -232,4 +512,10 @@ thread_return_t ThreadAssert(BaseType_t return_in) {
     default:
       return THREAD_FAILURE_UNKNOWN;
   }
+}
+
+thread_return_t QueueAssert(BaseType_t return_in, thread_return_t failure) {
+  if (return_in == errQUEUE_FULL || return_in == errQUEUE_EMPTY)
+    return failure;
+  return ThreadAssert(return_in);
 }
\ No newline at end of file
@@ -0,0 +1,229 @@
+/**
+ ********************************************************************************
+ * @file    FreeRTOS_Wrapper_Mutex.c
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Mutex Wrappers for FreeRTOS
+ * @version 1.0
+ * @date    2024-03-18
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#include "FreeRTOS_Wrapper_Mutex.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <Arduino_FreeRTOS.h>
+#include <semphr.h>
+
+#include "FreeRTOS_Wrapper_Configuration.h"
+#include "FreeRTOS_Wrapper_Types.h"
+#include "FreeRTOS_Wrapper_Methods.h"
+#include "FreeRTOS_Wrapper_Clock.h"
+
+static thread_return_t MutexInit(thread_mutex_t *mutex, thread_mutex_handle_t handle, bool recursive, thread_return_t failure);
+static BaseType_t MutexTake(thread_mutex_t *mutex, TickType_t ticks);
+static BaseType_t MutexGive(thread_mutex_t *mutex);
+#if (THREAD_MUTEX_STATS_ENABLED == 1)
+static bool MutexInverted(thread_mutex_t *mutex);
+#endif // THREAD_MUTEX_STATS_ENABLED
+
+thread_return_t CreateMutex(thread_mutex_t *mutex) {
+  if (mutex == NULL)
+    return THREAD_HANDLE_INVALID;
+  if (mutex->handle != NULL)
+    return THREAD_HANDLE_INVALID;
+
+  return MutexInit(mutex, xSemaphoreCreateMutex(), false, THREAD_FAILURE_MEMORY_ALLOCATION);
+}
+
+#if (configUSE_RECURSIVE_MUTEXES == 1)
+thread_return_t CreateRecursiveMutex(thread_mutex_t *mutex) {
+  if (mutex == NULL)
+    return THREAD_HANDLE_INVALID;
+  if (mutex->handle != NULL)
+    return THREAD_HANDLE_INVALID;
+
+  return MutexInit(mutex, xSemaphoreCreateRecursiveMutex(), true, THREAD_FAILURE_MEMORY_ALLOCATION);
+}
+#endif // configUSE_RECURSIVE_MUTEXES
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+thread_return_t CreateStaticMutex(thread_mutex_t *mutex, thread_mutex_static_memory_t *memory) {
+  if (mutex == NULL)
+    return THREAD_HANDLE_INVALID;
+  if (mutex->handle != NULL)
+    return THREAD_HANDLE_INVALID;
+  if (memory == NULL)
+    return THREAD_MEMORY_INVALID;
+
+  return MutexInit(mutex, xSemaphoreCreateMutexStatic(memory), false, THREAD_FAILURE_UNKNOWN);
+}
+
+#if (configUSE_RECURSIVE_MUTEXES == 1)
+thread_return_t CreateStaticRecursiveMutex(thread_mutex_t *mutex, thread_mutex_static_memory_t *memory) {
+  if (mutex == NULL)
+    return THREAD_HANDLE_INVALID;
+  if (mutex->handle != NULL)
+    return THREAD_HANDLE_INVALID;
+  if (memory == NULL)
+    return THREAD_MEMORY_INVALID;
+
+  return MutexInit(mutex, xSemaphoreCreateRecursiveMutexStatic(memory), true, THREAD_FAILURE_UNKNOWN);
+}
+#endif // configUSE_RECURSIVE_MUTEXES
+#endif // configSUPPORT_STATIC_ALLOCATION
+
+thread_return_t DeleteMutex(thread_mutex_t *mutex) {
+  if (mutex == NULL || mutex->handle == NULL)
+    return THREAD_HANDLE_INVALID;
+
+  vSemaphoreDelete(mutex->handle);
+  mutex->handle = NULL;
+  return THREAD_SUCCESS;
+}
+
+thread_return_t MutexLock(thread_mutex_t *mutex, thread_time_t max_wait) {
+  if (mutex == NULL || mutex->handle == NULL)
+    return THREAD_HANDLE_INVALID;
+
+#if (THREAD_MUTEX_STATS_ENABLED == 1)
+  // A first attempt without waiting tells a contended lock from a free one
+  uint32_t start = ThreadClockMicros();
+  bool contended = false;
+  bool inverted = false;
+  BaseType_t retval = MutexTake(mutex, 0);
+  if (retval != pdPASS) {
+    contended = true;
+    inverted = MutexInverted(mutex);
+    if (max_wait > 0)
+      retval = MutexTake(mutex, pdMS_TO_TICKS(max_wait));
+  }
+  uint32_t now = ThreadClockMicros();
+
+  taskENTER_CRITICAL();
+  if (contended)
+    mutex->stats.contentions++;
+  if (inverted)
+    mutex->stats.inversions++;
+  if (retval != pdPASS) {
+    mutex->stats.timeouts++;
+    taskEXIT_CRITICAL();
+    return THREAD_MUTEX_TIMEOUT;
+  }
+  mutex->stats.locks++;
+  if (mutex->depth == 0) {
+    if (now - start > mutex->stats.wait_max)
+      mutex->stats.wait_max = now - start;
+    mutex->taken_at = now;
+  }
+#else
+  BaseType_t retval = MutexTake(mutex, pdMS_TO_TICKS(max_wait));
+  if (retval != pdPASS)
+    return THREAD_MUTEX_TIMEOUT;
+
+  taskENTER_CRITICAL();
+#endif // THREAD_MUTEX_STATS_ENABLED
+  mutex->holder = xTaskGetCurrentTaskHandle();
+  mutex->depth++;
+  taskEXIT_CRITICAL();
+  return THREAD_SUCCESS;
+}
+
+thread_return_t MutexUnlock(thread_mutex_t *mutex) {
+  if (mutex == NULL || mutex->handle == NULL)
+    return THREAD_HANDLE_INVALID;
+  if (MutexHolder(mutex) != xTaskGetCurrentTaskHandle())
+    return THREAD_MUTEX_NOT_HOLDER;
+
+  taskENTER_CRITICAL();
+  mutex->depth--;
+  if (mutex->depth == 0) {
+    mutex->holder = NULL;
+#if (THREAD_MUTEX_STATS_ENABLED == 1)
+    uint32_t held = ThreadClockMicros() - mutex->taken_at;
+    mutex->stats.hold_total += held;
+    if (held > mutex->stats.hold_max)
+      mutex->stats.hold_max = held;
+#endif // THREAD_MUTEX_STATS_ENABLED
+  }
+  taskEXIT_CRITICAL();
+
+  BaseType_t retval = MutexGive(mutex);
+  return ThreadAssert(retval);
+}
+
+thread_handle_t MutexHolder(thread_mutex_t *mutex) {
+  if (mutex == NULL || mutex->handle == NULL)
+    return NULL;
+
+  // The handle is wider than the AVR can read in one instruction
+  taskENTER_CRITICAL();
+  thread_handle_t holder = mutex->holder;
+  taskEXIT_CRITICAL();
+
+  return holder;
+}
+
+#if (THREAD_MUTEX_STATS_ENABLED == 1)
+thread_return_t MutexStatsGet(thread_mutex_t *mutex, thread_mutex_stats_t *stats) {
+  if (mutex == NULL || mutex->handle == NULL)
+    return THREAD_HANDLE_INVALID;
+  if (stats == NULL)
+    return THREAD_MEMORY_INVALID;
+
+  taskENTER_CRITICAL();
+  *stats = mutex->stats;
+  taskEXIT_CRITICAL();
+  return THREAD_SUCCESS;
+}
+
+thread_return_t MutexStatsClear(thread_mutex_t *mutex) {
+  if (mutex == NULL || mutex->handle == NULL)
+    return THREAD_HANDLE_INVALID;
+
+  taskENTER_CRITICAL();
+  memset(&mutex->stats, 0, sizeof(mutex->stats));
+  taskEXIT_CRITICAL();
+  return THREAD_SUCCESS;
+}
+
+static bool MutexInverted(thread_mutex_t *mutex) {
+  thread_handle_t holder = MutexHolder(mutex);
+
+  return (holder != NULL) && (uxTaskPriorityGet(holder) < uxTaskPriorityGet(NULL));
+}
+#endif // THREAD_MUTEX_STATS_ENABLED
+
+static thread_return_t MutexInit(thread_mutex_t *mutex, thread_mutex_handle_t handle, bool recursive, thread_return_t failure) {
+  mutex->handle = handle;
+  mutex->holder = NULL;
+  mutex->depth = 0;
+  mutex->recursive = recursive;
+#if (THREAD_MUTEX_STATS_ENABLED == 1)
+  mutex->taken_at = 0;
+  memset(&mutex->stats, 0, sizeof(mutex->stats));
+  ThreadClockInit();
+#endif // THREAD_MUTEX_STATS_ENABLED
+
+  return (handle != NULL) ? THREAD_SUCCESS : failure;
+}
+
+static BaseType_t MutexTake(thread_mutex_t *mutex, TickType_t ticks) {
+#if (configUSE_RECURSIVE_MUTEXES == 1)
+  if (mutex->recursive)
+    return xSemaphoreTakeRecursive(mutex->handle, ticks);
+#endif // configUSE_RECURSIVE_MUTEXES
+  return xSemaphoreTake(mutex->handle, ticks);
+}
+
+static BaseType_t MutexGive(thread_mutex_t *mutex) {
+#if (configUSE_RECURSIVE_MUTEXES == 1)
+  if (mutex->recursive)
+    return xSemaphoreGiveRecursive(mutex->handle);
+#endif // configUSE_RECURSIVE_MUTEXES
+  return xSemaphoreGive(mutex->handle);
+}
\ No newline at end of file
@@ -0,0 +1,215 @@
+/**
+ ********************************************************************************
+ * @file    FreeRTOS_Wrapper_Queue.c
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Queue Wrappers for FreeRTOS
+ * @version 1.0
+ * @date    2024-03-18
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#include "FreeRTOS_Wrapper_Queue.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <Arduino_FreeRTOS.h>
+#include <queue.h>
+
+#include "FreeRTOS_Wrapper_Types.h"
+#include "FreeRTOS_Wrapper_Methods.h"
+
+thread_return_t CreateQueue(thread_queue_handle_t *queue, thread_queue_length_t length, thread_queue_item_size_t item_size) {
+  if (queue == NULL)
+    return THREAD_HANDLE_INVALID;
+  if (*queue != NULL)
+    return THREAD_HANDLE_INVALID;
+  if (length == 0 || item_size == 0)
+    return THREAD_QUEUE_INVALID;
+
+  *queue = xQueueCreate(length, item_size);
+  return (*queue != NULL) ? THREAD_SUCCESS : THREAD_FAILURE_MEMORY_ALLOCATION;
+}
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+thread_return_t CreateStaticQueue(thread_queue_handle_t *queue, thread_queue_static_memory_t *memory) {
+  if (queue == NULL)
+    return THREAD_HANDLE_INVALID;
+  if (*queue != NULL)
+    return THREAD_HANDLE_INVALID;
+  if (memory == NULL || memory->storage == NULL || memory->control_block == NULL)
+    return THREAD_MEMORY_INVALID;
+  if (memory->length == 0 || memory->item_size == 0)
+    return THREAD_QUEUE_INVALID;
+
+  *queue = xQueueCreateStatic(memory->length, memory->item_size, memory->storage, memory->control_block);
+  return (*queue != NULL) ? THREAD_SUCCESS : THREAD_FAILURE_UNKNOWN;
+}
+#endif // configSUPPORT_STATIC_ALLOCATION
+
+thread_return_t DeleteQueue(thread_queue_handle_t *queue) {
+  if (queue == NULL)
+    return THREAD_HANDLE_INVALID;
+  if (*queue == NULL)
+    return THREAD_HANDLE_INVALID;
+
+  vQueueDelete(*queue);
+  *queue = NULL;
+  return THREAD_SUCCESS;
+}
+
+thread_return_t QueueSend(thread_queue_handle_t *queue, const void *item, thread_time_t max_wait) {
+  if (queue == NULL || *queue == NULL)
+    return THREAD_HANDLE_INVALID;
+  if (item == NULL)
+    return THREAD_MEMORY_INVALID;
+
+  BaseType_t retval = xQueueSendToBack(*queue, item, pdMS_TO_TICKS(max_wait));
+  return QueueAssert(retval, THREAD_QUEUE_FULL);
+}
+
+thread_return_t QueueSendFront(thread_queue_handle_t *queue, const void *item, thread_time_t max_wait) {
+  if (queue == NULL || *queue == NULL)
+    return THREAD_HANDLE_INVALID;
+  if (item == NULL)
+    return THREAD_MEMORY_INVALID;
+
+  BaseType_t retval = xQueueSendToFront(*queue, item, pdMS_TO_TICKS(max_wait));
+  return QueueAssert(retval, THREAD_QUEUE_FULL);
+}
+
+thread_return_t QueueReceive(thread_queue_handle_t *queue, void *item, thread_time_t max_wait) {
+  if (queue == NULL || *queue == NULL)
+    return THREAD_HANDLE_INVALID;
+  if (item == NULL)
+    return THREAD_MEMORY_INVALID;
+
+  BaseType_t retval = xQueueReceive(*queue, item, pdMS_TO_TICKS(max_wait));
+  return QueueAssert(retval, THREAD_QUEUE_EMPTY);
+}
+
+thread_return_t QueuePeek(thread_queue_handle_t *queue, void *item, thread_time_t max_wait) {
+  if (queue == NULL || *queue == NULL)
+    return THREAD_HANDLE_INVALID;
+  if (item == NULL)
+    return THREAD_MEMORY_INVALID;
+
+  BaseType_t retval = xQueuePeek(*queue, item, pdMS_TO_TICKS(max_wait));
+  return QueueAssert(retval, THREAD_QUEUE_EMPTY);
+}
+
+thread_queue_length_t QueueCount(thread_queue_handle_t *queue) {
+  if (queue == NULL || *queue == NULL)
+    return 0;
+
+  return uxQueueMessagesWaiting(*queue);
+}
+
+thread_return_t CreateZeroCopyQueue(thread_zero_copy_queue_t *queue, thread_queue_length_t length, thread_queue_item_size_t block_size, void *storage) {
+  if (queue == NULL)
+    return THREAD_HANDLE_INVALID;
+  if (queue->queue != NULL || queue->free_blocks != NULL)
+    return THREAD_HANDLE_INVALID;
+  if (storage == NULL)
+    return THREAD_MEMORY_INVALID;
+  if (length == 0 || block_size == 0)
+    return THREAD_QUEUE_INVALID;
+
+  queue->block_size = block_size;
+  queue->length = length;
+  queue->storage = (uint8_t *)storage;
+  queue->acquired = queue->storage + THREAD_QUEUE_BLOCK_STRIDE(block_size) * length;
+  memset(queue->acquired, 0, THREAD_QUEUE_BLOCK_FLAGS_SIZE(length));
+
+  thread_return_t retval = CreateQueue(&queue->queue, length, sizeof(void *));
+  if (retval != THREAD_SUCCESS)
+    return retval;
+  retval = CreateQueue(&queue->free_blocks, length, sizeof(void *));
+  if (retval != THREAD_SUCCESS) {
+    DeleteQueue(&queue->queue);
+    return retval;
+  }
+
+  // Every block starts out in the pool
+  uint8_t *block = queue->storage;
+  for (thread_queue_length_t i = 0; i < length; i++) {
+    xQueueSendToBack(queue->free_blocks, &block, 0);
+    block += THREAD_QUEUE_BLOCK_STRIDE(block_size);
+  }
+  return THREAD_SUCCESS;
+}
+
+thread_return_t DeleteZeroCopyQueue(thread_zero_copy_queue_t *queue) {
+  if (queue == NULL)
+    return THREAD_HANDLE_INVALID;
+
+  if (queue->queue == NULL && queue->free_blocks == NULL)
+    return THREAD_HANDLE_INVALID;
+
+  // A half-created queue has only one of the two, which must still be freed
+  if (queue->queue != NULL)
+    DeleteQueue(&queue->queue);
+  if (queue->free_blocks != NULL)
+    DeleteQueue(&queue->free_blocks);
+  return THREAD_SUCCESS;
+}
+
+thread_return_t QueueAcquireBlock(thread_zero_copy_queue_t *queue, void **block, thread_time_t max_wait) {
+  if (queue == NULL)
+    return THREAD_HANDLE_INVALID;
+
+  thread_return_t retval = QueueReceive(&queue->free_blocks, block, max_wait);
+  if (retval != THREAD_SUCCESS)
+    return retval;
+
+  // Pool blocks always lie on a stride, so the index needs no checking here
+  size_t index = (size_t)((uint8_t *)*block - queue->storage) / THREAD_QUEUE_BLOCK_STRIDE(queue->block_size);
+  taskENTER_CRITICAL();
+  queue->acquired[index / 8] |= (uint8_t)(1 << (index % 8));
+  taskEXIT_CRITICAL();
+  return THREAD_SUCCESS;
+}
+
+thread_return_t QueueSendBlock(thread_zero_copy_queue_t *queue, void *block, thread_time_t max_wait) {
+  if (queue == NULL)
+    return THREAD_HANDLE_INVALID;
+  if (block == NULL)
+    return THREAD_MEMORY_INVALID;
+
+  return QueueSend(&queue->queue, &block, max_wait);
+}
+
+thread_return_t QueueReceiveBlock(thread_zero_copy_queue_t *queue, void **block, thread_time_t max_wait) {
+  if (queue == NULL)
+    return THREAD_HANDLE_INVALID;
+
+  return QueueReceive(&queue->queue, block, max_wait);
+}
+
+thread_return_t QueueReleaseBlock(thread_zero_copy_queue_t *queue, void *block) {
+  if (queue == NULL)
+    return THREAD_HANDLE_INVALID;
+  if (block == NULL || queue->storage == NULL)
+    return THREAD_MEMORY_INVALID;
+
+  size_t stride = THREAD_QUEUE_BLOCK_STRIDE(queue->block_size);
+  uintptr_t offset = (uintptr_t)block - (uintptr_t)queue->storage;
+  if ((uintptr_t)block < (uintptr_t)queue->storage || offset >= stride * queue->length || offset % stride != 0)
+    return THREAD_MEMORY_INVALID;
+
+  // A block released twice would be handed to two producers
+  size_t index = offset / stride;
+  uint8_t bit = (uint8_t)(1 << (index % 8));
+  taskENTER_CRITICAL();
+  bool acquired = (queue->acquired[index / 8] & bit) != 0;
+  queue->acquired[index / 8] &= (uint8_t)~bit;
+  taskEXIT_CRITICAL();
+  if (!acquired)
+    return THREAD_MEMORY_INVALID;
+
+  // Only acquired blocks come back, so the pool always has room and this never waits
+  return QueueSend(&queue->free_blocks, &block, 0);
+}
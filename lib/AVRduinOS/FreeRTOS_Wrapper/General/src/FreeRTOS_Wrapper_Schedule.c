@@ -0,0 +1,108 @@
+/**
+ ********************************************************************************
+ * @file    FreeRTOS_Wrapper_Schedule.c
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Schedulability Analysis for FreeRTOS
+ * @version 1.0
+ * @date    2024-03-18
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#include "FreeRTOS_Wrapper_Schedule.h"
+
+#include <math.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <Arduino_FreeRTOS.h>
+
+#include "FreeRTOS_Wrapper_Configuration.h"
+#include "FreeRTOS_Wrapper_Types.h"
+#include "FreeRTOS_Wrapper_Stats.h"
+
+static uint64_t ScheduleDeadline(const thread_schedule_t *entry) {
+  thread_time_t deadline_ms = (entry->deadline_ms != 0) ? entry->deadline_ms : entry->period_ms;
+  return (uint64_t)deadline_ms * 1000;
+}
+
+static uint64_t ScheduleResponse(const thread_schedule_t *schedule, UBaseType_t count, UBaseType_t index) {
+  const thread_schedule_t *entry = &schedule[index];
+  uint64_t deadline = ScheduleDeadline(entry);
+
+  // Iterates R = C + sum(ceil(R / T) * C) over the threads that can preempt, until it settles or misses
+  uint64_t response = entry->wcet_us;
+  for (;;) {
+    uint64_t next = entry->wcet_us;
+    for (UBaseType_t j = 0; j < count; j++) {
+      if (j == index || schedule[j].thread->priority < entry->thread->priority)
+        continue;
+      uint64_t period = (uint64_t)schedule[j].period_ms * 1000;
+      next += ((response + period - 1) / period) * schedule[j].wcet_us;
+    }
+    if (next == response || next > deadline)
+      return next;
+    response = next;
+  }
+}
+
+thread_return_t ThreadScheduleAnalyze(thread_schedule_t *schedule, UBaseType_t count, thread_schedule_report_t *report) {
+  if (schedule == NULL || report == NULL || count == 0)
+    return THREAD_MEMORY_INVALID;
+  for (UBaseType_t i = 0; i < count; i++) {
+    if (schedule[i].thread == NULL || schedule[i].thread->valid != THREAD_STRUCT_VALID)
+      return THREAD_FUNCTION_INVALID;
+    if (schedule[i].period_ms == 0 || schedule[i].deadline_ms > schedule[i].period_ms)
+      return THREAD_PERIOD_INVALID;
+  }
+
+  // Microseconds per millisecond of period is utilization in tenths of a percent, rounded up
+  uint32_t utilization = 0;
+  for (UBaseType_t i = 0; i < count; i++)
+    utilization += (schedule[i].wcet_us + schedule[i].period_ms - 1) / schedule[i].period_ms;
+  report->utilization = (utilization > UINT16_MAX) ? UINT16_MAX : (uint16_t)utilization;
+  report->liu_layland_bound = (uint16_t)(1000.0 * count * (pow(2.0, 1.0 / count) - 1.0));
+  report->liu_layland_pass = report->utilization <= report->liu_layland_bound;
+
+  report->first_miss = count;
+  for (UBaseType_t i = 0; i < count; i++) {
+    uint64_t response = ScheduleResponse(schedule, count, i);
+    schedule[i].response_us = (response > UINT32_MAX) ? UINT32_MAX : (uint32_t)response;
+    if (response > ScheduleDeadline(&schedule[i]) && report->first_miss == count)
+      report->first_miss = i;
+  }
+  report->response_time_pass = report->first_miss == count;
+
+  return report->response_time_pass ? THREAD_SUCCESS : THREAD_SCHEDULE_OVERLOAD;
+}
+
+#if (THREAD_STATS_ENABLED == 1)
+
+thread_return_t ThreadScheduleBegin(thread_schedule_t *entry) {
+  if (entry == NULL)
+    return THREAD_MEMORY_INVALID;
+
+  entry->started_at = ThreadStatsRunTime();
+  return THREAD_SUCCESS;
+}
+
+thread_return_t ThreadScheduleEnd(thread_schedule_t *entry) {
+  if (entry == NULL)
+    return THREAD_MEMORY_INVALID;
+
+  uint32_t exec = ThreadStatsRunTime() - entry->started_at;
+  entry->cycles++;
+  entry->exec_last_us = exec;
+  if (exec > entry->exec_max_us)
+    entry->exec_max_us = exec;
+
+  if (exec > entry->wcet_us) {
+    entry->wcet_overruns++;
+    return THREAD_SCHEDULE_WCET_OVERRUN;
+  }
+  return THREAD_SUCCESS;
+}
+
+#endif // THREAD_STATS_ENABLED
\ No newline at end of file
@@ -0,0 +1,125 @@
+/**
+ ********************************************************************************
+ * @file    FreeRTOS_Wrapper_Semaphore.c
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Semaphore Wrappers for FreeRTOS
+ * @version 1.0
+ * @date    2024-03-18
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#include "FreeRTOS_Wrapper_Semaphore.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <Arduino_FreeRTOS.h>
+#include <semphr.h>
+
+#include "FreeRTOS_Wrapper_Types.h"
+#include "FreeRTOS_Wrapper_Methods.h"
+
+static thread_return_t SemaphoreCheck(thread_semaphore_handle_t *semaphore, thread_semaphore_count_t max_count, thread_semaphore_count_t initial_count);
+
+thread_return_t CreateBinarySemaphore(thread_semaphore_handle_t *semaphore) {
+  thread_return_t retval = SemaphoreCheck(semaphore, 1, 0);
+  if (retval != THREAD_SUCCESS)
+    return retval;
+
+  *semaphore = xSemaphoreCreateBinary();
+  return (*semaphore != NULL) ? THREAD_SUCCESS : THREAD_FAILURE_MEMORY_ALLOCATION;
+}
+
+thread_return_t CreateCountingSemaphore(thread_semaphore_handle_t *semaphore, thread_semaphore_count_t max_count, thread_semaphore_count_t initial_count) {
+  thread_return_t retval = SemaphoreCheck(semaphore, max_count, initial_count);
+  if (retval != THREAD_SUCCESS)
+    return retval;
+
+  *semaphore = xSemaphoreCreateCounting(max_count, initial_count);
+  return (*semaphore != NULL) ? THREAD_SUCCESS : THREAD_FAILURE_MEMORY_ALLOCATION;
+}
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+thread_return_t CreateStaticBinarySemaphore(thread_semaphore_handle_t *semaphore, thread_semaphore_static_memory_t *memory) {
+  thread_return_t retval = SemaphoreCheck(semaphore, 1, 0);
+  if (retval != THREAD_SUCCESS)
+    return retval;
+  if (memory == NULL)
+    return THREAD_MEMORY_INVALID;
+
+  *semaphore = xSemaphoreCreateBinaryStatic(memory);
+  return (*semaphore != NULL) ? THREAD_SUCCESS : THREAD_FAILURE_UNKNOWN;
+}
+
+thread_return_t CreateStaticCountingSemaphore(thread_semaphore_handle_t *semaphore, thread_semaphore_count_t max_count, thread_semaphore_count_t initial_count, thread_semaphore_static_memory_t *memory) {
+  thread_return_t retval = SemaphoreCheck(semaphore, max_count, initial_count);
+  if (retval != THREAD_SUCCESS)
+    return retval;
+  if (memory == NULL)
+    return THREAD_MEMORY_INVALID;
+
+  *semaphore = xSemaphoreCreateCountingStatic(max_count, initial_count, memory);
+  return (*semaphore != NULL) ? THREAD_SUCCESS : THREAD_FAILURE_UNKNOWN;
+}
+#endif // configSUPPORT_STATIC_ALLOCATION
+
+thread_return_t DeleteSemaphore(thread_semaphore_handle_t *semaphore) {
+  if (semaphore == NULL || *semaphore == NULL)
+    return THREAD_HANDLE_INVALID;
+
+  vSemaphoreDelete(*semaphore);
+  *semaphore = NULL;
+  return THREAD_SUCCESS;
+}
+
+thread_return_t SemaphoreGive(thread_semaphore_handle_t *semaphore) {
+  if (semaphore == NULL || *semaphore == NULL)
+    return THREAD_HANDLE_INVALID;
+
+  BaseType_t retval = xSemaphoreGive(*semaphore);
+  return QueueAssert(retval, THREAD_SEMAPHORE_FULL);
+}
+
+thread_return_t SemaphoreTake(thread_semaphore_handle_t *semaphore, thread_time_t max_wait) {
+  if (semaphore == NULL || *semaphore == NULL)
+    return THREAD_HANDLE_INVALID;
+
+  BaseType_t retval = xSemaphoreTake(*semaphore, pdMS_TO_TICKS(max_wait));
+  return QueueAssert(retval, THREAD_SEMAPHORE_TIMEOUT);
+}
+
+thread_return_t SemaphoreGiveFromISR(thread_semaphore_handle_t *semaphore, thread_isr_yield_t *yield) {
+  if (semaphore == NULL || *semaphore == NULL)
+    return THREAD_HANDLE_INVALID;
+
+  BaseType_t retval = xSemaphoreGiveFromISR(*semaphore, yield);
+  return QueueAssert(retval, THREAD_SEMAPHORE_FULL);
+}
+
+thread_return_t SemaphoreTakeFromISR(thread_semaphore_handle_t *semaphore, thread_isr_yield_t *yield) {
+  if (semaphore == NULL || *semaphore == NULL)
+    return THREAD_HANDLE_INVALID;
+
+  BaseType_t retval = xSemaphoreTakeFromISR(*semaphore, yield);
+  return QueueAssert(retval, THREAD_SEMAPHORE_TIMEOUT);
+}
+
+thread_semaphore_count_t SemaphoreCount(thread_semaphore_handle_t *semaphore) {
+  if (semaphore == NULL || *semaphore == NULL)
+    return 0;
+
+  return uxSemaphoreGetCount(*semaphore);
+}
+
+static thread_return_t SemaphoreCheck(thread_semaphore_handle_t *semaphore, thread_semaphore_count_t max_count, thread_semaphore_count_t initial_count) {
+  if (semaphore == NULL)
+    return THREAD_HANDLE_INVALID;
+  if (*semaphore != NULL)
+    return THREAD_HANDLE_INVALID;
+  if (max_count == 0 || initial_count > max_count)
+    return THREAD_SEMAPHORE_INVALID;
+
+  return THREAD_SUCCESS;
+}
\ No newline at end of file
@@ -0,0 +1,121 @@
+/**
+ ********************************************************************************
+ * @file    FreeRTOS_Wrapper_Stack.c
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Stack Monitor Wrappers for FreeRTOS
+ * @version 1.0
+ * @date    2024-03-18
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#include "FreeRTOS_Wrapper_Stack.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <Arduino_FreeRTOS.h>
+
+#include "FreeRTOS_Wrapper_Configuration.h"
+#include "FreeRTOS_Wrapper_Types.h"
+#include "FreeRTOS_Wrapper_Methods.h"
+
+#if (THREAD_STACK_MONITOR_THREADS > 0)
+
+typedef struct __stack_entry {
+  thread_handle_t thread;
+  configSTACK_DEPTH_TYPE stack_size;
+} stack_entry_t;
+
+static stack_entry_t stack_registry[THREAD_STACK_MONITOR_THREADS];
+
+thread_return_t ThreadStackRegister(thread_handle_t thread, configSTACK_DEPTH_TYPE stack_size) {
+  if (thread == NULL)
+    return THREAD_HANDLE_INVALID;
+
+  thread_return_t retval = THREAD_MEMORY_INVALID;
+  taskENTER_CRITICAL();
+  for (UBaseType_t i = 0; i < THREAD_STACK_MONITOR_THREADS; i++) {
+    if (stack_registry[i].thread == NULL) {
+      stack_registry[i].thread = thread;
+      stack_registry[i].stack_size = stack_size;
+      retval = THREAD_SUCCESS;
+      break;
+    }
+  }
+  taskEXIT_CRITICAL();
+
+  return retval;
+}
+
+void ThreadStackUnregister(thread_handle_t thread) {
+  taskENTER_CRITICAL();
+  for (UBaseType_t i = 0; i < THREAD_STACK_MONITOR_THREADS; i++) {
+    if (stack_registry[i].thread == thread) {
+      stack_registry[i].thread = NULL;
+      break;
+    }
+  }
+  taskEXIT_CRITICAL();
+}
+
+thread_return_t ThreadStackReport(thread_stack_report_t *reports, UBaseType_t *count) {
+  if (reports == NULL || count == NULL)
+    return THREAD_MEMORY_INVALID;
+
+  UBaseType_t filled = 0;
+  thread_return_t retval = THREAD_SUCCESS;
+
+  // Threads cannot be deleted while their stacks are scanned
+  vTaskSuspendAll();
+  for (UBaseType_t i = 0; i < THREAD_STACK_MONITOR_THREADS; i++) {
+    if (stack_registry[i].thread == NULL)
+      continue;
+    if (filled == *count) {
+      retval = THREAD_MEMORY_INVALID;
+      break;
+    }
+
+    thread_stack_report_t *report = &reports[filled++];
+    report->thread = stack_registry[i].thread;
+    report->thread_name = pcTaskGetName(report->thread);
+    report->stack_size = stack_registry[i].stack_size;
+    report->high_water_mark = (configSTACK_DEPTH_TYPE)uxTaskGetStackHighWaterMark(report->thread);
+    report->suggested_size = ThreadStackSuggestSize(report->stack_size, report->high_water_mark);
+  }
+  xTaskResumeAll();
+
+  *count = filled;
+  return retval;
+}
+
+configSTACK_DEPTH_TYPE ThreadStackSuggestSize(configSTACK_DEPTH_TYPE stack_size, configSTACK_DEPTH_TYPE high_water_mark) {
+  configSTACK_DEPTH_TYPE used = (high_water_mark < stack_size) ? stack_size - high_water_mark : 0;
+  uint32_t suggested = (uint32_t)used + used / 8 + THREAD_STACK_MARGIN;
+
+  return (configSTACK_DEPTH_TYPE)((suggested + 7) & ~(uint32_t)7);
+}
+
+void ThreadStackMonitor(void *params) {
+  thread_stack_monitor_t *monitor = (thread_stack_monitor_t *)params;
+  thread_stack_report_t reports[THREAD_STACK_MONITOR_THREADS];
+  thread_period_t period;
+
+  if (monitor == NULL || ThreadPeriodInit(&period, monitor->period_ms) != THREAD_SUCCESS) {
+    thread_handle_t self = GetSelfThreadHandle();
+    DeleteThread(&self);
+  }
+
+  while (true) {
+    UBaseType_t count = THREAD_STACK_MONITOR_THREADS;
+    ThreadStackReport(reports, &count);
+    if (monitor->report != NULL)
+      monitor->report(reports, count);
+
+    ThreadPeriodWait(&period);
+  }
+}
+
+#endif // THREAD_STACK_MONITOR_THREADS
\ No newline at end of file
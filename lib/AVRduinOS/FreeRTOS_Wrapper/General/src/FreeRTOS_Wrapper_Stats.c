@@ -0,0 +1,180 @@
+/**
+ ********************************************************************************
+ * @file    FreeRTOS_Wrapper_Stats.c
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Run Time Statistics Wrappers for FreeRTOS
+ * @version 1.0
+ * @date    2024-03-18
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#include "FreeRTOS_Wrapper_Stats.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <Arduino_FreeRTOS.h>
+
+#include "FreeRTOS_Wrapper_Configuration.h"
+#include "FreeRTOS_Wrapper_Types.h"
+#include "FreeRTOS_Wrapper_Clock.h"
+#include "FreeRTOS_Wrapper_Hooks.h"
+
+#if (THREAD_STATS_ENABLED == 1)
+
+#if (configGENERATE_RUN_TIME_STATS != 1) || (configUSE_TRACE_FACILITY != 1)
+  #error "THREAD_STATS_ENABLED requires FreeRTOS_Wrapper_Hooks.h at the end of FreeRTOSConfig.h"
+#endif
+
+// Id 0 collects threads created after every id was taken
+static uint32_t stats_thread_switches[THREAD_HOOK_MAX_THREADS + 1];
+static volatile uint32_t stats_switches = 0;
+static volatile uint32_t stats_switched_in_at = 0;
+
+// Filled with the scheduler suspended, so one buffer serves every caller
+static TaskStatus_t stats_status[THREAD_STATS_MAX_THREADS];
+
+static UBaseType_t StatsCollect(configRUN_TIME_COUNTER_TYPE *total);
+static uint32_t StatsSwitchesOf(thread_handle_t thread);
+static void StatsWrite32(uint8_t *buffer, uint32_t value);
+
+void ThreadStatsCreate(uint8_t id) {
+  stats_thread_switches[id] = 0;
+}
+
+void ThreadStatsSwitchedIn(uint8_t id) {
+  stats_thread_switches[id]++;
+  stats_switches++;
+  stats_switched_in_at = ThreadClockMicros();
+}
+
+thread_return_t ThreadStatsGet(thread_stats_t *stats, UBaseType_t *count) {
+  if (stats == NULL || count == NULL)
+    return THREAD_MEMORY_INVALID;
+
+  vTaskSuspendAll();
+  configRUN_TIME_COUNTER_TYPE total = 0;
+  UBaseType_t threads = StatsCollect(&total);
+  if (threads == 0 || threads > *count) {
+    xTaskResumeAll();
+    return THREAD_MEMORY_INVALID;
+  }
+
+  // Dividing by a hundredth of the total keeps the percentage from overflowing 32 bits
+  uint32_t percent = (total + 99) / 100;
+
+  for (UBaseType_t i = 0; i < threads; i++) {
+    stats[i].thread = stats_status[i].xHandle;
+    stats[i].thread_name = stats_status[i].pcTaskName;
+    stats[i].priority = stats_status[i].uxCurrentPriority;
+    stats[i].run_time = stats_status[i].ulRunTimeCounter;
+    stats[i].switches = StatsSwitchesOf(stats_status[i].xHandle);
+    stats[i].cpu_percent = (percent != 0) ? (uint8_t)(stats_status[i].ulRunTimeCounter / percent) : 0;
+  }
+  xTaskResumeAll();
+
+  *count = threads;
+  return THREAD_SUCCESS;
+}
+
+uint8_t ThreadStatsCpuLoad(thread_stats_window_t *window) {
+  if (window == NULL)
+    return 0;
+
+  uint32_t total = ThreadClockMicros();
+  uint32_t idle = ulTaskGetIdleRunTimeCounter();
+  uint32_t total_elapsed = total - window->total;
+  uint32_t idle_elapsed = idle - window->idle;
+
+  window->total = total;
+  window->idle = idle;
+
+  if (total_elapsed == 0)
+    return 0;
+  if (idle_elapsed > total_elapsed)
+    idle_elapsed = total_elapsed;
+
+  uint32_t percent = (total_elapsed + 99) / 100;
+  uint32_t idle_percent = idle_elapsed / percent;
+  return (idle_percent >= 100) ? 0 : (uint8_t)(100 - idle_percent);
+}
+
+uint32_t ThreadStatsSwitches(void) {
+  taskENTER_CRITICAL();
+  uint32_t switches = stats_switches;
+  taskEXIT_CRITICAL();
+
+  return switches;
+}
+
+uint32_t ThreadStatsRunTime(void) {
+  // The kernel adds the current slice to the counter only when the thread is switched out
+  taskENTER_CRITICAL();
+  uint32_t run_time = ulTaskGetRunTimeCounter(xTaskGetCurrentTaskHandle()) + (ThreadClockMicros() - stats_switched_in_at);
+  taskEXIT_CRITICAL();
+
+  return run_time;
+}
+
+thread_return_t ThreadStatsDump(uint8_t *buffer, size_t *size, thread_stats_window_t *window) {
+  if (buffer == NULL || size == NULL)
+    return THREAD_MEMORY_INVALID;
+
+  thread_stats_window_t start = { 0, 0 };
+  uint8_t load = ThreadStatsCpuLoad((window != NULL) ? window : &start);
+
+  vTaskSuspendAll();
+  configRUN_TIME_COUNTER_TYPE total = 0;
+  UBaseType_t threads = StatsCollect(&total);
+  if (threads == 0 || *size < (size_t)THREAD_STATS_DUMP_SIZE(threads)) {
+    xTaskResumeAll();
+    return THREAD_MEMORY_INVALID;
+  }
+
+  buffer[0] = (uint8_t)threads;
+  StatsWrite32(&buffer[1], total);
+  StatsWrite32(&buffer[5], stats_switches);
+  buffer[9] = load;
+
+  uint8_t *record = &buffer[THREAD_STATS_DUMP_HEADER_SIZE];
+  for (UBaseType_t i = 0; i < threads; i++) {
+    record[0] = ThreadHookId(stats_status[i].xHandle);
+    record[1] = (uint8_t)stats_status[i].uxCurrentPriority;
+    StatsWrite32(&record[2], stats_status[i].ulRunTimeCounter);
+    StatsWrite32(&record[6], StatsSwitchesOf(stats_status[i].xHandle));
+
+    const char *name = stats_status[i].pcTaskName;
+    for (uint8_t c = 0; c < configMAX_TASK_NAME_LEN; c++) {
+      record[10 + c] = (uint8_t)*name;
+      if (*name != '\0')
+        name++;
+    }
+
+    record += THREAD_STATS_DUMP_RECORD_SIZE;
+  }
+  xTaskResumeAll();
+
+  *size = THREAD_STATS_DUMP_SIZE(threads);
+  return THREAD_SUCCESS;
+}
+
+static UBaseType_t StatsCollect(configRUN_TIME_COUNTER_TYPE *total) {
+  return uxTaskGetSystemState(stats_status, THREAD_STATS_MAX_THREADS, total);
+}
+
+static uint32_t StatsSwitchesOf(thread_handle_t thread) {
+  uint8_t id = ThreadHookId(thread);
+
+  return (id != 0) ? stats_thread_switches[id] : 0;
+}
+
+static void StatsWrite32(uint8_t *buffer, uint32_t value) {
+  buffer[0] = (uint8_t)(value);
+  buffer[1] = (uint8_t)(value >> 8);
+  buffer[2] = (uint8_t)(value >> 16);
+  buffer[3] = (uint8_t)(value >> 24);
+}
+
+#endif // THREAD_STATS_ENABLED
\ No newline at end of file
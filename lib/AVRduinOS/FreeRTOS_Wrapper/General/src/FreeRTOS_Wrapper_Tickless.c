@@ -0,0 +1,201 @@
+/**
+ ********************************************************************************
+ * @file    FreeRTOS_Wrapper_Tickless.c
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Tickless Idle for FreeRTOS
+ * @version 1.0
+ * @date    2024-03-18
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#include "FreeRTOS_Wrapper_Tickless.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <Arduino.h>
+#include <Arduino_FreeRTOS.h>
+
+#include "FreeRTOS_Wrapper_Configuration.h"
+#include "FreeRTOS_Wrapper_Types.h"
+#include "FreeRTOS_Wrapper_Clock.h"
+
+#if (THREAD_TICKLESS_IDLE_ENABLED == 1)
+
+#if defined(__AVR__)
+  #include <avr/interrupt.h>
+  #include <avr/io.h>
+  #include <avr/sleep.h>
+  #include <avr/wdt.h>
+
+  #if !defined(portUSE_WDTO)
+    #error "THREAD_TICKLESS_IDLE_ENABLED requires the watchdog tick of the port"
+  #endif // portUSE_WDTO
+
+  // Watchdog prescaler bits of a WDTO_ value, whose top bit is apart from the others
+  #define TICKLESS_WDP(wdto) (((wdto) & 0x07) | (((wdto) & 0x08) ? _BV(WDP3) : 0))
+#endif // __AVR__
+
+#define TICKLESS_TICK_MICROS (1000000UL / configTICK_RATE_HZ)
+
+static volatile bool tickless_sleeping = false;
+static volatile bool tickless_woken = false;
+static volatile uint32_t tickless_woke_at = 0;
+static volatile bool tickless_latency_pending = false;
+static thread_tickless_stats_t tickless_stats;
+
+static uint32_t TicklessMicros(void) {
+#if (THREAD_CLOCK_ENABLED == 1)
+  return ThreadClockMicros();
+#else
+  return micros();
+#endif // THREAD_CLOCK_ENABLED
+}
+
+#if defined(__AVR__) && (THREAD_TICKLESS_SLEEP_MODE == SLEEP_MODE_IDLE)
+static void TicklessWatchdog(uint8_t wdto) {
+  // Timed sequence, the second write must follow within four cycles
+  wdt_reset();
+  WDTCSR = _BV(WDCE) | _BV(WDE);
+  WDTCSR = _BV(WDIF) | _BV(WDIE) | TICKLESS_WDP(wdto);
+}
+#endif // __AVR__ && THREAD_TICKLESS_SLEEP_MODE
+
+void ThreadTicklessTick(void) {
+  if (tickless_sleeping) {
+    tickless_woke_at = TicklessMicros();
+    tickless_woken = true;
+  }
+}
+
+void ThreadTicklessSleep(uint32_t expected_ticks) {
+#if defined(__AVR__)
+#if (THREAD_TICKLESS_SLEEP_MODE == SLEEP_MODE_IDLE)
+  // Longest watchdog period that ends before the next thread is due, each step doubling it
+  uint8_t wdto = portUSE_WDTO;
+  while (wdto < WDTO_8S && ((uint32_t)2 << (wdto - portUSE_WDTO)) <= expected_ticks)
+    wdto++;
+  if (wdto == portUSE_WDTO)
+    return;
+  uint32_t period_ticks = (uint32_t)1 << (wdto - portUSE_WDTO);
+
+  cli();
+  if (eTaskConfirmSleepModeStatus() == eAbortSleep) {
+    sei();
+    return;
+  }
+
+  TicklessWatchdog(wdto);
+  // A wake whose thread never ran, being suspended or deleted meanwhile, is not measured
+  tickless_latency_pending = false;
+  tickless_woken = false;
+  tickless_sleeping = true;
+  uint32_t slept_at = TicklessMicros();
+
+  // Other interrupts wake the CPU as well, but only one that readied a thread ends the sleep
+  set_sleep_mode(THREAD_TICKLESS_SLEEP_MODE);
+  while (!tickless_woken && eTaskConfirmSleepModeStatus() != eAbortSleep) {
+    sleep_enable();
+    sei();
+    sleep_cpu();
+    sleep_disable();
+    cli();
+  }
+
+  tickless_sleeping = false;
+  bool early = !tickless_woken;
+  uint32_t slept_ticks;
+  if (!early) {
+    // The watchdog interrupt has already counted the last tick of the period
+    slept_ticks = period_ticks;
+    vTaskStepTick(period_ticks - 1);
+  } else {
+    // Timer0 runs on in this mode, so the time slept up to the early wake is measured
+    slept_ticks = (TicklessMicros() - slept_at) / TICKLESS_TICK_MICROS;
+    if (slept_ticks >= expected_ticks)
+      slept_ticks = expected_ticks - 1;
+    if (slept_ticks > 0)
+      vTaskStepTick(slept_ticks);
+  }
+  TicklessWatchdog(portUSE_WDTO);
+#else
+  cli();
+  if (eTaskConfirmSleepModeStatus() == eAbortSleep) {
+    sei();
+    return;
+  }
+
+  // The timers stop in this mode, so nothing could time an early wake within a
+  // stretched watchdog period. The watchdog keeps the tick period instead and
+  // each tick is counted as it passes; the kernel holds them until it resumes.
+  tickless_latency_pending = false;
+  tickless_sleeping = true;
+  uint32_t slept_ticks = 0;
+  bool early = false;
+
+  set_sleep_mode(THREAD_TICKLESS_SLEEP_MODE);
+  while (slept_ticks < expected_ticks) {
+    tickless_woken = false;
+    sleep_enable();
+    sei();
+    sleep_cpu();
+    sleep_disable();
+    cli();
+
+    if (tickless_woken) {
+      slept_ticks++;
+    } else if (slept_ticks > 0 || eTaskConfirmSleepModeStatus() == eAbortSleep) {
+      // A held tick makes the kernel report every wake as one that readied a thread
+      early = true;
+      break;
+    }
+  }
+  tickless_sleeping = false;
+#endif // THREAD_TICKLESS_SLEEP_MODE
+
+  tickless_stats.sleeps++;
+  tickless_stats.slept_ticks += slept_ticks;
+  if (!early)
+    tickless_latency_pending = true;
+  else
+    tickless_stats.early_wakes++;
+  sei();
+#else
+  (void)expected_ticks;
+#endif // __AVR__
+}
+
+void ThreadTicklessSwitchedIn(void) {
+  // The first thread but idle to run after a watchdog wake is the one the wake was for
+  if (!tickless_latency_pending || xTaskGetCurrentTaskHandle() == xTaskGetIdleTaskHandle())
+    return;
+
+  tickless_latency_pending = false;
+  uint32_t latency = TicklessMicros() - tickless_woke_at;
+  tickless_stats.wake_latency_last = latency;
+  if (latency > tickless_stats.wake_latency_max)
+    tickless_stats.wake_latency_max = latency;
+}
+
+thread_return_t ThreadTicklessStatsGet(thread_tickless_stats_t *stats) {
+  if (stats == NULL)
+    return THREAD_MEMORY_INVALID;
+
+  taskENTER_CRITICAL();
+  *stats = tickless_stats;
+  taskEXIT_CRITICAL();
+
+  stats->slept_ms = stats->slept_ticks * portTICK_PERIOD_MS;
+  return THREAD_SUCCESS;
+}
+
+void ThreadTicklessStatsClear(void) {
+  taskENTER_CRITICAL();
+  tickless_stats = (thread_tickless_stats_t){0, 0, 0, 0, 0, 0};
+  taskEXIT_CRITICAL();
+}
+
+#endif // THREAD_TICKLESS_IDLE_ENABLED
\ No newline at end of file
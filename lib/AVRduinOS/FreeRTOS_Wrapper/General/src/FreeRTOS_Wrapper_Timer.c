@@ -0,0 +1,163 @@
+/**
+ ********************************************************************************
+ * @file    FreeRTOS_Wrapper_Timer.c
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Software Timer Wrappers for FreeRTOS
+ * @version 1.0
+ * @date    2024-03-18
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#include "FreeRTOS_Wrapper_Timer.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <Arduino_FreeRTOS.h>
+#include <timers.h>
+
+#include "FreeRTOS_Wrapper_Types.h"
+#include "FreeRTOS_Wrapper_Methods.h"
+
+#if (configUSE_TIMERS == 1)
+static thread_return_t TimerCheck(thread_timer_handle_t *timer, thread_time_t period, thread_timer_callback_t callback);
+
+thread_return_t CreateTimer(thread_timer_handle_t *timer, const char *name, thread_time_t period, thread_timer_mode_t mode, thread_timer_callback_t callback, void *context) {
+  thread_return_t retval = TimerCheck(timer, period, callback);
+  if (retval != THREAD_SUCCESS)
+    return retval;
+
+  *timer = xTimerCreate(name, pdMS_TO_TICKS(period), (BaseType_t)mode, context, callback);
+  return (*timer != NULL) ? THREAD_SUCCESS : THREAD_FAILURE_MEMORY_ALLOCATION;
+}
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+thread_return_t CreateStaticTimer(thread_timer_handle_t *timer, const char *name, thread_time_t period, thread_timer_mode_t mode, thread_timer_callback_t callback, void *context, thread_timer_static_memory_t *memory) {
+  thread_return_t retval = TimerCheck(timer, period, callback);
+  if (retval != THREAD_SUCCESS)
+    return retval;
+  if (memory == NULL)
+    return THREAD_MEMORY_INVALID;
+
+  *timer = xTimerCreateStatic(name, pdMS_TO_TICKS(period), (BaseType_t)mode, context, callback, memory);
+  return (*timer != NULL) ? THREAD_SUCCESS : THREAD_FAILURE_UNKNOWN;
+}
+#endif // configSUPPORT_STATIC_ALLOCATION
+
+thread_return_t DeleteTimer(thread_timer_handle_t *timer, thread_time_t max_wait) {
+  if (timer == NULL || *timer == NULL)
+    return THREAD_HANDLE_INVALID;
+
+  BaseType_t retval = xTimerDelete(*timer, pdMS_TO_TICKS(max_wait));
+  if (retval != pdPASS)
+    return THREAD_TIMER_QUEUE_FULL;
+
+  *timer = NULL;
+  return THREAD_SUCCESS;
+}
+
+thread_return_t TimerStart(thread_timer_handle_t *timer, thread_time_t max_wait) {
+  if (timer == NULL || *timer == NULL)
+    return THREAD_HANDLE_INVALID;
+
+  BaseType_t retval = xTimerStart(*timer, pdMS_TO_TICKS(max_wait));
+  return QueueAssert(retval, THREAD_TIMER_QUEUE_FULL);
+}
+
+thread_return_t TimerStop(thread_timer_handle_t *timer, thread_time_t max_wait) {
+  if (timer == NULL || *timer == NULL)
+    return THREAD_HANDLE_INVALID;
+
+  BaseType_t retval = xTimerStop(*timer, pdMS_TO_TICKS(max_wait));
+  return QueueAssert(retval, THREAD_TIMER_QUEUE_FULL);
+}
+
+thread_return_t TimerReset(thread_timer_handle_t *timer, thread_time_t max_wait) {
+  if (timer == NULL || *timer == NULL)
+    return THREAD_HANDLE_INVALID;
+
+  BaseType_t retval = xTimerReset(*timer, pdMS_TO_TICKS(max_wait));
+  return QueueAssert(retval, THREAD_TIMER_QUEUE_FULL);
+}
+
+thread_return_t TimerChangePeriod(thread_timer_handle_t *timer, thread_time_t period, thread_time_t max_wait) {
+  if (timer == NULL || *timer == NULL)
+    return THREAD_HANDLE_INVALID;
+  if (pdMS_TO_TICKS(period) == 0)
+    return THREAD_TIMER_INVALID;
+
+  BaseType_t retval = xTimerChangePeriod(*timer, pdMS_TO_TICKS(period), pdMS_TO_TICKS(max_wait));
+  return QueueAssert(retval, THREAD_TIMER_QUEUE_FULL);
+}
+
+thread_return_t TimerStartFromISR(thread_timer_handle_t *timer, thread_isr_yield_t *yield) {
+  if (timer == NULL || *timer == NULL)
+    return THREAD_HANDLE_INVALID;
+
+  BaseType_t retval = xTimerStartFromISR(*timer, yield);
+  return QueueAssert(retval, THREAD_TIMER_QUEUE_FULL);
+}
+
+thread_return_t TimerStopFromISR(thread_timer_handle_t *timer, thread_isr_yield_t *yield) {
+  if (timer == NULL || *timer == NULL)
+    return THREAD_HANDLE_INVALID;
+
+  BaseType_t retval = xTimerStopFromISR(*timer, yield);
+  return QueueAssert(retval, THREAD_TIMER_QUEUE_FULL);
+}
+
+thread_return_t TimerResetFromISR(thread_timer_handle_t *timer, thread_isr_yield_t *yield) {
+  if (timer == NULL || *timer == NULL)
+    return THREAD_HANDLE_INVALID;
+
+  BaseType_t retval = xTimerResetFromISR(*timer, yield);
+  return QueueAssert(retval, THREAD_TIMER_QUEUE_FULL);
+}
+
+thread_return_t TimerChangePeriodFromISR(thread_timer_handle_t *timer, thread_time_t period, thread_isr_yield_t *yield) {
+  if (timer == NULL || *timer == NULL)
+    return THREAD_HANDLE_INVALID;
+  if (pdMS_TO_TICKS(period) == 0)
+    return THREAD_TIMER_INVALID;
+
+  BaseType_t retval = xTimerChangePeriodFromISR(*timer, pdMS_TO_TICKS(period), yield);
+  return QueueAssert(retval, THREAD_TIMER_QUEUE_FULL);
+}
+
+bool TimerActive(thread_timer_handle_t *timer) {
+  if (timer == NULL || *timer == NULL)
+    return false;
+
+  return xTimerIsTimerActive(*timer) != pdFALSE;
+}
+
+thread_time_t TimerPeriod(thread_timer_handle_t *timer) {
+  if (timer == NULL || *timer == NULL)
+    return 0;
+
+  return THREAD_MILLISEC * xTimerGetPeriod(*timer);
+}
+
+void *TimerContext(thread_timer_handle_t timer) {
+  if (timer == NULL)
+    return NULL;
+
+  return pvTimerGetTimerID(timer);
+}
+
+static thread_return_t TimerCheck(thread_timer_handle_t *timer, thread_time_t period, thread_timer_callback_t callback) {
+  if (timer == NULL)
+    return THREAD_HANDLE_INVALID;
+  if (*timer != NULL)
+    return THREAD_HANDLE_INVALID;
+  if (callback == NULL)
+    return THREAD_FUNCTION_INVALID;
+  // Periods shorter than a tick would round down to no period at all
+  if (pdMS_TO_TICKS(period) == 0)
+    return THREAD_TIMER_INVALID;
+
+  return THREAD_SUCCESS;
+}
+#endif // configUSE_TIMERS
\ No newline at end of file
@@ -0,0 +1,177 @@
+/**
+ ********************************************************************************
+ * @file    FreeRTOS_Wrapper_Trace.cpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Binary Trace Recorder for FreeRTOS
+ * @version 1.0
+ * @date    2024-03-18
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#include "FreeRTOS_Wrapper_Trace.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <Arduino.h>
+#include <Arduino_FreeRTOS.h>
+
+#include "FreeRTOS_Wrapper_Configuration.h"
+#include "FreeRTOS_Wrapper_Types.h"
+#include "FreeRTOS_Wrapper_Methods.h"
+#include "FreeRTOS_Wrapper_Clock.h"
+#include "FreeRTOS_Wrapper_Hooks.h"
+
+#include "RingBuffer.hpp"
+
+#if (THREAD_TRACE_ENABLED == 1)
+
+#define TRACE_FRAME_SYNC 0xA5
+#define TRACE_FRAME_RECORDS 0x01
+#define TRACE_FRAME_NAME 0x02
+#define TRACE_FRAME_MAX_RECORDS 16
+
+// Records come from the kernel with interrupts masked on the AVR, or from a
+// user mark anywhere, so producers are serialised by masking interrupts
+#if defined(__AVR__)
+  #define TRACE_LOCK() uint8_t trace_sreg = SREG; cli()
+  #define TRACE_UNLOCK() __asm__ __volatile__ ("" ::: "memory"); SREG = trace_sreg
+#else
+  #define TRACE_LOCK() UBaseType_t trace_mask = taskENTER_CRITICAL_FROM_ISR()
+  #define TRACE_UNLOCK() taskEXIT_CRITICAL_FROM_ISR(trace_mask)
+#endif // __AVR__
+
+static RingBuffer<thread_trace_record_t, THREAD_TRACE_RECORDS> trace_ring;
+static volatile bool trace_running = false;
+static uint16_t trace_dropped = 0;
+static volatile uint32_t trace_names = 0;
+
+static void TraceSendFrame(HardwareSerial *port, uint8_t type, uint8_t *frame, uint8_t length);
+static void TraceSendNames(HardwareSerial *port);
+
+void ThreadTraceStart(void) {
+  ThreadClockInit();
+
+  uint32_t names = 0;
+  for (uint8_t id = 1; id <= THREAD_HOOK_MAX_THREADS; id++) {
+    if (ThreadHookThread(id) != NULL)
+      names |= (1UL << id);
+  }
+
+  TRACE_LOCK();
+  trace_names = names;
+  trace_running = true;
+  TRACE_UNLOCK();
+}
+
+void ThreadTraceStop(void) {
+  trace_running = false;
+}
+
+void ThreadTraceMark(uint8_t value) {
+  ThreadTraceRecord(THREAD_TRACE_MARK, value);
+}
+
+void ThreadTraceRecord(uint8_t event, uint8_t object) {
+  if (!trace_running)
+    return;
+
+  TRACE_LOCK();
+  thread_trace_record_t record = { event, object, ThreadClockMicros() };
+  if (trace_dropped != 0) {
+    thread_trace_record_t overflow = { THREAD_TRACE_OVERFLOW, (uint8_t)((trace_dropped > 255) ? 255 : trace_dropped), record.time };
+    if (trace_ring.Push(overflow))
+      trace_dropped = 0;
+  }
+  if (trace_dropped != 0 || !trace_ring.Push(record)) {
+    if (trace_dropped != UINT16_MAX)
+      trace_dropped++;
+  }
+  TRACE_UNLOCK();
+}
+
+void ThreadTraceCreate(uint8_t id) {
+  ThreadTraceRecord(THREAD_TRACE_CREATE, id);
+  if (id != 0)
+    trace_names |= (1UL << id);
+}
+
+uint8_t ThreadTraceRead(uint8_t *buffer, uint8_t records) {
+  if (buffer == NULL)
+    return 0;
+
+  uint8_t count = 0;
+  thread_trace_record_t record;
+  while (count < records && trace_ring.Pop(record)) {
+    buffer[0] = record.event;
+    buffer[1] = record.object;
+    buffer[2] = (uint8_t)(record.time);
+    buffer[3] = (uint8_t)(record.time >> 8);
+    buffer[4] = (uint8_t)(record.time >> 16);
+    buffer[5] = (uint8_t)(record.time >> 24);
+    buffer += THREAD_TRACE_RECORD_SIZE;
+    count++;
+  }
+  return count;
+}
+
+void ThreadTraceDrain(void *params) {
+  HardwareSerial *port = (params != NULL) ? (HardwareSerial *)params : &Serial;
+  uint8_t frame[3 + TRACE_FRAME_MAX_RECORDS * THREAD_TRACE_RECORD_SIZE + 1];
+
+  while (true) {
+    TraceSendNames(port);
+
+    uint8_t count = ThreadTraceRead(&frame[3], TRACE_FRAME_MAX_RECORDS);
+    if (count == 0) {
+      ThreadDelay(THREAD_TRACE_DRAIN_MS);
+      continue;
+    }
+    TraceSendFrame(port, TRACE_FRAME_RECORDS, frame, count * THREAD_TRACE_RECORD_SIZE);
+  }
+}
+
+static void TraceSendFrame(HardwareSerial *port, uint8_t type, uint8_t *frame, uint8_t length) {
+  frame[0] = TRACE_FRAME_SYNC;
+  frame[1] = type;
+  frame[2] = length;
+
+  uint8_t checksum = type + length;
+  for (uint8_t i = 0; i < length; i++)
+    checksum += frame[3 + i];
+  frame[3 + length] = checksum;
+
+  port->write(frame, 3 + length + 1);
+}
+
+static void TraceSendNames(HardwareSerial *port) {
+  uint8_t frame[3 + 1 + configMAX_TASK_NAME_LEN + 1];
+
+  for (uint8_t id = 1; id <= THREAD_HOOK_MAX_THREADS && trace_names != 0; id++) {
+    if ((trace_names & (1UL << id)) == 0)
+      continue;
+
+    // The thread cannot be deleted while its name is copied
+    uint8_t length = 1;
+    SuspendThreadScheduler();
+    taskENTER_CRITICAL();
+    trace_names &= ~(1UL << id);
+    taskEXIT_CRITICAL();
+    void *thread = ThreadHookThread(id);
+    if (thread != NULL) {
+      const char *name = pcTaskGetName((thread_handle_t)thread);
+      while (length <= configMAX_TASK_NAME_LEN && *name != '\0')
+        frame[3 + length++] = (uint8_t)*name++;
+    }
+    ResumeThreadScheduler();
+
+    if (thread != NULL) {
+      frame[3] = id;
+      TraceSendFrame(port, TRACE_FRAME_NAME, frame, length);
+    }
+  }
+}
+
+#endif // THREAD_TRACE_ENABLED
\ No newline at end of file
@@ -0,0 +1,21 @@
+/**
+ ********************************************************************************
+ * @file    Buffer.hpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Unit Tests for the Stream and Message Buffer Functions in the FreeRTOS Wrapper
+ * @version 1.0
+ * @date    2024-03-18
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#ifndef __BUFFER_HPP__
+#define __BUFFER_HPP__
+
+#include "test_utilities.hpp"
+
+test_results_t SDD_054();
+test_results_t SDD_055();
+
+#endif // __BUFFER_HPP__
\ No newline at end of file
@@ -21,5 +21,6 @@ test_results_t SDD_007_010();
 test_results_t SDD_008_010();
 test_results_t SDD_009_010();
 test_results_t SDD_011();
+test_results_t SDD_058();
 
 #endif // __CONFIGURE_THREAD_H__
\ No newline at end of file
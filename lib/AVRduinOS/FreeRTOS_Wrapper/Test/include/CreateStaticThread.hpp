@@ -0,0 +1,23 @@
+/**
+ ********************************************************************************
+ * @file    CreateStaticThread.hpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Unit Tests for the CreateStaticThread Function in the FreeRTOS Wrapper
+ * @version 1.0
+ * @date    2024-03-18
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#ifndef __CREATE_STATIC_THREAD_HPP__
+#define __CREATE_STATIC_THREAD_HPP__
+
+#include "test_utilities.hpp"
+
+test_results_t SDD_026_029();
+test_results_t SDD_027_029();
+test_results_t SDD_028_029();
+test_results_t SDD_029();
+
+#endif // __CREATE_STATIC_THREAD_HPP__
\ No newline at end of file
@@ -0,0 +1,21 @@
+/**
+ ********************************************************************************
+ * @file    EventGroup.hpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Unit Tests for the Event Group Functions in the FreeRTOS Wrapper
+ * @version 1.0
+ * @date    2024-03-18
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#ifndef __EVENT_GROUP_HPP__
+#define __EVENT_GROUP_HPP__
+
+#include "test_utilities.hpp"
+
+test_results_t SDD_050();
+test_results_t SDD_051();
+
+#endif // __EVENT_GROUP_HPP__
\ No newline at end of file
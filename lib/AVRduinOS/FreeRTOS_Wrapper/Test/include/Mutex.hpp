@@ -0,0 +1,21 @@
+/**
+ ********************************************************************************
+ * @file    Mutex.hpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Unit Tests for the Mutex Functions in the FreeRTOS Wrapper
+ * @version 1.0
+ * @date    2024-03-18
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#ifndef __MUTEX_HPP__
+#define __MUTEX_HPP__
+
+#include "test_utilities.hpp"
+
+test_results_t SDD_045();
+test_results_t SDD_046();
+
+#endif // __MUTEX_HPP__
\ No newline at end of file
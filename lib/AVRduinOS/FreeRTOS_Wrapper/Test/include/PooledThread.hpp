@@ -0,0 +1,22 @@
+/**
+ ********************************************************************************
+ * @file    PooledThread.hpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Unit Tests for Block Pool Backed Threads and Queues in the FreeRTOS
+ *          Wrapper
+ * @version 1.0
+ * @date    2024-03-18
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#ifndef __POOLED_THREAD_HPP__
+#define __POOLED_THREAD_HPP__
+
+#include "test_utilities.hpp"
+
+test_results_t SDD_038();
+test_results_t SDD_039();
+
+#endif // __POOLED_THREAD_HPP__
\ No newline at end of file
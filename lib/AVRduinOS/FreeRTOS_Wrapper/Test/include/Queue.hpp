@@ -0,0 +1,22 @@
+/**
+ ********************************************************************************
+ * @file    Queue.hpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Unit Tests for the Queue Functions in the FreeRTOS Wrapper
+ * @version 1.0
+ * @date    2024-03-18
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#ifndef __QUEUE_HPP__
+#define __QUEUE_HPP__
+
+#include "test_utilities.hpp"
+
+test_results_t SDD_035();
+test_results_t SDD_036();
+test_results_t SDD_037();
+
+#endif // __QUEUE_HPP__
\ No newline at end of file
@@ -0,0 +1,21 @@
+/**
+ ********************************************************************************
+ * @file    Schedule.hpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Unit Tests for the Schedulability Analysis in the FreeRTOS Wrapper
+ * @version 1.0
+ * @date    2024-03-18
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#ifndef __SCHEDULE_HPP__
+#define __SCHEDULE_HPP__
+
+#include "test_utilities.hpp"
+
+test_results_t SDD_059();
+test_results_t SDD_060();
+
+#endif // __SCHEDULE_HPP__
\ No newline at end of file
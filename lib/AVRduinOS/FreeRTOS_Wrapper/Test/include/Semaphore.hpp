@@ -0,0 +1,21 @@
+/**
+ ********************************************************************************
+ * @file    Semaphore.hpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Unit Tests for the Semaphore Functions in the FreeRTOS Wrapper
+ * @version 1.0
+ * @date    2024-03-18
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#ifndef __SEMAPHORE_HPP__
+#define __SEMAPHORE_HPP__
+
+#include "test_utilities.hpp"
+
+test_results_t SDD_047();
+test_results_t SDD_048();
+
+#endif // __SEMAPHORE_HPP__
\ No newline at end of file
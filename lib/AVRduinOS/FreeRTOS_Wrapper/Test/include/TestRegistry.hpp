@@ -0,0 +1,23 @@
+/**
+ ********************************************************************************
+ * @file    TestRegistry.hpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Table of the Unit Tests in the FreeRTOS Wrapper
+ * @version 1.0
+ * @date    2024-03-18
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#ifndef __TEST_REGISTRY_HPP__
+#define __TEST_REGISTRY_HPP__
+
+#include <stddef.h>
+
+#include "test_runner.hpp"
+
+extern const test_case_t FreeRTOS_Wrapper_Tests[];
+extern const size_t FreeRTOS_Wrapper_Test_Count;
+
+#endif // __TEST_REGISTRY_HPP__
\ No newline at end of file
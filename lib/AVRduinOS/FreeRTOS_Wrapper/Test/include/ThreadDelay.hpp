@@ -16,5 +16,6 @@
 #include "test_utilities.hpp"
 
 test_results_t SDD_025();
+test_results_t SDD_056();
 
 #endif // __THREAD_DELAY_HPP__
\ No newline at end of file
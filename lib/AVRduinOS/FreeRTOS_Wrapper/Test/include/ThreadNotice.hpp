@@ -0,0 +1,20 @@
+/**
+ ********************************************************************************
+ * @file    ThreadNotice.hpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Unit Tests for the Interrupt Notice Functions in the FreeRTOS Wrapper
+ * @version 1.0
+ * @date    2024-03-18
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#ifndef __THREAD_NOTICE_HPP__
+#define __THREAD_NOTICE_HPP__
+
+#include "test_utilities.hpp"
+
+test_results_t SDD_049();
+
+#endif // __THREAD_NOTICE_HPP__
\ No newline at end of file
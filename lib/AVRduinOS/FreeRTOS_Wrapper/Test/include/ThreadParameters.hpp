@@ -0,0 +1,21 @@
+/**
+ ********************************************************************************
+ * @file    ThreadParameters.hpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Unit Tests for Thread Parameters in the FreeRTOS Wrapper
+ * @version 1.0
+ * @date    2024-03-18
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#ifndef __THREAD_PARAMETERS_HPP__
+#define __THREAD_PARAMETERS_HPP__
+
+#include "test_utilities.hpp"
+
+test_results_t SDD_030();
+test_results_t SDD_031();
+
+#endif // __THREAD_PARAMETERS_HPP__
\ No newline at end of file
@@ -0,0 +1,24 @@
+/**
+ ********************************************************************************
+ * @file    ThreadPeriod.hpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Unit Tests for the Periodic Thread Functions in the FreeRTOS Wrapper
+ * @version 1.0
+ * @date    2024-03-18
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#ifndef __THREAD_PERIOD_HPP__
+#define __THREAD_PERIOD_HPP__
+
+#include "test_utilities.hpp"
+
+test_results_t SDD_032();
+test_results_t SDD_033();
+test_results_t SDD_034();
+test_results_t SDD_061();
+test_results_t SDD_062();
+
+#endif // __THREAD_PERIOD_HPP__
\ No newline at end of file
@@ -0,0 +1,21 @@
+/**
+ ********************************************************************************
+ * @file    ThreadStack.hpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Unit Tests for the Stack Monitor Functions in the FreeRTOS Wrapper
+ * @version 1.0
+ * @date    2024-03-18
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#ifndef __THREAD_STACK_HPP__
+#define __THREAD_STACK_HPP__
+
+#include "test_utilities.hpp"
+
+test_results_t SDD_041();
+test_results_t SDD_042();
+
+#endif // __THREAD_STACK_HPP__
\ No newline at end of file
@@ -0,0 +1,20 @@
+/**
+ ********************************************************************************
+ * @file    ThreadStats.hpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Unit Tests for the Run Time Statistics Functions in the FreeRTOS Wrapper
+ * @version 1.0
+ * @date    2024-03-18
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#ifndef __THREAD_STATS_HPP__
+#define __THREAD_STATS_HPP__
+
+#include "test_utilities.hpp"
+
+test_results_t SDD_040();
+
+#endif // __THREAD_STATS_HPP__
\ No newline at end of file
@@ -0,0 +1,21 @@
+/**
+ ********************************************************************************
+ * @file    ThreadTrace.hpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Unit Tests for the Trace Recorder in the FreeRTOS Wrapper
+ * @version 1.0
+ * @date    2024-03-18
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#ifndef __THREAD_TRACE_HPP__
+#define __THREAD_TRACE_HPP__
+
+#include "test_utilities.hpp"
+
+test_results_t SDD_043();
+test_results_t SDD_044();
+
+#endif // __THREAD_TRACE_HPP__
\ No newline at end of file
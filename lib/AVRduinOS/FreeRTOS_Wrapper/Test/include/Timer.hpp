@@ -0,0 +1,21 @@
+/**
+ ********************************************************************************
+ * @file    Timer.hpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Unit Tests for the Software Timer Functions in the FreeRTOS Wrapper
+ * @version 1.0
+ * @date    2024-03-18
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#ifndef __TIMER_HPP__
+#define __TIMER_HPP__
+
+#include "test_utilities.hpp"
+
+test_results_t SDD_052();
+test_results_t SDD_053();
+
+#endif // __TIMER_HPP__
\ No newline at end of file
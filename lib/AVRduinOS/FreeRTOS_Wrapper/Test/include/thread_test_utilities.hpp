@@ -15,12 +15,23 @@
 
 #include "FreeRTOS_Wrapper.h"
 
-static bool test_booleans[32];
-static thread_time_t delay_test_time;
+// Handshake between a delay test and ThreadDelay_Test
+#define DELAY_TEST_START 0x01
+#define DELAY_TEST_DONE  0x02
+extern thread_event_group_handle_t delay_test_events;
+extern volatile thread_time_t delay_test_time;
+
+// Burst of an overload test, busy for busy_ms once start_ms passed
+typedef struct __overload_test {
+    thread_time_t start_ms;
+    thread_time_t busy_ms;
+} overload_test_t;
 
 void Valid_Function(void* params = NULL);
 void Valid_Function2(void* params = NULL);
 
 void ThreadDelay_Test(void* params = NULL);
+void ThreadParameter_Test(void* params);
+void Overload_Test(void* params);
 
 #endif // __THREAD_TEST_UTILITIES_HPP__
\ No newline at end of file
@@ -0,0 +1,295 @@
+/**
+ ********************************************************************************
+ * @file    Buffer.cpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Unit Tests for the Stream and Message Buffer Functions in the FreeRTOS Wrapper
+ * @version 1.0
+ * @date    2024-03-18
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#include "Buffer.hpp"
+
+#include "FreeRTOS_Wrapper.h"
+
+#include "thread_test_utilities.hpp"
+#include "test_utilities.hpp"
+
+#define BUFFER_TEST_SIZE 16
+#define BUFFER_TEST_TRIGGER 8
+#define BUFFER_TEST_FRAME 5
+
+static thread_stream_buffer_handle_t buffer_test_stream = NULL;
+static thread_message_buffer_handle_t buffer_test_messages = NULL;
+static volatile unsigned long buffer_test_stream_wakes = 0;
+static volatile unsigned long buffer_test_stream_bytes = 0;
+static volatile unsigned long buffer_test_message_length = 0;
+static volatile unsigned long buffer_test_message_sum = 0;
+
+static const uint8_t buffer_test_data[BUFFER_TEST_SIZE] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
+
+test_results_t SDD_054() {
+    const char *testDescription = "This function will verify that " \
+        "the buffer creation functions throw an error if the handle, size " \
+        "or trigger level is invalid, that a stream buffer sends part of " \
+        "what does not fit, and that a message buffer sends whole messages.";
+    
+    const char *testResultsList[] = {"Error is thrown when NULL handle pointer",
+                                     "Error is thrown when not NULL handle",
+                                     "Error is thrown when zero size or trigger above size",
+                                     "A stream send beyond the space sends part and is full",
+                                     "A message send beyond the space sends nothing and is full",
+                                     "A message longer than the receive capacity is left"};
+
+    TestPreamble(testDescription, NULL, NULL, testResultsList);
+
+    uint8_t received[BUFFER_TEST_SIZE] = {0};
+    thread_buffer_size_t count = 0;
+    thread_stream_buffer_handle_t stream = NULL;
+    thread_message_buffer_handle_t messages = NULL;
+    thread_return_t retval;
+
+    struct test_case_data {
+        bool null_pointer;
+        thread_stream_buffer_handle_t handle;
+        thread_buffer_size_t size;
+        thread_buffer_size_t trigger;
+        thread_return_t expected;
+        const char *case_name;
+    } Test_Cases[] = {
+        {true,  NULL,                                   16, 1,  THREAD_HANDLE_INVALID,  "NULL Handle Pointer (Invalid)"},
+        {false, (thread_stream_buffer_handle_t)0x1234,  16, 1,  THREAD_HANDLE_INVALID,  "non-NULL Handle (Invalid)"},
+        {false, NULL,                                   0,  1,  THREAD_BUFFER_INVALID,  "Zero Size (Invalid)"},
+        {false, NULL,                                   16, 0,  THREAD_BUFFER_INVALID,  "Zero Trigger Level (Invalid)"},
+        {false, NULL,                                   16, 17, THREAD_BUFFER_INVALID,  "Trigger Level above Size (Invalid)"},
+        {false, NULL,                                   16, 8,  THREAD_SUCCESS,         "Valid Inputs (Valid)"}
+    };
+
+    for (test_case_data Test_Case : Test_Cases) {
+        Print("Creating Stream Buffer with %s", Test_Case.case_name);
+        thread_stream_buffer_handle_t handle = Test_Case.handle;
+        retval = CreateStreamBuffer(Test_Case.null_pointer ? NULL : &handle, Test_Case.size, Test_Case.trigger);
+        Verify("Stream Buffer Creation Status", Test_Case.expected, retval, EQUAL);
+        if (retval == THREAD_SUCCESS) {
+            Print("Deleting Stream Buffer...");
+            DeleteStreamBuffer(&handle);
+            Verify("Stream Buffer Handle", 0ul, (unsigned long)(uintptr_t)handle, EQUAL);
+        }
+    }
+
+    // Stream Buffer
+    Print("Creating Stream Buffer");
+    retval = CreateStreamBuffer(&stream, BUFFER_TEST_SIZE, BUFFER_TEST_TRIGGER);
+    Verify("Stream Buffer Creation Status", THREAD_SUCCESS, retval, EQUAL);
+    if (retval != THREAD_SUCCESS) goto Early_Fail_Jump;
+
+    Print("Sending 12 Bytes Twice");
+    retval = StreamBufferSend(&stream, buffer_test_data, 12, 0, &count);
+    Verify("Stream Send Status", THREAD_SUCCESS, retval, EQUAL);
+    Verify("Stream Bytes Sent", 12ul, (unsigned long)count, EQUAL);
+    retval = StreamBufferSend(&stream, buffer_test_data, 12, 0, &count);
+    Verify("Stream Send Status", THREAD_BUFFER_FULL, retval, EQUAL);
+    Verify("Stream Bytes Sent", (unsigned long)(BUFFER_TEST_SIZE - 12), (unsigned long)count, EQUAL);
+    Verify("Stream Bytes Available", (unsigned long)BUFFER_TEST_SIZE, (unsigned long)StreamBufferAvailable(&stream), EQUAL);
+    Verify("Stream Space", 0ul, (unsigned long)StreamBufferSpace(&stream), EQUAL);
+
+    Print("Receiving in Order");
+    retval = StreamBufferReceive(&stream, received, sizeof(received), 0, &count);
+    Verify("Stream Receive Status", THREAD_SUCCESS, retval, EQUAL);
+    Verify("Stream Bytes Received", (unsigned long)BUFFER_TEST_SIZE, (unsigned long)count, EQUAL);
+    Verify("First Byte", 1ul, (unsigned long)received[0], EQUAL);
+    Verify("Last Byte", (unsigned long)(BUFFER_TEST_SIZE - 12), (unsigned long)received[BUFFER_TEST_SIZE - 1], EQUAL);
+    retval = StreamBufferReceive(&stream, received, sizeof(received), 0, &count);
+    Verify("Stream Receive Status", THREAD_BUFFER_EMPTY, retval, EQUAL);
+
+    Print("Changing the Trigger Level");
+    Verify("Stream Trigger Status", THREAD_BUFFER_INVALID, StreamBufferTrigger(&stream, BUFFER_TEST_SIZE + 1), EQUAL);
+    Verify("Stream Trigger Status", THREAD_SUCCESS, StreamBufferTrigger(&stream, 1), EQUAL);
+
+    Print("Deleting Stream Buffer...");
+    DeleteStreamBuffer(&stream);
+
+    // Message Buffer
+    Print("Creating Message Buffer too small for a Length (Invalid)");
+    retval = CreateMessageBuffer(&messages, sizeof(size_t));
+    Verify("Message Buffer Creation Status", THREAD_BUFFER_INVALID, retval, EQUAL);
+    Print("Creating Message Buffer");
+    retval = CreateMessageBuffer(&messages, BUFFER_TEST_SIZE + sizeof(size_t));
+    Verify("Message Buffer Creation Status", THREAD_SUCCESS, retval, EQUAL);
+    if (retval != THREAD_SUCCESS) goto Early_Fail_Jump;
+
+    Print("Sending 12 Byte Messages until Full");
+    retval = MessageBufferSend(&messages, buffer_test_data, 12, 0);
+    Verify("Message Send Status", THREAD_SUCCESS, retval, EQUAL);
+    retval = MessageBufferSend(&messages, buffer_test_data, 12, 0);
+    Verify("Message Send Status", THREAD_BUFFER_FULL, retval, EQUAL);
+
+    Print("Receiving into a short Buffer");
+    retval = MessageBufferReceive(&messages, received, 4, 0, &count);
+    Verify("Message Receive Status", THREAD_BUFFER_INVALID, retval, EQUAL);
+    Print("Receiving into a long Buffer");
+    retval = MessageBufferReceive(&messages, received, sizeof(received), 0, &count);
+    Verify("Message Receive Status", THREAD_SUCCESS, retval, EQUAL);
+    Verify("Message Length", 12ul, (unsigned long)count, EQUAL);
+    retval = MessageBufferReceive(&messages, received, sizeof(received), 0, &count);
+    Verify("Message Receive Status", THREAD_BUFFER_EMPTY, retval, EQUAL);
+
+    Print("Deleting Message Buffer...");
+    DeleteMessageBuffer(&messages);
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+    {
+        THREAD_BUFFER_STATIC_MEMORY(buffer_test_memory, BUFFER_TEST_SIZE);
+
+        Print("Creating Static Stream Buffer with NULL Memory (Invalid)");
+        retval = CreateStaticStreamBuffer(&stream, 1, NULL);
+        Verify("Stream Buffer Creation Status", THREAD_MEMORY_INVALID, retval, EQUAL);
+        Print("Creating Static Stream Buffer");
+        retval = CreateStaticStreamBuffer(&stream, 1, &buffer_test_memory);
+        Verify("Stream Buffer Creation Status", THREAD_SUCCESS, retval, EQUAL);
+        if (retval == THREAD_SUCCESS) {
+            retval = StreamBufferSend(&stream, buffer_test_data, BUFFER_TEST_SIZE, 0, &count);
+            Verify("Stream Send Status", THREAD_SUCCESS, retval, EQUAL);
+            Print("Deleting Stream Buffer...");
+            DeleteStreamBuffer(&stream);
+        }
+    }
+#endif // configSUPPORT_STATIC_ALLOCATION
+
+    Early_Fail_Jump:
+
+    TestPostamble();
+}
+
+void SDD_055_StreamReader(void *params __attribute__((unused))) {
+    uint8_t data[BUFFER_TEST_SIZE];
+    thread_buffer_size_t count = 0;
+
+    for (;;) {
+        if (StreamBufferReceive(&buffer_test_stream, data, sizeof(data), 1000, &count) == THREAD_SUCCESS) {
+            buffer_test_stream_bytes += count;
+            buffer_test_stream_wakes++;
+        }
+    }
+}
+
+void SDD_055_MessageReader(void *params __attribute__((unused))) {
+    uint8_t data[BUFFER_TEST_SIZE];
+    thread_buffer_size_t length = 0;
+
+    for (;;) {
+        if (MessageBufferReceive(&buffer_test_messages, data, sizeof(data), 1000, &length) == THREAD_SUCCESS) {
+            unsigned long sum = 0;
+            for (thread_buffer_size_t i = 0; i < length; i++) sum += data[i];
+            buffer_test_message_sum = sum;
+            buffer_test_message_length = length;
+        }
+    }
+}
+
+void SDD_055_Thread(void *params __attribute__((unused))) {
+    thread_buffer_size_t sent = 0;
+    thread_isr_yield_t yield = THREAD_ISR_YIELD_INIT;
+
+    // Lets both readers block on their buffers
+    ThreadDelay(50);
+
+    Print("Sending Bytes below the Trigger Level from an Interrupt...");
+    EnterThreadCritical();
+    thread_return_t retval = StreamBufferSendFromISR(&buffer_test_stream, buffer_test_data, BUFFER_TEST_TRIGGER - 1, &sent, &yield);
+    ExitThreadCritical();
+    Verify("Stream Send Status", THREAD_SUCCESS, retval, EQUAL);
+    Verify("Yield Requested", (unsigned long)pdFALSE, (unsigned long)yield, EQUAL);
+    ThreadDelay(50);
+    Verify("Stream Reader Wakes", 0ul, buffer_test_stream_wakes, EQUAL);
+
+    Print("Sending the Byte reaching the Trigger Level from an Interrupt...");
+    EnterThreadCritical();
+    retval = StreamBufferSendFromISR(&buffer_test_stream, buffer_test_data, 1, &sent, &yield);
+    ExitThreadCritical();
+    Verify("Stream Send Status", THREAD_SUCCESS, retval, EQUAL);
+    Verify("Yield Requested", (unsigned long)pdFALSE, (unsigned long)yield, NOT_EQUAL);
+    ThreadDelay(50);
+    Verify("Stream Reader Wakes", 1ul, buffer_test_stream_wakes, EQUAL);
+    Verify("Stream Bytes Received", (unsigned long)BUFFER_TEST_TRIGGER, buffer_test_stream_bytes, EQUAL);
+
+    Print("Sending a Frame from an Interrupt...");
+    yield = THREAD_ISR_YIELD_INIT;
+    EnterThreadCritical();
+    retval = MessageBufferSendFromISR(&buffer_test_messages, buffer_test_data, BUFFER_TEST_FRAME, &yield);
+    ExitThreadCritical();
+    Verify("Message Send Status", THREAD_SUCCESS, retval, EQUAL);
+    Verify("Yield Requested", (unsigned long)pdFALSE, (unsigned long)yield, NOT_EQUAL);
+    ThreadDelay(50);
+    Verify("Message Length", (unsigned long)BUFFER_TEST_FRAME, buffer_test_message_length, EQUAL);
+    Verify("Message Sum", 15ul, buffer_test_message_sum, EQUAL);
+
+    StopThreadScheduler();
+}
+
+test_results_t SDD_055() {
+    const char *testDescription = "This function will verify that " \
+        "a stream buffer reader wakes once the trigger level is reached " \
+        "and a message buffer reader wakes with a whole frame, both sent " \
+        "from an interrupt.";
+    
+    const char *testPreconditionsList[] = {"High priority readers blocked on a stream and a message buffer",
+                                           "Medium priority thread sending from a critical section"};
+    const char *testResultsList[] = {"Bytes below the trigger level leave the reader blocked",
+                                     "The byte reaching the trigger level wakes the reader",
+                                     "A frame wakes the message reader whole"};
+
+    TestPreamble(testDescription, NULL, testPreconditionsList, testResultsList);
+
+    thread_handle_t stream_handle = NULL;
+    thread_handle_t message_handle = NULL;
+    thread_handle_t test_handle = NULL;
+
+    // Creating Buffers
+    Print("Creating Stream and Message Buffers");
+    buffer_test_stream_wakes = 0;
+    buffer_test_stream_bytes = 0;
+    buffer_test_message_length = 0;
+    buffer_test_message_sum = 0;
+    thread_return_t retval = CreateStreamBuffer(&buffer_test_stream, BUFFER_TEST_SIZE, BUFFER_TEST_TRIGGER);
+    Verify("Stream Buffer Creation Status", THREAD_SUCCESS, retval, EQUAL);
+    if (retval != THREAD_SUCCESS) goto Early_Fail_Jump;
+    retval = CreateMessageBuffer(&buffer_test_messages, BUFFER_TEST_SIZE + sizeof(size_t));
+    Verify("Message Buffer Creation Status", THREAD_SUCCESS, retval, EQUAL);
+    if (retval != THREAD_SUCCESS) goto Early_Fail_Jump;
+
+    // Creating Threads
+    Print("Creating Threads for Test");
+    {
+        thread_function_t stream_thread_config = ConfigureThread("Stream", SDD_055_StreamReader, THREAD_PRIORITY_HIGH, 128);
+        retval = CreateThread(&stream_handle, stream_thread_config);
+        Verify("Thread Creation Status", THREAD_SUCCESS, retval, EQUAL);
+        thread_function_t message_thread_config = ConfigureThread("Message", SDD_055_MessageReader, THREAD_PRIORITY_HIGH, 128);
+        retval = CreateThread(&message_handle, message_thread_config);
+        Verify("Thread Creation Status", THREAD_SUCCESS, retval, EQUAL);
+        thread_function_t test_thread_config = ConfigureThread("TestName", SDD_055_Thread, THREAD_PRIORITY_MEDIUM, 256);
+        retval = CreateThread(&test_handle, test_thread_config);
+        Verify("Thread Creation Status", THREAD_SUCCESS, retval, EQUAL);
+    }
+
+    // Starting Thread Scheduler
+    Print("Starting Thread Scheduler...");
+    StartThreadScheduler();
+
+    // Delete Threads
+    Print("Deleting Threads...");
+    DeleteThread(&stream_handle);
+    DeleteThread(&message_handle);
+    DeleteThread(&test_handle);
+
+    Early_Fail_Jump:
+
+    // Delete Buffers
+    Print("Deleting Buffers...");
+    DeleteStreamBuffer(&buffer_test_stream);
+    DeleteMessageBuffer(&buffer_test_messages);
+
+    TestPostamble();
+}
\ No newline at end of file
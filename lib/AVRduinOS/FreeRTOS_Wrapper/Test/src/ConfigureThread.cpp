@@ -112,13 +112,13 @@ test_results_t SDD_008_010() {
         "the ConfigureThread throws an error if the thread priority " \
         "is invalid.";
 
-    const char *testForLoopList[] = {"Thread Priorities (IDLE - HIGH+1)"};
+    const char *testForLoopList[] = {"Thread Priorities (IDLE - MAX+1)"};
     
     const char *testPreconditionsList[] = {"Valid Thread Name", 
                                            "Valid Thread Function",
                                            "Valid Stack Size"};
-    const char *testResultsList[] = {"Error is thrown when thread priority is not LOW, MEDIUM, or HIGH", 
-                                     "No Error is thrown when thread priority is LOW, MEDIUM, or HIGH"};
+    const char *testResultsList[] = {"Error is thrown when thread priority is not LOW through MAX", 
+                                     "No Error is thrown when thread priority is LOW through MAX"};
 
     TestPreamble(testDescription, testForLoopList, testPreconditionsList, testResultsList);
 
@@ -131,7 +131,8 @@ test_results_t SDD_008_010() {
         {THREAD_PRIORITY_LOW,       true,   "LOW (Valid)"},
         {THREAD_PRIORITY_MEDIUM,    true,   "MEDIUM (Valid)"},
         {THREAD_PRIORITY_HIGH,      true,   "HIGH (Valid)"},
-        {(thread_priority_t)(THREAD_PRIORITY_HIGH + 1), false, ">HIGH (Invalid)"}
+        {THREAD_PRIORITY_MAX,       true,   "MAX (Valid)"},
+        {(thread_priority_t)(THREAD_PRIORITY_MAX + 1), false, ">MAX (Invalid)"}
     };
 
     // Test Medium Valid Thread Function
@@ -220,7 +221,7 @@ test_results_t SDD_011() {
 
                     if (thread_config.valid == THREAD_STRUCT_VALID) {
                         Verify("Thread Name", thread_name, thread_config.thread_name, EQUAL);
-                        Verify("Thread Function", (int)thread_function.function, (int)thread_config.function, EQUAL);
+                        Verify("Thread Function", (unsigned long)(uintptr_t)thread_function.function, (unsigned long)(uintptr_t)thread_config.function, EQUAL);
                         Verify("Thread Priority", priority, thread_config.priority, EQUAL);
                         Verify("Stack Size", (int)stack_size, (int)thread_config.stack_size, EQUAL);
                     }
@@ -229,5 +230,58 @@ test_results_t SDD_011() {
         }
     }
     
+    TestPostamble();
+}
+
+test_results_t SDD_058() {
+    const char *testDescription = "This function will verify that " \
+        "ThreadRateMonotonic gives shorter periods higher priorities, " \
+        "shares a level only between equal periods and rejects period " \
+        "sets that need more levels than are available.";
+
+    const char *testPreconditionsList[] = {"Valid Thread Configurations"};
+    const char *testResultsList[] = {"Priorities follow the periods",
+                                     "Priorities are unchanged on error"};
+
+    TestPreamble(testDescription, NULL, testPreconditionsList, testResultsList);
+
+    thread_function_t thread_configs[] = {
+        ConfigureThread("Slowest", Valid_Function, THREAD_PRIORITY_LOW, 128),
+        ConfigureThread("Fastest", Valid_Function, THREAD_PRIORITY_LOW, 128),
+        ConfigureThread("Middle", Valid_Function, THREAD_PRIORITY_LOW, 128),
+        ConfigureThread("Fastest2", Valid_Function, THREAD_PRIORITY_LOW, 128)
+    };
+    for (thread_function_t &thread_config : thread_configs)
+        Verify("Thread Valid Status", THREAD_STRUCT_VALID, thread_config.valid, EQUAL);
+
+    // Null Test
+    Print("Assigning Priorities with Null Periods");
+    thread_return_t retval = ThreadRateMonotonic(thread_configs, NULL, 4, THREAD_PRIORITY_MAX);
+    Verify("Rate Monotonic Status", THREAD_MEMORY_INVALID, retval, EQUAL);
+
+    // Zero Period Test
+    Print("Assigning Priorities with a Zero Period");
+    const thread_time_t zero_periods[] = {100, 0, 50, 10};
+    retval = ThreadRateMonotonic(thread_configs, zero_periods, 4, THREAD_PRIORITY_MAX);
+    Verify("Rate Monotonic Status", THREAD_PERIOD_INVALID, retval, EQUAL);
+
+    // Assignment Test
+    Print("Assigning Priorities to Periods (100, 10, 50, 10)");
+    const thread_time_t periods[] = {100, 10, 50, 10};
+    const thread_priority_t expected[] = {(thread_priority_t)(THREAD_PRIORITY_MAX - 2), THREAD_PRIORITY_MAX,
+                                          (thread_priority_t)(THREAD_PRIORITY_MAX - 1), THREAD_PRIORITY_MAX};
+    retval = ThreadRateMonotonic(thread_configs, periods, 4, THREAD_PRIORITY_MAX);
+    Verify("Rate Monotonic Status", THREAD_SUCCESS, retval, EQUAL);
+    for (size_t i = 0; i < 4; i++)
+        Verify("Thread Priority", expected[i], thread_configs[i].priority, EQUAL);
+
+    // Exhausted Test
+    Print("Assigning Three Distinct Periods to Two Levels");
+    const thread_time_t distinct_periods[] = {10, 20, 30, 10};
+    retval = ThreadRateMonotonic(thread_configs, distinct_periods, 4, THREAD_PRIORITY_MEDIUM);
+    Verify("Rate Monotonic Status", THREAD_PRIORITY_EXHAUSTED, retval, EQUAL);
+    for (size_t i = 0; i < 4; i++)
+        Verify("Thread Priority", expected[i], thread_configs[i].priority, EQUAL);
+
     TestPostamble();
 }
\ No newline at end of file
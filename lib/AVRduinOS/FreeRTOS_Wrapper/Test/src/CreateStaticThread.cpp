@@ -0,0 +1,195 @@
+/**
+ ********************************************************************************
+ * @file    CreateStaticThread.cpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Unit Tests for the CreateStaticThread Function in the FreeRTOS Wrapper
+ * @version 1.0
+ * @date    2024-03-18
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#include "CreateStaticThread.hpp"
+
+#include "FreeRTOS_Wrapper.h"
+
+#include "thread_test_utilities.hpp"
+#include "test_utilities.hpp"
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+
+THREAD_STATIC_MEMORY(static_test_memory, 128);
+THREAD_STATIC_MEMORY(small_test_memory, 16);
+
+test_results_t SDD_026_029() {
+    const char *testDescription = "This function will verify that " \
+        "the CreateStaticThread function throws an error if the thread handle " \
+        "pointer is NULL.";
+    
+    const char *testPreconditionsList[] = {"Valid Thread Configuration",
+                                           "Valid Static Thread Memory"};
+    const char *testResultsList[] = {"Error is thrown when NULL handle pointer", 
+                                     "No Error is thrown when defined handle pointer"};
+
+    TestPreamble(testDescription, NULL, testPreconditionsList, testResultsList);
+
+    // Configuring Valid Thread
+    Print("Configuring Thread with Valid Name");
+    thread_function_t thread_config = ConfigureThread("TestName", Valid_Function, THREAD_PRIORITY_MEDIUM, 128);
+    Verify("Thread Valid Status", THREAD_STRUCT_VALID, thread_config.valid, EQUAL);
+
+    // Creating Thread with Null Thread Handle Pointer
+    {
+        Print("Creating Static Thread with NULL Handle Pointer");
+        thread_handle_t *handle_ptr = NULL; 
+        thread_return_t retval = CreateStaticThread(handle_ptr, thread_config, &static_test_memory);
+        Verify("Thread Creation Status", THREAD_SUCCESS, retval, NOT_EQUAL);
+        if (retval == THREAD_SUCCESS) {
+            Print("Deleting Thread...");
+            DeleteThread(handle_ptr);
+        }
+    }
+
+    // Creating Thread with Real Thread Handle Pointer
+    {
+        Print("Creating Static Thread with non-NULL Handle Pointer");
+        thread_handle_t handle = NULL;
+        thread_return_t retval = CreateStaticThread(&handle, thread_config, &static_test_memory);
+        Verify("Thread Creation Status", THREAD_SUCCESS, retval, EQUAL);
+        if (retval == THREAD_SUCCESS) {
+            Print("Deleting Thread...");
+            DeleteThread(&handle);
+        }
+    }
+
+    TestPostamble();
+}
+
+test_results_t SDD_027_029() {
+    const char *testDescription = "This function will verify that " \
+        "the CreateStaticThread function throws an error if the thread " \
+        "configuration is invalid.";
+    
+    const char *testPreconditionsList[] = {"Non-NULL Thread Handle Pointer",
+                                           "NULL Thread Handle",
+                                           "Valid Static Thread Memory"};
+    const char *testResultsList[] = {"Error is thrown when invalid configuration", 
+                                     "No Error is thrown when valid configuration"};
+
+    TestPreamble(testDescription, NULL, testPreconditionsList, testResultsList);
+
+    // Creating Thread with Invalid Configuration
+    {
+        Print("Creating Invalid Thread Configuration");
+        thread_function_t thread_config = ConfigureThread("TestName", NULL, THREAD_PRIORITY_MEDIUM, 128);
+        Verify("Thread Valid Status", THREAD_STRUCT_VALID, thread_config.valid, NOT_EQUAL);
+
+        Print("Creating Static Thread with Invalid Thread Configuration");
+        thread_handle_t handle = NULL;
+        thread_return_t retval = CreateStaticThread(&handle, thread_config, &static_test_memory);
+        Verify("Thread Creation Status", THREAD_SUCCESS, retval, NOT_EQUAL);
+        if (retval == THREAD_SUCCESS) {
+            Print("Deleting Thread...");
+            DeleteThread(&handle);
+        }
+    }
+
+    // Creating Thread with Valid Configuration
+    {
+        Print("Creating Valid Thread Configuration");
+        thread_function_t thread_config = ConfigureThread("TestName", Valid_Function, THREAD_PRIORITY_MEDIUM, 128);
+        Verify("Thread Valid Status", THREAD_STRUCT_VALID, thread_config.valid, EQUAL);
+
+        Print("Creating Static Thread with Valid Thread Configuration");
+        thread_handle_t handle = NULL;
+        thread_return_t retval = CreateStaticThread(&handle, thread_config, &static_test_memory);
+        Verify("Thread Creation Status", THREAD_SUCCESS, retval, EQUAL);
+        if (retval == THREAD_SUCCESS) {
+            Print("Deleting Thread...");
+            DeleteThread(&handle);
+        }
+    }
+
+    TestPostamble();
+}
+
+test_results_t SDD_028_029() {
+    const char *testDescription = "This function will verify that " \
+        "the CreateStaticThread function throws an error if the static " \
+        "memory is missing or smaller than the configured stack size.";
+    
+    const char *testPreconditionsList[] = {"Non-NULL Thread Handle Pointer",
+                                           "NULL Thread Handle",
+                                           "Valid Thread Configuration"};
+    const char *testResultsList[] = {"Error is thrown when NULL memory", 
+                                     "Error is thrown when memory is too small",
+                                     "No Error is thrown when memory is large enough"};
+
+    TestPreamble(testDescription, NULL, testPreconditionsList, testResultsList);
+
+    // Configuring Valid Thread
+    Print("Configuring Thread with Stack Size 128");
+    thread_function_t thread_config = ConfigureThread("TestName", Valid_Function, THREAD_PRIORITY_MEDIUM, 128);
+    Verify("Thread Valid Status", THREAD_STRUCT_VALID, thread_config.valid, EQUAL);
+
+    struct test_case_data {
+        thread_static_memory_t *memory;
+        bool valid;
+        const char *case_name;
+    } Test_Cases[] = {
+        {NULL,                  false,  "NULL Memory (Invalid)"},
+        {&small_test_memory,    false,  "16 Word Stack (Invalid)"},
+        {&static_test_memory,   true,   "128 Word Stack (Valid)"}
+    };
+
+    for (test_case_data Test_Case : Test_Cases) {
+        Print("Creating Static Thread with %s", Test_Case.case_name);
+        thread_handle_t handle = NULL;
+        thread_return_t retval = CreateStaticThread(&handle, thread_config, Test_Case.memory);
+        Verify("Thread Creation Status", THREAD_SUCCESS, retval, Test_Case.valid ? EQUAL : NOT_EQUAL);
+        if (retval == THREAD_SUCCESS) {
+            Print("Deleting Thread...");
+            DeleteThread(&handle);
+        }
+    }
+
+    TestPostamble();
+}
+
+test_results_t SDD_029() {
+    const char *testDescription = "This function will verify that " \
+        "the CreateStaticThread function sets the thread handle if " \
+        "parameters are valid and the task is created in the static memory.";
+    
+    const char *testPreconditionsList[] = {"Non-NULL Thread Handle Pointer",
+                                           "NULL Thread Handle",
+                                           "Valid Thread Configuration",
+                                           "Valid Static Thread Memory"};
+    const char *testResultsList[] = {"Thread Handle is set when valid inputs and successful task creation",
+                                     "Thread Handle refers to the static control block"};
+
+    TestPreamble(testDescription, NULL, testPreconditionsList, testResultsList);
+
+    // Creating Thread
+    {
+        Print("Creating Valid Thread Configuration");
+        thread_function_t thread_config = ConfigureThread("TestName", Valid_Function, THREAD_PRIORITY_MEDIUM, 128);
+        Verify("Thread Valid Status", THREAD_STRUCT_VALID, thread_config.valid, EQUAL);
+
+        Print("Creating Static Thread with Valid Thread Configuration");
+        thread_handle_t handle = NULL;
+        thread_return_t retval = CreateStaticThread(&handle, thread_config, &static_test_memory);
+        Verify("Thread Creation Status", THREAD_SUCCESS, retval, EQUAL);
+        if (retval == THREAD_SUCCESS) {
+            Verify("Thread Handle", 0ul, (unsigned long)(uintptr_t)handle, NOT_EQUAL);
+            Verify("Thread Handle", (unsigned long)(uintptr_t)static_test_memory.control_block, (unsigned long)(uintptr_t)handle, EQUAL);
+            Print("Deleting Thread...");
+            DeleteThread(&handle);
+        }
+    }
+
+    TestPostamble();
+}
+
+#endif // configSUPPORT_STATIC_ALLOCATION
\ No newline at end of file
@@ -176,7 +176,7 @@ test_results_t SDD_018() {
         thread_return_t retval = CreateThread(&handle, thread_config);
         Verify("Thread Creation Status", THREAD_SUCCESS, retval, EQUAL);
         if (retval == THREAD_SUCCESS) {
-            Verify("Thread Handle", (int)NULL, (int)handle, NOT_EQUAL);
+            Verify("Thread Handle", 0ul, (unsigned long)(uintptr_t)handle, NOT_EQUAL);
             Print("Deleting Thread...");
             DeleteThread(&handle);
         }
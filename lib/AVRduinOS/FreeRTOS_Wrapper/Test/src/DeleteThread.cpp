@@ -126,7 +126,7 @@ test_results_t SDD_022() {
     if (retval != THREAD_SUCCESS) goto Early_Fail_Jump;
 
     // Test Nullification of Thread Handle
-    Verify("Thread Handle", (int)NULL, (int)handle, EQUAL);
+    Verify("Thread Handle", 0ul, (unsigned long)(uintptr_t)handle, EQUAL);
 
     Early_Fail_Jump:
 
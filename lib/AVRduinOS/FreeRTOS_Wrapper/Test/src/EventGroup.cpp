@@ -0,0 +1,252 @@
+/**
+ ********************************************************************************
+ * @file    EventGroup.cpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Unit Tests for the Event Group Functions in the FreeRTOS Wrapper
+ * @version 1.0
+ * @date    2024-03-18
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#include "EventGroup.hpp"
+
+#include "FreeRTOS_Wrapper.h"
+
+#include "thread_test_utilities.hpp"
+#include "test_utilities.hpp"
+
+#define EVENT_TEST_SENSOR 0x01
+#define EVENT_TEST_BUS    0x02
+#define EVENT_TEST_UNUSED 0x04
+#define EVENT_TEST_WAITERS 2
+
+typedef struct __event_test_waiter {
+    thread_event_wait_t wait;
+    volatile unsigned long wakes;
+    volatile thread_return_t status;
+    volatile thread_event_bits_t bits;
+} event_test_waiter_t;
+
+static thread_event_group_handle_t event_test_group = NULL;
+static event_test_waiter_t event_test_waiters[EVENT_TEST_WAITERS];
+
+test_results_t SDD_050() {
+    const char *testDescription = "This function will verify that " \
+        "the event group functions throw an error if the handle or bits " \
+        "are invalid, and that bits are set, cleared and waited on for " \
+        "any or all of them.";
+    
+    const char *testResultsList[] = {"Error is thrown when NULL handle pointer",
+                                     "Error is thrown when not NULL handle",
+                                     "Error is thrown when no bits or kernel bits",
+                                     "Wait for any succeeds with one bit set",
+                                     "Wait for all times out with one bit set",
+                                     "Wait with clear clears the bits waited for"};
+
+    TestPreamble(testDescription, NULL, NULL, testResultsList);
+
+    thread_event_group_handle_t handle = (thread_event_group_handle_t)0x1234;
+    thread_event_bits_t result = 0;
+
+    // Creating Invalid Event Groups
+    Print("Creating Event Group with NULL Handle Pointer (Invalid)");
+    thread_return_t retval = CreateEventGroup(NULL);
+    Verify("Event Group Creation Status", THREAD_HANDLE_INVALID, retval, EQUAL);
+    Print("Creating Event Group with non-NULL Handle (Invalid)");
+    retval = CreateEventGroup(&handle);
+    Verify("Event Group Creation Status", THREAD_HANDLE_INVALID, retval, EQUAL);
+
+    // Creating Event Group
+    Print("Creating Event Group");
+    handle = NULL;
+    retval = CreateEventGroup(&handle);
+    Verify("Event Group Creation Status", THREAD_SUCCESS, retval, EQUAL);
+    if (retval != THREAD_SUCCESS) goto Early_Fail_Jump;
+    Verify("Event Group Bits", 0ul, (unsigned long)EventGroupGet(&handle), EQUAL);
+
+    // Invalid Bits
+    {
+        struct test_case_data {
+            thread_event_bits_t bits;
+            const char *case_name;
+        } Test_Cases[] = {
+            {0,                                                 "No Bits (Invalid)"},
+            {(thread_event_bits_t)(THREAD_EVENT_BITS_ALL + 1),  "Kernel Bits (Invalid)"}
+        };
+
+        for (test_case_data Test_Case : Test_Cases) {
+            Print("Setting and Waiting on %s", Test_Case.case_name);
+            Verify("Event Group Set Status", THREAD_EVENT_BITS_INVALID, EventGroupSet(&handle, Test_Case.bits), EQUAL);
+            Verify("Event Group Clear Status", THREAD_EVENT_BITS_INVALID, EventGroupClear(&handle, Test_Case.bits), EQUAL);
+            retval = EventGroupWait(&handle, Test_Case.bits, WAIT_ANY, false, 0, &result);
+            Verify("Event Group Wait Status", THREAD_EVENT_BITS_INVALID, retval, EQUAL);
+        }
+    }
+
+    // Setting and Clearing
+    Print("Setting Sensor and Bus Bits");
+    Verify("Event Group Set Status", THREAD_SUCCESS, EventGroupSet(&handle, EVENT_TEST_SENSOR | EVENT_TEST_BUS), EQUAL);
+    Verify("Event Group Bits", (unsigned long)(EVENT_TEST_SENSOR | EVENT_TEST_BUS), (unsigned long)EventGroupGet(&handle), EQUAL);
+    Print("Clearing Sensor Bit");
+    Verify("Event Group Clear Status", THREAD_SUCCESS, EventGroupClear(&handle, EVENT_TEST_SENSOR), EQUAL);
+    Verify("Event Group Bits", (unsigned long)EVENT_TEST_BUS, (unsigned long)EventGroupGet(&handle), EQUAL);
+
+    // Waiting without Blocking
+    Print("Waiting for Any of Bus and Unused Bits");
+    retval = EventGroupWait(&handle, EVENT_TEST_BUS | EVENT_TEST_UNUSED, WAIT_ANY, false, 0, &result);
+    Verify("Event Group Wait Status", THREAD_SUCCESS, retval, EQUAL);
+    Verify("Event Group Wait Bits", (unsigned long)EVENT_TEST_BUS, (unsigned long)result, EQUAL);
+    Print("Waiting for All of Bus and Unused Bits");
+    retval = EventGroupWait(&handle, EVENT_TEST_BUS | EVENT_TEST_UNUSED, WAIT_ALL, false, 0, &result);
+    Verify("Event Group Wait Status", THREAD_EVENT_TIMEOUT, retval, EQUAL);
+    Print("Waiting for Bus Bit with Clear");
+    retval = EventGroupWait(&handle, EVENT_TEST_BUS, WAIT_ALL, true, 0, NULL);
+    Verify("Event Group Wait Status", THREAD_SUCCESS, retval, EQUAL);
+    Verify("Event Group Bits", 0ul, (unsigned long)EventGroupGet(&handle), EQUAL);
+
+    // Delete Event Group
+    Print("Deleting Event Group...");
+    DeleteEventGroup(&handle);
+    Verify("Event Group Handle", 0ul, (unsigned long)(uintptr_t)handle, EQUAL);
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+    {
+        THREAD_EVENT_GROUP_STATIC_MEMORY(event_test_memory);
+
+        Print("Creating Static Event Group with NULL Memory (Invalid)");
+        retval = CreateStaticEventGroup(&handle, NULL);
+        Verify("Event Group Creation Status", THREAD_MEMORY_INVALID, retval, EQUAL);
+        Print("Creating Static Event Group");
+        retval = CreateStaticEventGroup(&handle, &event_test_memory);
+        Verify("Event Group Creation Status", THREAD_SUCCESS, retval, EQUAL);
+        if (retval == THREAD_SUCCESS) {
+            Verify("Event Group Set Status", THREAD_SUCCESS, EventGroupSet(&handle, EVENT_TEST_SENSOR), EQUAL);
+            Verify("Event Group Bits", (unsigned long)EVENT_TEST_SENSOR, (unsigned long)EventGroupGet(&handle), EQUAL);
+            Print("Deleting Event Group...");
+            DeleteEventGroup(&handle);
+        }
+    }
+#endif // configSUPPORT_STATIC_ALLOCATION
+
+    Early_Fail_Jump:
+
+    TestPostamble();
+}
+
+void SDD_051_Waiter(void *params) {
+    event_test_waiter_t &waiter = *(event_test_waiter_t *)params;
+    thread_event_bits_t bits = 0;
+
+    // Waits once, so a wake is counted for the bits that satisfied it
+    waiter.status = EventGroupWait(&event_test_group, EVENT_TEST_SENSOR | EVENT_TEST_BUS, waiter.wait, false, 1000, &bits);
+    waiter.bits = bits;
+    waiter.wakes++;
+
+    for (;;) {
+        ThreadDelay(1000);
+    }
+}
+
+void SDD_051_Thread(void *params __attribute__((unused))) {
+    event_test_waiter_t &any_waiter = event_test_waiters[0];
+    event_test_waiter_t &all_waiter = event_test_waiters[1];
+
+    // Lets both waiters block on the event group
+    ThreadDelay(50);
+
+    Print("Setting Sensor Bit...");
+    Verify("Event Group Set Status", THREAD_SUCCESS, EventGroupSet(&event_test_group, EVENT_TEST_SENSOR), EQUAL);
+    ThreadDelay(50);
+    Verify("Any Waiter Wakes", 1ul, any_waiter.wakes, EQUAL);
+    Verify("Any Waiter Status", THREAD_SUCCESS, any_waiter.status, EQUAL);
+    Verify("Any Waiter Bits", (unsigned long)EVENT_TEST_SENSOR, (unsigned long)any_waiter.bits, EQUAL);
+    Verify("All Waiter Wakes", 0ul, all_waiter.wakes, EQUAL);
+
+#if (configUSE_TIMERS == 1) && (INCLUDE_xTimerPendFunctionCall == 1)
+    Print("Setting Bus Bit from an Interrupt...");
+    thread_isr_yield_t yield = THREAD_ISR_YIELD_INIT;
+    EnterThreadCritical();
+    thread_return_t retval = EventGroupSetFromISR(&event_test_group, EVENT_TEST_BUS, &yield);
+    ExitThreadCritical();
+#else
+    Print("Setting Bus Bit...");
+    thread_return_t retval = EventGroupSet(&event_test_group, EVENT_TEST_BUS);
+#endif // configUSE_TIMERS
+    Verify("Event Group Set Status", THREAD_SUCCESS, retval, EQUAL);
+    ThreadDelay(50);
+    Verify("All Waiter Wakes", 1ul, all_waiter.wakes, EQUAL);
+    Verify("All Waiter Status", THREAD_SUCCESS, all_waiter.status, EQUAL);
+    Verify("All Waiter Bits", (unsigned long)(EVENT_TEST_SENSOR | EVENT_TEST_BUS), (unsigned long)all_waiter.bits, EQUAL);
+
+    Print("Waiting 100 ms for the Unused Bit...");
+    unsigned long start_time = millis();
+    retval = EventGroupWait(&event_test_group, EVENT_TEST_UNUSED, WAIT_ANY, false, 100, NULL);
+    unsigned long end_time = millis();
+    Verify("Event Group Wait Status", THREAD_EVENT_TIMEOUT, retval, EQUAL);
+    Verify_Margin("Wait Milliseconds", 100ul, end_time - start_time, 30ul);
+
+    StopThreadScheduler();
+}
+
+test_results_t SDD_051() {
+    const char *testDescription = "This function will verify that " \
+        "threads block on an event group until any or all of their bits " \
+        "are set, from a thread or an interrupt, and that a wait times out.";
+    
+    const char *testForLoopSets[] = {"Waiters (Any, All)"};
+    const char *testPreconditionsList[] = {"Two high priority threads waiting on sensor and bus bits",
+                                           "Medium priority thread setting the bits"};
+    const char *testResultsList[] = {"The any waiter wakes on the sensor bit alone",
+                                     "The all waiter wakes once the bus bit is set",
+                                     "A wait for an unset bit times out"};
+
+    TestPreamble(testDescription, testForLoopSets, testPreconditionsList, testResultsList);
+
+    thread_handle_t waiter_handles[EVENT_TEST_WAITERS] = {NULL};
+    thread_handle_t test_handle = NULL;
+
+    // Creating Event Group
+    Print("Creating Event Group");
+    thread_return_t retval = CreateEventGroup(&event_test_group);
+    Verify("Event Group Creation Status", THREAD_SUCCESS, retval, EQUAL);
+    if (retval != THREAD_SUCCESS) goto Early_Fail_Jump;
+
+    // Creating Threads
+    Print("Creating Threads for Test");
+    for (unsigned long i = 0; i < EVENT_TEST_WAITERS; i++) {
+        event_test_waiter_t &waiter = event_test_waiters[i];
+        waiter.wait = (i == 0) ? WAIT_ANY : WAIT_ALL;
+        waiter.wakes = 0;
+        waiter.status = THREAD_FAILURE_UNKNOWN;
+        waiter.bits = 0;
+        thread_function_t waiter_thread_config = ConfigureThreadWithParameters("Waiter", SDD_051_Waiter, THREAD_PRIORITY_HIGH, 128, (void *)&waiter);
+        retval = CreateThread(&waiter_handles[i], waiter_thread_config);
+        Verify("Thread Creation Status", THREAD_SUCCESS, retval, EQUAL);
+    }
+    {
+        thread_function_t test_thread_config = ConfigureThread("TestName", SDD_051_Thread, THREAD_PRIORITY_MEDIUM, 256);
+        retval = CreateThread(&test_handle, test_thread_config);
+        Verify("Thread Creation Status", THREAD_SUCCESS, retval, EQUAL);
+    }
+
+    // Starting Thread Scheduler
+    Print("Starting Thread Scheduler...");
+    StartThreadScheduler();
+
+    // Delete Threads
+    Print("Deleting Threads...");
+    for (thread_handle_t &waiter_handle : waiter_handles) {
+        DeleteThread(&waiter_handle);
+    }
+    DeleteThread(&test_handle);
+
+    // Delete Event Group
+    Print("Deleting Event Group...");
+    DeleteEventGroup(&event_test_group);
+
+    Early_Fail_Jump:
+
+    TestPostamble();
+}
\ No newline at end of file
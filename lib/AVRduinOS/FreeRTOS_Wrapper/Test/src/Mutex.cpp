@@ -0,0 +1,206 @@
+/**
+ ********************************************************************************
+ * @file    Mutex.cpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Unit Tests for the Mutex Functions in the FreeRTOS Wrapper
+ * @version 1.0
+ * @date    2024-03-18
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#include "Mutex.hpp"
+
+#include "FreeRTOS_Wrapper.h"
+
+#include "thread_test_utilities.hpp"
+#include "test_utilities.hpp"
+
+#define MUTEX_TEST_HOLD_MS 300
+#define MUTEX_TEST_WAIT_MS 60
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+THREAD_MUTEX_STATIC_MEMORY(mutex_test_memory);
+#endif // configSUPPORT_STATIC_ALLOCATION
+
+static thread_mutex_t mutex_test_mutex = THREAD_MUTEX_INIT;
+static thread_handle_t mutex_test_holder_handle = NULL;
+static UBaseType_t mutex_test_holder_priority = 0;
+
+test_results_t SDD_045() {
+    const char *testDescription = "This function will verify that " \
+        "the mutex creation functions throw an error if the mutex is invalid " \
+        "and that a deleted mutex can no longer be locked.";
+    
+    const char *testResultsList[] = {"Error is thrown when NULL mutex pointer",
+                                     "No Error is thrown when valid inputs",
+                                     "Error is thrown when the mutex already exists",
+                                     "Handle is nullified when the mutex is deleted",
+                                     "Error is thrown when locking a deleted mutex"};
+
+    TestPreamble(testDescription, NULL, NULL, testResultsList);
+
+    thread_mutex_t mutex = THREAD_MUTEX_INIT;
+
+    Print("Creating Mutex with NULL Mutex Pointer (Invalid)");
+    thread_return_t retval = CreateMutex(NULL);
+    Verify("Mutex Creation Status", THREAD_HANDLE_INVALID, retval, EQUAL);
+
+    Print("Creating Mutex with Valid Inputs (Valid)");
+    retval = CreateMutex(&mutex);
+    Verify("Mutex Creation Status", THREAD_SUCCESS, retval, EQUAL);
+    Verify("Mutex Handle", 0ul, (unsigned long)(uintptr_t)mutex.handle, NOT_EQUAL);
+    Verify("Mutex Holder", 0ul, (unsigned long)(uintptr_t)MutexHolder(&mutex), EQUAL);
+
+    Print("Creating Mutex over an Existing Mutex (Invalid)");
+    thread_mutex_handle_t existing = mutex.handle;
+    retval = CreateMutex(&mutex);
+    Verify("Mutex Creation Status", THREAD_HANDLE_INVALID, retval, EQUAL);
+    Verify("Mutex Handle", (unsigned long)(uintptr_t)existing, (unsigned long)(uintptr_t)mutex.handle, EQUAL);
+
+    Print("Deleting Mutex...");
+    retval = DeleteMutex(&mutex);
+    Verify("Mutex Deletion Status", THREAD_SUCCESS, retval, EQUAL);
+    Verify("Mutex Handle", 0ul, (unsigned long)(uintptr_t)mutex.handle, EQUAL);
+
+    Print("Locking Deleted Mutex (Invalid)");
+    retval = MutexLock(&mutex, 0);
+    Verify("Mutex Lock Status", THREAD_HANDLE_INVALID, retval, EQUAL);
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+    Print("Creating Static Mutex with NULL Memory (Invalid)");
+    retval = CreateStaticMutex(&mutex, NULL);
+    Verify("Mutex Creation Status", THREAD_MEMORY_INVALID, retval, EQUAL);
+
+    Print("Creating Static Mutex with Valid Inputs (Valid)");
+    retval = CreateStaticMutex(&mutex, &mutex_test_memory);
+    Verify("Mutex Creation Status", THREAD_SUCCESS, retval, EQUAL);
+    Verify("Mutex Handle", (unsigned long)(uintptr_t)&mutex_test_memory, (unsigned long)(uintptr_t)mutex.handle, EQUAL);
+
+    Print("Deleting Mutex...");
+    DeleteMutex(&mutex);
+#endif // configSUPPORT_STATIC_ALLOCATION
+
+    TestPostamble();
+}
+
+void SDD_046_Holder(void *params __attribute__((unused))) {
+    MutexLock(&mutex_test_mutex, 0);
+    ThreadDelay(MUTEX_TEST_HOLD_MS);
+
+    // A higher priority thread is waiting on the mutex by now
+    mutex_test_holder_priority = uxTaskPriorityGet(NULL);
+    MutexUnlock(&mutex_test_mutex);
+
+    for (;;) {
+        ThreadDelay(1000);
+    }
+}
+
+void SDD_046_Thread(void *params __attribute__((unused))) {
+    ThreadDelay(MUTEX_TEST_WAIT_MS);
+
+    Print("Checking Mutex Holder...");
+    Verify("Mutex Holder", (unsigned long)(uintptr_t)mutex_test_holder_handle, (unsigned long)(uintptr_t)MutexHolder(&mutex_test_mutex), EQUAL);
+    thread_return_t retval = MutexUnlock(&mutex_test_mutex);
+    Verify("Mutex Unlock Status by Other Thread", THREAD_MUTEX_NOT_HOLDER, retval, EQUAL);
+
+    Print("Locking Held Mutex with Short Wait...");
+    retval = MutexLock(&mutex_test_mutex, MUTEX_TEST_WAIT_MS);
+    Verify("Mutex Lock Status", THREAD_MUTEX_TIMEOUT, retval, EQUAL);
+
+    Print("Locking Held Mutex with Long Wait...");
+    retval = MutexLock(&mutex_test_mutex, 4 * MUTEX_TEST_HOLD_MS);
+    Verify("Mutex Lock Status", THREAD_SUCCESS, retval, EQUAL);
+    Verify("Holder Inherited Priority", (unsigned long)THREAD_PRIORITY_HIGH, (unsigned long)mutex_test_holder_priority, EQUAL);
+    Verify("Mutex Holder", (unsigned long)(uintptr_t)GetSelfThreadHandle(), (unsigned long)(uintptr_t)MutexHolder(&mutex_test_mutex), EQUAL);
+    retval = MutexUnlock(&mutex_test_mutex);
+    Verify("Mutex Unlock Status", THREAD_SUCCESS, retval, EQUAL);
+    Verify("Mutex Holder", 0ul, (unsigned long)(uintptr_t)MutexHolder(&mutex_test_mutex), EQUAL);
+
+#if (THREAD_MUTEX_STATS_ENABLED == 1)
+    Print("Reading Mutex Statistics...");
+    thread_mutex_stats_t stats;
+    retval = MutexStatsGet(&mutex_test_mutex, &stats);
+    Verify("Stats Status", THREAD_SUCCESS, retval, EQUAL);
+    Verify("Mutex Locks", 2ul, (unsigned long)stats.locks, EQUAL);
+    Verify("Mutex Contentions", 2ul, (unsigned long)stats.contentions, EQUAL);
+    Verify("Mutex Inversions", 2ul, (unsigned long)stats.inversions, EQUAL);
+    Verify("Mutex Timeouts", 1ul, (unsigned long)stats.timeouts, EQUAL);
+    Verify("Mutex Longest Hold", 1000ul * MUTEX_TEST_HOLD_MS / 2, (unsigned long)stats.hold_max, GREATER_THAN);
+    Verify("Mutex Longest Wait", 1000ul * MUTEX_TEST_WAIT_MS, (unsigned long)stats.wait_max, GREATER_THAN);
+#endif // THREAD_MUTEX_STATS_ENABLED
+
+#if (configUSE_RECURSIVE_MUTEXES == 1)
+    Print("Locking Recursive Mutex Twice...");
+    thread_mutex_t recursive = THREAD_MUTEX_INIT;
+    retval = CreateRecursiveMutex(&recursive);
+    Verify("Mutex Creation Status", THREAD_SUCCESS, retval, EQUAL);
+    Verify("Mutex Lock Status", THREAD_SUCCESS, MutexLock(&recursive, 0), EQUAL);
+    Verify("Mutex Lock Status", THREAD_SUCCESS, MutexLock(&recursive, 0), EQUAL);
+    Verify("Mutex Unlock Status", THREAD_SUCCESS, MutexUnlock(&recursive), EQUAL);
+    Verify("Mutex Holder after One Unlock", (unsigned long)(uintptr_t)GetSelfThreadHandle(), (unsigned long)(uintptr_t)MutexHolder(&recursive), EQUAL);
+    Verify("Mutex Unlock Status", THREAD_SUCCESS, MutexUnlock(&recursive), EQUAL);
+    Verify("Mutex Unlock Status when Released", THREAD_MUTEX_NOT_HOLDER, MutexUnlock(&recursive), EQUAL);
+    DeleteMutex(&recursive);
+#endif // configUSE_RECURSIVE_MUTEXES
+
+    StopThreadScheduler();
+}
+
+test_results_t SDD_046() {
+    const char *testDescription = "This function will verify that " \
+        "a mutex is held by one thread at a time, times out while held, " \
+        "lends the priority of a waiting thread to its holder and may only " \
+        "be unlocked by its holder.";
+    
+    const char *testPreconditionsList[] = {"Low priority thread holding the mutex for 300 ms",
+                                           "High priority thread locking the mutex"};
+    const char *testResultsList[] = {"Only the holder can unlock the mutex",
+                                     "Lock times out while the mutex is held",
+                                     "Holder runs at the waiting thread's priority",
+                                     "Recursive mutex is released after the last unlock"};
+
+    TestPreamble(testDescription, NULL, testPreconditionsList, testResultsList);
+
+    // Creating Mutex
+    Print("Creating Mutex");
+    thread_return_t retval = CreateMutex(&mutex_test_mutex);
+    Verify("Mutex Creation Status", THREAD_SUCCESS, retval, EQUAL);
+    if (retval != THREAD_SUCCESS) goto Early_Fail_Jump;
+
+    {
+        // Configuring Threads
+        Print("Configuring Threads for Test");
+        thread_function_t holder_thread_config = ConfigureThread("Holder", SDD_046_Holder, THREAD_PRIORITY_LOW, 128);
+        Verify("Thread Valid Status", THREAD_STRUCT_VALID, holder_thread_config.valid, EQUAL);
+        thread_function_t test_thread_config = ConfigureThread("TestName", SDD_046_Thread, THREAD_PRIORITY_HIGH, 256);
+        Verify("Thread Valid Status", THREAD_STRUCT_VALID, test_thread_config.valid, EQUAL);
+
+        // Creating Threads
+        Print("Creating Threads for Test");
+        thread_handle_t test_handle = NULL;
+        retval = CreateThread(&mutex_test_holder_handle, holder_thread_config);
+        Verify("Thread Creation Status", THREAD_SUCCESS, retval, EQUAL);
+        retval = CreateThread(&test_handle, test_thread_config);
+        Verify("Thread Creation Status", THREAD_SUCCESS, retval, EQUAL);
+
+        // Starting Thread Scheduler
+        Print("Starting Thread Scheduler...");
+        StartThreadScheduler();
+
+        // Delete Threads
+        Print("Deleting Threads...");
+        DeleteThread(&mutex_test_holder_handle);
+        DeleteThread(&test_handle);
+    }
+
+    // Delete Mutex
+    Print("Deleting Mutex...");
+    DeleteMutex(&mutex_test_mutex);
+
+    Early_Fail_Jump:
+
+    TestPostamble();
+}
\ No newline at end of file
@@ -0,0 +1,111 @@
+/**
+ ********************************************************************************
+ * @file    PooledThread.cpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Unit Tests for Block Pool Backed Threads and Queues in the FreeRTOS
+ *          Wrapper
+ * @version 1.0
+ * @date    2024-03-18
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#include "PooledThread.hpp"
+
+#include "FreeRTOS_Wrapper.h"
+
+#include "thread_test_utilities.hpp"
+#include "test_utilities.hpp"
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+
+#define POOL_TEST_STACK_SIZE 128
+#define POOL_TEST_BLOCKS 2
+
+static BlockPool<THREAD_POOL_BLOCK_SIZE(POOL_TEST_STACK_SIZE), POOL_TEST_BLOCKS> pool_test_pool;
+
+test_results_t SDD_038() {
+    const char *testDescription = "This function will verify that " \
+        "CreatePooledThread takes one block per thread from the pool, fails " \
+        "once the pool is exhausted and DeletePooledThread returns the block.";
+    
+    const char *testForLoopSets[] = {"Threads (0 - Pool Size)"};
+    const char *testPreconditionsList[] = {"Valid Thread Configuration",
+                                           "Pool of 2 Blocks sized for a 128 Word Stack"};
+    const char *testResultsList[] = {"One block is used per thread",
+                                     "Error is thrown when the pool is exhausted",
+                                     "Every block is returned when the threads are deleted"};
+
+    TestPreamble(testDescription, testForLoopSets, testPreconditionsList, testResultsList);
+
+    // Configuring Valid Thread
+    Print("Configuring Thread with Stack Size 128");
+    thread_function_t thread_config = ConfigureThread("TestName", Valid_Function, THREAD_PRIORITY_MEDIUM, POOL_TEST_STACK_SIZE);
+    Verify("Thread Valid Status", THREAD_STRUCT_VALID, thread_config.valid, EQUAL);
+
+    // Exhausting the Pool
+    thread_handle_t handles[POOL_TEST_BLOCKS + 1] = {NULL};
+    for (int i = 0; i <= POOL_TEST_BLOCKS; i++) {
+        Print("Creating Pooled Thread %d", i);
+        thread_return_t retval = CreatePooledThread(&handles[i], thread_config, pool_test_pool);
+        Verify("Thread Creation Status", THREAD_SUCCESS, retval, (i < POOL_TEST_BLOCKS) ? EQUAL : NOT_EQUAL);
+        Verify("Pool Blocks Used", (unsigned long)((i < POOL_TEST_BLOCKS) ? i + 1 : POOL_TEST_BLOCKS), (unsigned long)pool_test_pool.Used(), EQUAL);
+    }
+
+    // Returning the Blocks
+    Print("Deleting Pooled Threads...");
+    for (thread_handle_t &handle : handles) {
+        if (handle != NULL) {
+            thread_return_t retval = DeletePooledThread(&handle, pool_test_pool);
+            Verify("Thread Deletion Status", THREAD_SUCCESS, retval, EQUAL);
+        }
+    }
+    Verify("Pool Blocks Used", 0ul, (unsigned long)pool_test_pool.Used(), EQUAL);
+
+    TestPostamble();
+}
+
+test_results_t SDD_039() {
+    const char *testDescription = "This function will verify that " \
+        "CreatePooledQueue builds a working queue in a pool block and " \
+        "DeletePooledQueue returns the block.";
+    
+    const char *testPreconditionsList[] = {"Pool Block large enough for the Queue"};
+    const char *testResultsList[] = {"Queue is created in a pool block",
+                                     "Items pass through the queue",
+                                     "The block is returned when the queue is deleted"};
+
+    TestPreamble(testDescription, NULL, testPreconditionsList, testResultsList);
+
+    // Creating Pooled Queue
+    Print("Creating Pooled Queue");
+    thread_queue_handle_t queue = NULL;
+    thread_return_t retval = CreatePooledQueue(&queue, 4, sizeof(unsigned long), pool_test_pool);
+    Verify("Queue Creation Status", THREAD_SUCCESS, retval, EQUAL);
+    if (retval != THREAD_SUCCESS) goto Early_Fail_Jump;
+    Verify("Pool Blocks Used", 1ul, (unsigned long)pool_test_pool.Used(), EQUAL);
+
+    // Passing an Item
+    {
+        Print("Passing Item through Pooled Queue");
+        unsigned long item = 0xA5A5;
+        QueueSend(&queue, &item, 0);
+        item = 0;
+        retval = QueueReceive(&queue, &item, 0);
+        Verify("Queue Receive Status", THREAD_SUCCESS, retval, EQUAL);
+        Verify("Queue Item", 0xA5A5ul, item, EQUAL);
+    }
+
+    // Returning the Block
+    Print("Deleting Pooled Queue...");
+    retval = DeletePooledQueue(&queue, pool_test_pool);
+    Verify("Queue Deletion Status", THREAD_SUCCESS, retval, EQUAL);
+    Verify("Pool Blocks Used", 0ul, (unsigned long)pool_test_pool.Used(), EQUAL);
+
+    Early_Fail_Jump:
+
+    TestPostamble();
+}
+
+#endif // configSUPPORT_STATIC_ALLOCATION
\ No newline at end of file
@@ -0,0 +1,223 @@
+/**
+ ********************************************************************************
+ * @file    Queue.cpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Unit Tests for the Queue Functions in the FreeRTOS Wrapper
+ * @version 1.0
+ * @date    2024-03-18
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#include "Queue.hpp"
+
+#include "FreeRTOS_Wrapper.h"
+
+#include "thread_test_utilities.hpp"
+#include "test_utilities.hpp"
+
+#define QUEUE_TEST_LENGTH 4
+#define QUEUE_TEST_BLOCK_SIZE 64
+
+THREAD_QUEUE_BLOCK_STORAGE(queue_test_blocks, QUEUE_TEST_BLOCK_SIZE, QUEUE_TEST_LENGTH);
+
+test_results_t SDD_035() {
+    const char *testDescription = "This function will verify that " \
+        "the CreateQueue function throws an error if the handle is invalid " \
+        "or the queue has no capacity.";
+    
+    const char *testResultsList[] = {"Error is thrown when NULL handle pointer", 
+                                     "Error is thrown when not NULL handle",
+                                     "Error is thrown when zero length or item size",
+                                     "No Error is thrown when valid inputs"};
+
+    TestPreamble(testDescription, NULL, NULL, testResultsList);
+
+    struct test_case_data {
+        bool null_pointer;
+        thread_queue_handle_t handle;
+        thread_queue_length_t length;
+        thread_queue_item_size_t item_size;
+        bool valid;
+        const char *case_name;
+    } Test_Cases[] = {
+        {true,  NULL,                           4,  4,  false,  "NULL Handle Pointer (Invalid)"},
+        {false, (thread_queue_handle_t)0x1234,  4,  4,  false,  "non-NULL Handle (Invalid)"},
+        {false, NULL,                           0,  4,  false,  "Zero Length (Invalid)"},
+        {false, NULL,                           4,  0,  false,  "Zero Item Size (Invalid)"},
+        {false, NULL,                           4,  4,  true,   "Valid Inputs (Valid)"}
+    };
+
+    for (test_case_data Test_Case : Test_Cases) {
+        Print("Creating Queue with %s", Test_Case.case_name);
+        thread_queue_handle_t handle = Test_Case.handle;
+        thread_return_t retval = CreateQueue(Test_Case.null_pointer ? NULL : &handle, Test_Case.length, Test_Case.item_size);
+        Verify("Queue Creation Status", THREAD_SUCCESS, retval, Test_Case.valid ? EQUAL : NOT_EQUAL);
+        if (retval == THREAD_SUCCESS) {
+            Verify("Queue Handle", 0ul, (unsigned long)(uintptr_t)handle, NOT_EQUAL);
+            Print("Deleting Queue...");
+            DeleteQueue(&handle);
+            Verify("Queue Handle", 0ul, (unsigned long)(uintptr_t)handle, EQUAL);
+        }
+    }
+
+    TestPostamble();
+}
+
+test_results_t SDD_036() {
+    const char *testDescription = "This function will verify that " \
+        "a queue copies items in first-in first-out order and reports " \
+        "when it is full or empty.";
+    
+    const char *testForLoopSets[] = {"Items (0 - Length)"};
+    const char *testPreconditionsList[] = {"Valid Queue"};
+    const char *testResultsList[] = {"Items are received in the order sent",
+                                     "Full is returned when sending to a full queue",
+                                     "Empty is returned when receiving from an empty queue",
+                                     "Memory invalid is returned for a NULL item"};
+
+    TestPreamble(testDescription, testForLoopSets, testPreconditionsList, testResultsList);
+
+    // Creating Queue
+    Print("Creating Queue");
+    thread_queue_handle_t handle = NULL;
+    thread_return_t retval = CreateQueue(&handle, QUEUE_TEST_LENGTH, sizeof(unsigned long));
+    Verify("Queue Creation Status", THREAD_SUCCESS, retval, EQUAL);
+    if (retval != THREAD_SUCCESS) goto Early_Fail_Jump;
+
+    // Filling Queue
+    for (unsigned long item = 0; item < QUEUE_TEST_LENGTH; item++) {
+        Print("Sending Item %lu", item);
+        retval = QueueSend(&handle, &item, 0);
+        Verify("Queue Send Status", THREAD_SUCCESS, retval, EQUAL);
+    }
+    Verify("Queue Count", (unsigned long)QUEUE_TEST_LENGTH, (unsigned long)QueueCount(&handle), EQUAL);
+
+    // Sending to Full Queue
+    {
+        Print("Sending Item to Full Queue");
+        unsigned long item = QUEUE_TEST_LENGTH;
+        retval = QueueSend(&handle, &item, 0);
+        Verify("Queue Send Status", THREAD_QUEUE_FULL, retval, EQUAL);
+    }
+
+    // Draining Queue
+    for (unsigned long expected = 0; expected < QUEUE_TEST_LENGTH; expected++) {
+        Print("Receiving Item %lu", expected);
+        unsigned long item = 0;
+        retval = QueueReceive(&handle, &item, 0);
+        Verify("Queue Receive Status", THREAD_SUCCESS, retval, EQUAL);
+        Verify("Queue Item", expected, item, EQUAL);
+    }
+
+    // Receiving from Empty Queue
+    {
+        Print("Receiving Item from Empty Queue");
+        unsigned long item = 0;
+        retval = QueueReceive(&handle, &item, 0);
+        Verify("Queue Receive Status", THREAD_QUEUE_EMPTY, retval, EQUAL);
+    }
+
+    // Passing a NULL Item
+    Print("Sending and Receiving NULL Items");
+    retval = QueueSend(&handle, NULL, 0);
+    Verify("Queue Send Status", THREAD_MEMORY_INVALID, retval, EQUAL);
+    retval = QueueReceive(&handle, NULL, 0);
+    Verify("Queue Receive Status", THREAD_MEMORY_INVALID, retval, EQUAL);
+
+    // Delete Queue
+    Print("Deleting Queue...");
+    DeleteQueue(&handle);
+
+    Early_Fail_Jump:
+
+    TestPostamble();
+}
+
+test_results_t SDD_037() {
+    const char *testDescription = "This function will verify that " \
+        "a zero-copy queue passes blocks by pointer, hands out every block " \
+        "of its pool exactly once and accepts released blocks back.";
+    
+    const char *testPreconditionsList[] = {"Valid Zero-Copy Queue",
+                                           "Block Storage for 4 Blocks of 64 Bytes"};
+    const char *testResultsList[] = {"Creating over an existing queue is refused",
+                                     "Every block is inside the storage",
+                                     "No block is available once the pool is exhausted",
+                                     "The received pointer is the sent pointer",
+                                     "A released block can be acquired again",
+                                     "Releasing a block twice or a foreign pointer is refused"};
+
+    TestPreamble(testDescription, NULL, testPreconditionsList, testResultsList);
+
+    uint8_t *storage_start = (uint8_t *)queue_test_blocks;
+    uint8_t *storage_end = storage_start + sizeof(queue_test_blocks);
+    void *blocks[QUEUE_TEST_LENGTH] = {NULL};
+    void *received = NULL;
+
+    // Creating Zero-Copy Queue
+    Print("Creating Zero-Copy Queue");
+    thread_zero_copy_queue_t queue = THREAD_ZERO_COPY_QUEUE_INIT;
+    thread_return_t retval = CreateZeroCopyQueue(&queue, QUEUE_TEST_LENGTH, QUEUE_TEST_BLOCK_SIZE, queue_test_blocks);
+    Verify("Queue Creation Status", THREAD_SUCCESS, retval, EQUAL);
+    if (retval != THREAD_SUCCESS) goto Early_Fail_Jump;
+
+    Print("Creating Zero-Copy Queue over the existing one");
+    retval = CreateZeroCopyQueue(&queue, QUEUE_TEST_LENGTH, QUEUE_TEST_BLOCK_SIZE, queue_test_blocks);
+    Verify("Queue Creation Status", THREAD_HANDLE_INVALID, retval, EQUAL);
+
+    // Exhausting the Pool
+    for (void *&block : blocks) {
+        Print("Acquiring Block");
+        retval = QueueAcquireBlock(&queue, &block, 0);
+        Verify("Block Acquire Status", THREAD_SUCCESS, retval, EQUAL);
+        Verify("Block in Storage", true, (uint8_t *)block >= storage_start && (uint8_t *)block + QUEUE_TEST_BLOCK_SIZE <= storage_end, EQUAL);
+    }
+    {
+        Print("Acquiring Block from Empty Pool");
+        void *block = NULL;
+        retval = QueueAcquireBlock(&queue, &block, 0);
+        Verify("Block Acquire Status", THREAD_QUEUE_EMPTY, retval, EQUAL);
+    }
+
+    // Passing a Block
+    Print("Sending Block");
+    ((uint8_t *)blocks[0])[QUEUE_TEST_BLOCK_SIZE - 1] = 0xA5;
+    retval = QueueSendBlock(&queue, blocks[0], 0);
+    Verify("Block Send Status", THREAD_SUCCESS, retval, EQUAL);
+
+    Print("Receiving Block");
+    retval = QueueReceiveBlock(&queue, &received, 0);
+    Verify("Block Receive Status", THREAD_SUCCESS, retval, EQUAL);
+    Verify("Block Pointer", (unsigned long)(uintptr_t)blocks[0], (unsigned long)(uintptr_t)received, EQUAL);
+    Verify("Block Content", 0xA5, ((uint8_t *)received)[QUEUE_TEST_BLOCK_SIZE - 1], EQUAL);
+
+    // Recycling a Block
+    Print("Releasing Block");
+    retval = QueueReleaseBlock(&queue, received);
+    Verify("Block Release Status", THREAD_SUCCESS, retval, EQUAL);
+
+    Print("Releasing Block Twice");
+    retval = QueueReleaseBlock(&queue, received);
+    Verify("Block Release Status", THREAD_MEMORY_INVALID, retval, EQUAL);
+
+    Print("Releasing Pointers outside the Pool");
+    retval = QueueReleaseBlock(&queue, (uint8_t *)blocks[1] + 1);
+    Verify("Block Release Status", THREAD_MEMORY_INVALID, retval, EQUAL);
+    retval = QueueReleaseBlock(&queue, &received);
+    Verify("Block Release Status", THREAD_MEMORY_INVALID, retval, EQUAL);
+
+    Print("Acquiring Released Block");
+    retval = QueueAcquireBlock(&queue, &blocks[0], 0);
+    Verify("Block Acquire Status", THREAD_SUCCESS, retval, EQUAL);
+    Verify("Block Pointer", (unsigned long)(uintptr_t)received, (unsigned long)(uintptr_t)blocks[0], EQUAL);
+
+    // Delete Queue
+    Print("Deleting Zero-Copy Queue...");
+    DeleteZeroCopyQueue(&queue);
+
+    Early_Fail_Jump:
+
+    TestPostamble();
+}
\ No newline at end of file
@@ -0,0 +1,208 @@
+/**
+ ********************************************************************************
+ * @file    Schedule.cpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Unit Tests for the Schedulability Analysis in the FreeRTOS Wrapper
+ * @version 1.0
+ * @date    2024-03-18
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#include "Schedule.hpp"
+
+#include "FreeRTOS_Wrapper.h"
+
+#include "thread_test_utilities.hpp"
+#include "test_utilities.hpp"
+
+test_results_t SDD_059() {
+    const char *testDescription = "This function will verify that " \
+        "ThreadScheduleAnalyze applies the Liu-Layland bound and the " \
+        "response time analysis to sets of periodic threads.";
+
+    const char *testForLoopSets[] = {"Thread Sets (Light, Harmonic, Overloaded)"};
+    const char *testPreconditionsList[] = {"Rate Monotonic Priorities"};
+    const char *testResultsList[] = {"A light set passes both tests",
+                                     "A harmonic set at full load fails only the bound",
+                                     "An overloaded set fails both tests"};
+
+    TestPreamble(testDescription, testForLoopSets, testPreconditionsList, testResultsList);
+
+    thread_function_t thread_configs[] = {
+        ConfigureThread("Fast", Valid_Function, THREAD_PRIORITY_LOW, 128),
+        ConfigureThread("Middle", Valid_Function, THREAD_PRIORITY_LOW, 128),
+        ConfigureThread("Slow", Valid_Function, THREAD_PRIORITY_LOW, 128)
+    };
+    const thread_time_t periods[] = {50, 100, 200};
+    thread_return_t retval = ThreadRateMonotonic(thread_configs, periods, 3, THREAD_PRIORITY_MAX);
+    Verify("Rate Monotonic Status", THREAD_SUCCESS, retval, EQUAL);
+
+    thread_schedule_report_t report;
+
+    // Null Test
+    Print("Analyzing a Null Schedule");
+    retval = ThreadScheduleAnalyze(NULL, 3, &report);
+    Verify("Analysis Status", THREAD_MEMORY_INVALID, retval, EQUAL);
+
+    // Deadline Test
+    {
+        Print("Analyzing a Deadline past the Period");
+        thread_schedule_t schedule[] = {{&thread_configs[0], 50, 60, 10000}};
+        retval = ThreadScheduleAnalyze(schedule, 1, &report);
+        Verify("Analysis Status", THREAD_PERIOD_INVALID, retval, EQUAL);
+    }
+
+    // Light Set Test
+    {
+        Print("Analyzing the Light Set (10/50, 20/100, 40/200 ms)");
+        thread_schedule_t schedule[] = {
+            {&thread_configs[0], 50, 0, 10000},
+            {&thread_configs[1], 100, 0, 20000},
+            {&thread_configs[2], 200, 0, 40000}
+        };
+        retval = ThreadScheduleAnalyze(schedule, 3, &report);
+        Verify("Analysis Status", THREAD_SUCCESS, retval, EQUAL);
+        Verify("Utilization", 600ul, (unsigned long)report.utilization, EQUAL);
+        Verify("Liu-Layland Bound", 779ul, (unsigned long)report.liu_layland_bound, EQUAL);
+        Verify("Liu-Layland Pass", true, report.liu_layland_pass, EQUAL);
+        Verify("Response Time Pass", true, report.response_time_pass, EQUAL);
+        Verify("Fast Response", 10000ul, (unsigned long)schedule[0].response_us, EQUAL);
+        Verify("Middle Response", 30000ul, (unsigned long)schedule[1].response_us, EQUAL);
+        Verify("Slow Response", 80000ul, (unsigned long)schedule[2].response_us, EQUAL);
+    }
+
+    // Harmonic Set Test
+    {
+        Print("Analyzing the Harmonic Set (25/50, 50/100 ms)");
+        thread_schedule_t schedule[] = {
+            {&thread_configs[0], 50, 0, 25000},
+            {&thread_configs[1], 100, 0, 50000}
+        };
+        retval = ThreadScheduleAnalyze(schedule, 2, &report);
+        Verify("Analysis Status", THREAD_SUCCESS, retval, EQUAL);
+        Verify("Utilization", 1000ul, (unsigned long)report.utilization, EQUAL);
+        Verify("Liu-Layland Pass", false, report.liu_layland_pass, EQUAL);
+        Verify("Response Time Pass", true, report.response_time_pass, EQUAL);
+        Verify("Middle Response", 100000ul, (unsigned long)schedule[1].response_us, EQUAL);
+    }
+
+    // Overloaded Set Test
+    {
+        Print("Analyzing the Overloaded Set (30/50, 50/100 ms)");
+        thread_schedule_t schedule[] = {
+            {&thread_configs[0], 50, 0, 30000},
+            {&thread_configs[1], 100, 0, 50000}
+        };
+        retval = ThreadScheduleAnalyze(schedule, 2, &report);
+        Verify("Analysis Status", THREAD_SCHEDULE_OVERLOAD, retval, EQUAL);
+        Verify("Utilization", 1100ul, (unsigned long)report.utilization, EQUAL);
+        Verify("Liu-Layland Pass", false, report.liu_layland_pass, EQUAL);
+        Verify("Response Time Pass", false, report.response_time_pass, EQUAL);
+        Verify("First Miss", 1ul, (unsigned long)report.first_miss, EQUAL);
+    }
+
+    TestPostamble();
+}
+
+#if (THREAD_STATS_ENABLED == 1)
+
+#define SCHEDULE_TEST_PERIOD_MS 150
+#define SCHEDULE_TEST_WCET_US 20000ul
+
+typedef struct __schedule_test_load {
+    thread_schedule_t *entry;
+    unsigned long busy_us;
+} schedule_test_load_t;
+
+void SDD_060_Periodic(void *params) {
+    schedule_test_load_t *load = (schedule_test_load_t *)params;
+
+    thread_period_t period;
+    ThreadPeriodInit(&period, load->entry->period_ms);
+    for (;;) {
+        ThreadScheduleBegin(load->entry);
+        unsigned long start_time = micros();
+        while (micros() - start_time < load->busy_us) continue;
+        ThreadScheduleEnd(load->entry);
+        ThreadPeriodWait(&period);
+    }
+}
+
+void SDD_060_Thread(void *params) {
+    thread_schedule_t *schedule = (thread_schedule_t *)params;
+
+    Print("Running the Periodic Threads...");
+    ThreadDelay(10 * SCHEDULE_TEST_PERIOD_MS);
+
+    Print("Within: %lu cycles, worst %lu us", (unsigned long)schedule[0].cycles, (unsigned long)schedule[0].exec_max_us);
+    Print("Over: %lu cycles, worst %lu us", (unsigned long)schedule[1].cycles, (unsigned long)schedule[1].exec_max_us);
+    Verify("Within Cycles", 5ul, (unsigned long)schedule[0].cycles, GREATER_THAN_OR_EQUAL);
+    Verify("Within WCET Overruns", 0ul, (unsigned long)schedule[0].wcet_overruns, EQUAL);
+    Verify_Margin("Within Worst Execution", 10000ul, (unsigned long)schedule[0].exec_max_us, 2000ul);
+    Verify("Over Cycles", 5ul, (unsigned long)schedule[1].cycles, GREATER_THAN_OR_EQUAL);
+    Verify("Over WCET Overruns", (unsigned long)schedule[1].cycles, (unsigned long)schedule[1].wcet_overruns, EQUAL);
+    Verify_Margin("Over Worst Execution", 30000ul, (unsigned long)schedule[1].exec_max_us, 2000ul);
+
+    StopThreadScheduler();
+}
+
+test_results_t SDD_060() {
+    const char *testDescription = "This function will verify that " \
+        "ThreadScheduleBegin and ThreadScheduleEnd measure the CPU time " \
+        "of each cycle and count the cycles that exceed the declared WCET.";
+
+    const char *testPreconditionsList[] = {"Run Time Statistics Enabled",
+                                           "Within Thread busy 10 ms of a 20 ms WCET",
+                                           "Over Thread busy 30 ms of a 20 ms WCET"};
+    const char *testResultsList[] = {"No overrun is counted for the Within Thread",
+                                     "Every cycle of the Over Thread is an overrun",
+                                     "Measured execution is within 2 ms of the busy time"};
+
+    TestPreamble(testDescription, NULL, testPreconditionsList, testResultsList);
+
+    // Configuring Threads
+    Print("Configuring Periodic Threads");
+    thread_function_t within_config = ConfigureThread("Within", SDD_060_Periodic, THREAD_PRIORITY_MEDIUM, 128);
+    thread_function_t over_config = ConfigureThread("Over", SDD_060_Periodic, THREAD_PRIORITY_LOW, 128);
+    thread_schedule_t schedule[] = {
+        {&within_config, SCHEDULE_TEST_PERIOD_MS, 0, SCHEDULE_TEST_WCET_US},
+        {&over_config, SCHEDULE_TEST_PERIOD_MS, 0, SCHEDULE_TEST_WCET_US}
+    };
+    schedule_test_load_t loads[] = {{&schedule[0], 10000ul}, {&schedule[1], 30000ul}};
+
+    thread_schedule_report_t report;
+    thread_return_t retval = ThreadScheduleAnalyze(schedule, 2, &report);
+    Verify("Analysis Status", THREAD_SUCCESS, retval, EQUAL);
+
+    thread_function_t within_thread_config = ConfigureThreadWithParameters("Within", SDD_060_Periodic, within_config.priority, 128, &loads[0]);
+    thread_function_t over_thread_config = ConfigureThreadWithParameters("Over", SDD_060_Periodic, over_config.priority, 128, &loads[1]);
+    thread_function_t test_thread_config = ConfigureThreadWithParameters("TestName", SDD_060_Thread, THREAD_PRIORITY_HIGH, 256, schedule);
+
+    // Creating Threads
+    Print("Creating Threads");
+    thread_handle_t within_handle = NULL;
+    thread_handle_t over_handle = NULL;
+    thread_handle_t test_handle = NULL;
+    retval = CreateThread(&within_handle, within_thread_config);
+    Verify("Thread Creation Status", THREAD_SUCCESS, retval, EQUAL);
+    retval = CreateThread(&over_handle, over_thread_config);
+    Verify("Thread Creation Status", THREAD_SUCCESS, retval, EQUAL);
+    retval = CreateThread(&test_handle, test_thread_config);
+    Verify("Thread Creation Status", THREAD_SUCCESS, retval, EQUAL);
+
+    // Starting Thread Scheduler
+    Print("Starting Thread Scheduler...");
+    StartThreadScheduler();
+
+    // Delete Threads
+    Print("Deleting Threads...");
+    DeleteThread(&within_handle);
+    DeleteThread(&over_handle);
+    DeleteThread(&test_handle);
+
+    TestPostamble();
+}
+
+#endif // THREAD_STATS_ENABLED
\ No newline at end of file
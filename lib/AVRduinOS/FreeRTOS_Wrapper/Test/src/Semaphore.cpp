@@ -0,0 +1,195 @@
+/**
+ ********************************************************************************
+ * @file    Semaphore.cpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Unit Tests for the Semaphore Functions in the FreeRTOS Wrapper
+ * @version 1.0
+ * @date    2024-03-18
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#include "Semaphore.hpp"
+
+#include "FreeRTOS_Wrapper.h"
+
+#include "thread_test_utilities.hpp"
+#include "test_utilities.hpp"
+
+#define SEMAPHORE_TEST_MAX_COUNT 3
+#define SEMAPHORE_TEST_TAKERS 2
+
+static thread_semaphore_handle_t semaphore_test_semaphore = NULL;
+static volatile unsigned long semaphore_test_taken[SEMAPHORE_TEST_TAKERS];
+
+test_results_t SDD_047() {
+    const char *testDescription = "This function will verify that " \
+        "the semaphore creation functions throw an error if the handle or " \
+        "count is invalid, and that a counting semaphore counts gives and " \
+        "takes up to its maximum.";
+    
+    const char *testResultsList[] = {"Error is thrown when NULL handle pointer",
+                                     "Error is thrown when not NULL handle",
+                                     "Error is thrown when zero or exceeded maximum count",
+                                     "Full is returned when giving at the maximum count",
+                                     "Timeout is returned when taking at zero count"};
+
+    TestPreamble(testDescription, NULL, NULL, testResultsList);
+
+    struct test_case_data {
+        bool null_pointer;
+        thread_semaphore_handle_t handle;
+        thread_semaphore_count_t max_count;
+        thread_semaphore_count_t initial_count;
+        thread_return_t expected;
+        const char *case_name;
+    } Test_Cases[] = {
+        {true,  NULL,                               3,  0,  THREAD_HANDLE_INVALID,      "NULL Handle Pointer (Invalid)"},
+        {false, (thread_semaphore_handle_t)0x1234,  3,  0,  THREAD_HANDLE_INVALID,      "non-NULL Handle (Invalid)"},
+        {false, NULL,                               0,  0,  THREAD_SEMAPHORE_INVALID,   "Zero Maximum Count (Invalid)"},
+        {false, NULL,                               3,  4,  THREAD_SEMAPHORE_INVALID,   "Initial above Maximum Count (Invalid)"},
+        {false, NULL,                               3,  1,  THREAD_SUCCESS,             "Valid Inputs (Valid)"}
+    };
+
+    for (test_case_data Test_Case : Test_Cases) {
+        Print("Creating Counting Semaphore with %s", Test_Case.case_name);
+        thread_semaphore_handle_t handle = Test_Case.handle;
+        thread_return_t retval = CreateCountingSemaphore(Test_Case.null_pointer ? NULL : &handle, Test_Case.max_count, Test_Case.initial_count);
+        Verify("Semaphore Creation Status", Test_Case.expected, retval, EQUAL);
+        if (retval == THREAD_SUCCESS) {
+            Verify("Semaphore Count", (unsigned long)Test_Case.initial_count, (unsigned long)SemaphoreCount(&handle), EQUAL);
+            Print("Deleting Semaphore...");
+            DeleteSemaphore(&handle);
+            Verify("Semaphore Handle", 0ul, (unsigned long)(uintptr_t)handle, EQUAL);
+        }
+    }
+
+    // Counting up to the Maximum
+    Print("Creating Counting Semaphore");
+    thread_semaphore_handle_t handle = NULL;
+    thread_return_t retval = CreateCountingSemaphore(&handle, SEMAPHORE_TEST_MAX_COUNT, 0);
+    Verify("Semaphore Creation Status", THREAD_SUCCESS, retval, EQUAL);
+    if (retval != THREAD_SUCCESS) goto Early_Fail_Jump;
+
+    for (unsigned long count = 1; count <= SEMAPHORE_TEST_MAX_COUNT; count++) {
+        Print("Giving Semaphore");
+        Verify("Semaphore Give Status", THREAD_SUCCESS, SemaphoreGive(&handle), EQUAL);
+        Verify("Semaphore Count", count, (unsigned long)SemaphoreCount(&handle), EQUAL);
+    }
+    {
+        Print("Giving Semaphore at the Maximum from an Interrupt");
+        thread_isr_yield_t yield = THREAD_ISR_YIELD_INIT;
+        retval = SemaphoreGiveFromISR(&handle, &yield);
+        Verify("Semaphore Give Status", THREAD_SEMAPHORE_FULL, retval, EQUAL);
+        Verify("Yield Requested", (unsigned long)pdFALSE, (unsigned long)yield, EQUAL);
+    }
+
+    // Counting down to Zero
+    for (unsigned long count = SEMAPHORE_TEST_MAX_COUNT; count > 0; count--) {
+        Print("Taking Semaphore");
+        Verify("Semaphore Take Status", THREAD_SUCCESS, SemaphoreTake(&handle, 0), EQUAL);
+        Verify("Semaphore Count", count - 1, (unsigned long)SemaphoreCount(&handle), EQUAL);
+    }
+    Print("Taking Semaphore at Zero");
+    retval = SemaphoreTake(&handle, 0);
+    Verify("Semaphore Take Status", THREAD_SEMAPHORE_TIMEOUT, retval, EQUAL);
+
+    // Delete Semaphore
+    Print("Deleting Semaphore...");
+    DeleteSemaphore(&handle);
+
+    Early_Fail_Jump:
+
+    TestPostamble();
+}
+
+void SDD_048_Taker(void *params) {
+    volatile unsigned long &taken = *(volatile unsigned long *)params;
+
+    for (;;) {
+        if (SemaphoreTake(&semaphore_test_semaphore, 1000) == THREAD_SUCCESS)
+            taken++;
+    }
+}
+
+void SDD_048_Thread(void *params __attribute__((unused))) {
+    // Lets both takers block on the semaphore
+    ThreadDelay(50);
+
+    Print("Giving Semaphore Twice from an Interrupt...");
+    thread_isr_yield_t yield = THREAD_ISR_YIELD_INIT;
+    EnterThreadCritical();
+    thread_return_t first_retval = SemaphoreGiveFromISR(&semaphore_test_semaphore, &yield);
+    thread_return_t second_retval = SemaphoreGiveFromISR(&semaphore_test_semaphore, &yield);
+    ExitThreadCritical();
+    Verify("Semaphore Give Status", THREAD_SUCCESS, first_retval, EQUAL);
+    Verify("Semaphore Give Status", THREAD_SUCCESS, second_retval, EQUAL);
+    Verify("Yield Requested", (unsigned long)pdFALSE, (unsigned long)yield, NOT_EQUAL);
+
+    ThreadDelay(50);
+    for (unsigned long i = 0; i < SEMAPHORE_TEST_TAKERS; i++) {
+        Print("Checking Taker %lu", i);
+        Verify("Semaphore Takes", 1ul, semaphore_test_taken[i], EQUAL);
+    }
+    Verify("Semaphore Count", 0ul, (unsigned long)SemaphoreCount(&semaphore_test_semaphore), EQUAL);
+
+    StopThreadScheduler();
+}
+
+test_results_t SDD_048() {
+    const char *testDescription = "This function will verify that " \
+        "gives from an interrupt wake every thread waiting on a semaphore " \
+        "and ask for a switch to the woken threads.";
+    
+    const char *testForLoopSets[] = {"Takers (0 - 1)"};
+    const char *testPreconditionsList[] = {"Two high priority threads waiting on a counting semaphore",
+                                           "Medium priority thread giving from a critical section"};
+    const char *testResultsList[] = {"Each give succeeds",
+                                     "A switch is requested",
+                                     "Each taker takes the semaphore once"};
+
+    TestPreamble(testDescription, testForLoopSets, testPreconditionsList, testResultsList);
+
+    thread_handle_t taker_handles[SEMAPHORE_TEST_TAKERS] = {NULL};
+    thread_handle_t test_handle = NULL;
+
+    // Creating Semaphore
+    Print("Creating Counting Semaphore");
+    thread_return_t retval = CreateCountingSemaphore(&semaphore_test_semaphore, SEMAPHORE_TEST_MAX_COUNT, 0);
+    Verify("Semaphore Creation Status", THREAD_SUCCESS, retval, EQUAL);
+    if (retval != THREAD_SUCCESS) goto Early_Fail_Jump;
+
+    // Creating Threads
+    Print("Creating Threads for Test");
+    for (unsigned long i = 0; i < SEMAPHORE_TEST_TAKERS; i++) {
+        semaphore_test_taken[i] = 0;
+        thread_function_t taker_thread_config = ConfigureThreadWithParameters("Taker", SDD_048_Taker, THREAD_PRIORITY_HIGH, 128, (void *)&semaphore_test_taken[i]);
+        retval = CreateThread(&taker_handles[i], taker_thread_config);
+        Verify("Thread Creation Status", THREAD_SUCCESS, retval, EQUAL);
+    }
+    {
+        thread_function_t test_thread_config = ConfigureThread("TestName", SDD_048_Thread, THREAD_PRIORITY_MEDIUM, 256);
+        retval = CreateThread(&test_handle, test_thread_config);
+        Verify("Thread Creation Status", THREAD_SUCCESS, retval, EQUAL);
+    }
+
+    // Starting Thread Scheduler
+    Print("Starting Thread Scheduler...");
+    StartThreadScheduler();
+
+    // Delete Threads
+    Print("Deleting Threads...");
+    for (thread_handle_t &taker_handle : taker_handles) {
+        DeleteThread(&taker_handle);
+    }
+    DeleteThread(&test_handle);
+
+    // Delete Semaphore
+    Print("Deleting Semaphore...");
+    DeleteSemaphore(&semaphore_test_semaphore);
+
+    Early_Fail_Jump:
+
+    TestPostamble();
+}
\ No newline at end of file
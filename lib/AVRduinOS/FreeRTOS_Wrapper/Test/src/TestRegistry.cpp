@@ -0,0 +1,94 @@
+/**
+ ********************************************************************************
+ * @file    TestRegistry.cpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Table of the Unit Tests in the FreeRTOS Wrapper
+ * @version 1.0
+ * @date    2024-03-18
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#include "TestRegistry.hpp"
+
+#include <Arduino_FreeRTOS.h>
+
+#include "FreeRTOS_Wrapper.h"
+#include "FreeRTOS_Wrapper_Test.hpp"
+
+const test_case_t FreeRTOS_Wrapper_Tests[] = {
+    TEST_CASE(SDD_005_010),
+    TEST_CASE(SDD_006_010),
+    TEST_CASE(SDD_007_010),
+    TEST_CASE(SDD_008_010),
+    TEST_CASE(SDD_009_010),
+    TEST_CASE(SDD_011),
+    TEST_CASE(SDD_058),
+    TEST_CASE(SDD_013_017),
+    TEST_CASE(SDD_014_017),
+    TEST_CASE(SDD_015_017),
+    TEST_CASE(SDD_018),
+    TEST_CASE(SDD_020),
+    TEST_CASE(SDD_021),
+    TEST_CASE(SDD_022),
+    TEST_CASE(SDD_025),
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+    TEST_CASE(SDD_026_029),
+    TEST_CASE(SDD_027_029),
+    TEST_CASE(SDD_028_029),
+    TEST_CASE(SDD_029),
+#endif // configSUPPORT_STATIC_ALLOCATION
+    TEST_CASE(SDD_030),
+    TEST_CASE(SDD_031),
+    TEST_CASE(SDD_032),
+    TEST_CASE(SDD_033),
+    TEST_CASE(SDD_034),
+    TEST_CASE(SDD_035),
+    TEST_CASE(SDD_036),
+    TEST_CASE(SDD_037),
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+    TEST_CASE(SDD_038),
+    TEST_CASE(SDD_039),
+#endif // configSUPPORT_STATIC_ALLOCATION
+#if (THREAD_STATS_ENABLED == 1)
+    TEST_CASE(SDD_040),
+#endif // THREAD_STATS_ENABLED
+#if (THREAD_STACK_MONITOR_THREADS > 0)
+    TEST_CASE(SDD_041),
+    TEST_CASE(SDD_042),
+#endif // THREAD_STACK_MONITOR_THREADS
+#if (THREAD_TRACE_ENABLED == 1)
+    TEST_CASE(SDD_043),
+    TEST_CASE(SDD_044),
+#endif // THREAD_TRACE_ENABLED
+    TEST_CASE(SDD_045),
+    TEST_CASE(SDD_046),
+    TEST_CASE(SDD_047),
+    TEST_CASE(SDD_048),
+    TEST_CASE(SDD_049),
+    TEST_CASE(SDD_050),
+    TEST_CASE(SDD_051),
+#if (configUSE_TIMERS == 1)
+    TEST_CASE(SDD_052),
+    TEST_CASE(SDD_053),
+#endif // configUSE_TIMERS
+    TEST_CASE(SDD_054),
+    TEST_CASE(SDD_055),
+#if (THREAD_TICKLESS_IDLE_ENABLED == 1)
+    TEST_CASE(SDD_056),
+#endif // THREAD_TICKLESS_IDLE_ENABLED
+#if (THREAD_TIME_MICROS_ENABLED == 1)
+    TEST_CASE(SDD_057),
+#endif // THREAD_TIME_MICROS_ENABLED
+    TEST_CASE(SDD_059),
+#if (THREAD_STATS_ENABLED == 1)
+    TEST_CASE(SDD_060),
+#endif // THREAD_STATS_ENABLED
+#if (THREAD_DEADLINE_MONITOR_THREADS > 0)
+    TEST_CASE(SDD_061),
+    TEST_CASE(SDD_062),
+#endif // THREAD_DEADLINE_MONITOR_THREADS
+};
+
+const size_t FreeRTOS_Wrapper_Test_Count = sizeof(FreeRTOS_Wrapper_Tests) / sizeof(FreeRTOS_Wrapper_Tests[0]);
\ No newline at end of file
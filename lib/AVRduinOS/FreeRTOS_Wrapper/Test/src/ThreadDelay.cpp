@@ -18,28 +18,22 @@
 #include "test_utilities.hpp"
 
 void SDD_025_Thread(void *params __attribute__((unused))) {
-    // Delay Test Indicators
-    bool &delay_indicator = test_booleans[0];
-    bool &start_indicator = test_booleans[1];
-
     // Delay Tests
     thread_time_t delay_set[] = {100, 500, 1000, 5000, 10000};
 
     for (thread_time_t delay_ms : delay_set) {
         Print("Starting %u ms Test...", delay_ms);
-        unsigned long text_delay = millis();
-        while (millis() - text_delay < 1000) continue;
+        ThreadDelay(1000);
         delay_test_time = delay_ms;
-        start_indicator = true;
-        // Wait for start signal processed (up to five seconds)
-        unsigned long start_request_time = millis();
-        while (start_indicator && millis() - start_request_time < 60000) taskYIELD();
-        
-        // Wait for delay completion (up to ten times test time)
+
+        // The delay thread starts once this thread blocks on its completion,
+        // which is bounded at twice the delay to fit the tick type
         unsigned long start_time = millis();
-        while (delay_indicator && millis() - start_time < 10 * delay_ms) continue;
+        EventGroupSet(&delay_test_events, DELAY_TEST_START);
+        thread_return_t retval = EventGroupWait(&delay_test_events, DELAY_TEST_DONE, WAIT_ALL, true, 2 * delay_ms, NULL);
         unsigned long end_time = millis();
 
+        Verify("Delay Completion Status", THREAD_SUCCESS, retval, EQUAL);
         Verify_Margin("Delay Milliseconds", delay_ms, end_time - start_time, 10ul);
     }
 
@@ -57,20 +51,25 @@ test_results_t SDD_025() {
 
     TestPreamble(testDescription, testForLoopSets, testPreconditionsList, testResultsList);
 
+    // Creating Event Group
+    Print("Creating Event Group for the Delay Handshake");
+    thread_return_t retval = CreateEventGroup(&delay_test_events);
+    Verify("Event Group Creation Status", THREAD_SUCCESS, retval, EQUAL);
+
     // Configuring Valid Thread
     Print("Configuring Thread with ThreadDelay");
-    thread_function_t thread_config = ConfigureThread("TestName", ThreadDelay_Test, THREAD_PRIORITY_MEDIUM, 16);
+    thread_function_t thread_config = ConfigureThread("TestName", ThreadDelay_Test, THREAD_PRIORITY_MEDIUM, 128);
     Verify("Thread Valid Status", THREAD_STRUCT_VALID, thread_config.valid, EQUAL);
     
     // Creating Thread
     Print("Creating Thread with ThreadDelay");
     thread_handle_t handle = NULL; 
-    thread_return_t retval = CreateThread(&handle, thread_config);
+    retval = CreateThread(&handle, thread_config);
     Verify("Thread Creation Status", THREAD_SUCCESS, retval, EQUAL);
 
     // Configuring Test Thread
     Print("Configuring Parallel Thread for Test");
-    thread_function_t test_thread_config = ConfigureThread("TestName", SDD_025_Thread, THREAD_PRIORITY_HIGH, 16);
+    thread_function_t test_thread_config = ConfigureThread("TestName", SDD_025_Thread, THREAD_PRIORITY_HIGH, 128);
     Verify("Thread Valid Status", THREAD_STRUCT_VALID, test_thread_config.valid, EQUAL);
     
     // Creating Test Thread
@@ -89,6 +88,85 @@ test_results_t SDD_025() {
     Print("Deleting Threads...");
     DeleteThread(&handle);
     DeleteThread(&test_handle);
+    DeleteEventGroup(&delay_test_events);
 
     TestPostamble();
-}
\ No newline at end of file
+}
+
+#if (THREAD_TICKLESS_IDLE_ENABLED == 1)
+
+// Each sleep restarts the watchdog, which can leave the tick a period behind
+#define TICKLESS_TEST_MARGIN_MS (3ul * THREAD_MILLISEC)
+#define TICKLESS_TEST_LATENCY_US 1000ul
+
+void SDD_056_Thread(void *params __attribute__((unused))) {
+    // Delay Tests
+    thread_time_t delay_set[] = {100, 1000, 5000};
+
+    for (thread_time_t delay_ms : delay_set) {
+        Print("Starting %u ms Test...", delay_ms);
+        ThreadTicklessStatsClear();
+
+        // Nothing else runs, so the idle thread sleeps through the delay
+        unsigned long start_time = millis();
+        ThreadDelay(delay_ms);
+        unsigned long end_time = millis();
+
+        thread_tickless_stats_t stats;
+        thread_return_t retval = ThreadTicklessStatsGet(&stats);
+        Print("Slept %lu ms over %lu sleeps, %lu woken early, worst wake %lu us",
+              (unsigned long)stats.slept_ms, (unsigned long)stats.sleeps,
+              (unsigned long)stats.early_wakes, (unsigned long)stats.wake_latency_max);
+
+        Verify("Tickless Stats Status", THREAD_SUCCESS, retval, EQUAL);
+        Verify_Margin("Delay Milliseconds", delay_ms, end_time - start_time, TICKLESS_TEST_MARGIN_MS);
+        Verify("Sleeps", 0ul, (unsigned long)stats.sleeps, GREATER_THAN);
+        Verify("Slept Milliseconds", (unsigned long)delay_ms / 2, (unsigned long)stats.slept_ms, GREATER_THAN_OR_EQUAL);
+        Verify("Worst Wake Latency", TICKLESS_TEST_LATENCY_US, (unsigned long)stats.wake_latency_max, LESS_THAN);
+    }
+
+    StopThreadScheduler();
+}
+
+test_results_t SDD_056() {
+    const char *testDescription = "This function will verify that " \
+        "the idle thread stops the tick during a ThreadDelay, that " \
+        "the delay stays within three ticks of the commanded duration " \
+        "and that the sleep counters account for the delay.";
+    
+    const char *testForLoopSets[] = {"Delay Times (100, 1000, 5000)"};
+    const char *testPreconditionsList[] = {"Tickless Idle Enabled", "No Other Thread Ready"};
+    const char *testResultsList[] = {"Delay is within three ticks.",
+                                     "At least half the delay is slept.",
+                                     "Wake latency is below 1000 us."};
+
+    TestPreamble(testDescription, testForLoopSets, testPreconditionsList, testResultsList);
+
+    // Null Stats Test
+    Print("Getting Tickless Stats with a Null Pointer");
+    thread_return_t retval = ThreadTicklessStatsGet(NULL);
+    Verify("Tickless Stats Status", THREAD_MEMORY_INVALID, retval, EQUAL);
+
+    // Configuring Test Thread
+    Print("Configuring Thread for Test");
+    thread_function_t test_thread_config = ConfigureThread("TestName", SDD_056_Thread, THREAD_PRIORITY_HIGH, 192);
+    Verify("Thread Valid Status", THREAD_STRUCT_VALID, test_thread_config.valid, EQUAL);
+    
+    // Creating Test Thread
+    Print("Creating Thread for Test");
+    thread_handle_t test_handle = NULL; 
+    retval = CreateThread(&test_handle, test_thread_config);
+    Verify("Thread Creation Status", THREAD_SUCCESS, retval, EQUAL);
+
+    // Starting Thread Scheduler
+    Print("Starting Thread Scheduler...");
+    StartThreadScheduler();
+
+    // Delete Thread
+    Print("Deleting Thread...");
+    DeleteThread(&test_handle);
+
+    TestPostamble();
+}
+
+#endif // THREAD_TICKLESS_IDLE_ENABLED
\ No newline at end of file
@@ -0,0 +1,142 @@
+/**
+ ********************************************************************************
+ * @file    ThreadNotice.cpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Unit Tests for the Interrupt Notice Functions in the FreeRTOS Wrapper
+ * @version 1.0
+ * @date    2024-03-18
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#include "ThreadNotice.hpp"
+
+#include "FreeRTOS_Wrapper.h"
+
+#include "thread_test_utilities.hpp"
+#include "test_utilities.hpp"
+
+#define NOTICE_TEST_VALUE 0x5AUL
+
+static thread_handle_t notice_test_waiter = NULL;
+static volatile unsigned long notice_test_takes = 0;
+static volatile unsigned long notice_test_value = 0;
+
+void SDD_049_Waiter(void *params __attribute__((unused))) {
+    for (;;) {
+        thread_notice_value_t value = ThreadNoticeTake(CLEAR, 1000);
+        if (value != 0) {
+            notice_test_value = value;
+            notice_test_takes++;
+        }
+    }
+}
+
+void SDD_049_Thread(void *params __attribute__((unused))) {
+    // Lets the waiter block on its notice
+    ThreadDelay(50);
+
+    Print("Giving Notice Twice from an Interrupt...");
+    thread_isr_yield_t yield = THREAD_ISR_YIELD_INIT;
+    EnterThreadCritical();
+    thread_return_t first_retval = ThreadNoticeGiveFromISR(&notice_test_waiter, &yield);
+    thread_return_t second_retval = ThreadNoticeGiveFromISR(&notice_test_waiter, &yield);
+    ExitThreadCritical();
+    Verify("Notice Give Status", THREAD_SUCCESS, first_retval, EQUAL);
+    Verify("Notice Give Status", THREAD_SUCCESS, second_retval, EQUAL);
+    Verify("Yield Requested", (unsigned long)pdFALSE, (unsigned long)yield, NOT_EQUAL);
+
+    ThreadDelay(50);
+    Verify("Notice Takes", 1ul, notice_test_takes, EQUAL);
+    Verify("Notice Value", 2ul, notice_test_value, EQUAL);
+
+    Print("Querying and Setting Notice from an Interrupt...");
+    thread_notice_value_t previous_value = 0xFFFFFFFFUL;
+    yield = THREAD_ISR_YIELD_INIT;
+    EnterThreadCritical();
+    thread_return_t retval = ThreadNoticeQueryFromISR(&notice_test_waiter, SET_FORCE, NOTICE_TEST_VALUE, &previous_value, &yield);
+    ExitThreadCritical();
+    Verify("Notice Query Status", THREAD_SUCCESS, retval, EQUAL);
+    Verify("Previous Notice Value", 0ul, (unsigned long)previous_value, EQUAL);
+    Verify("Yield Requested", (unsigned long)pdFALSE, (unsigned long)yield, NOT_EQUAL);
+
+    ThreadDelay(50);
+    Verify("Notice Takes", 2ul, notice_test_takes, EQUAL);
+    Verify("Notice Value", NOTICE_TEST_VALUE, notice_test_value, EQUAL);
+
+    StopThreadScheduler();
+}
+
+test_results_t SDD_049() {
+    const char *testDescription = "This function will verify that " \
+        "the interrupt notice functions throw an error if the handle or " \
+        "index is invalid, and that a notice from an interrupt wakes the " \
+        "waiting thread and asks for a switch to it.";
+    
+    const char *testPreconditionsList[] = {"High priority thread taking its notice",
+                                           "Medium priority thread noticing from a critical section"};
+    const char *testResultsList[] = {"Error is thrown when NULL handle pointer",
+                                     "Error is thrown when index out of range",
+                                     "A switch is requested",
+                                     "The waiter takes the given and the set values"};
+
+    TestPreamble(testDescription, NULL, testPreconditionsList, testResultsList);
+
+    thread_handle_t test_handle = NULL;
+    thread_handle_t invalid_handle = (thread_handle_t)0x1234;
+    thread_notice_value_t previous_value = 0;
+    thread_return_t retval;
+
+    struct test_case_data {
+        thread_handle_t *handle;
+        thread_notice_index_t index;
+        thread_return_t expected;
+        const char *case_name;
+    } Test_Cases[] = {
+        {NULL,              0,                                      THREAD_HANDLE_INVALID,          "NULL Handle Pointer (Invalid)"},
+        {&invalid_handle,   configTASK_NOTIFICATION_ARRAY_ENTRIES,  THREAD_NOTICE_INDEX_INVALID,    "Index out of Range (Invalid)"}
+    };
+
+    for (test_case_data Test_Case : Test_Cases) {
+        thread_isr_yield_t yield = THREAD_ISR_YIELD_INIT;
+        Print("Noticing from an Interrupt with %s", Test_Case.case_name);
+        retval = ThreadNoticeIndexFromISR(Test_Case.handle, SET_BITWISE_OR, 1, Test_Case.index, &yield);
+        Verify("Notice Status", Test_Case.expected, retval, EQUAL);
+        retval = ThreadNoticeQueryIndexFromISR(Test_Case.handle, SET_BITWISE_OR, 1, &previous_value, Test_Case.index, &yield);
+        Verify("Notice Query Status", Test_Case.expected, retval, EQUAL);
+        retval = ThreadNoticeGiveIndexFromISR(Test_Case.handle, Test_Case.index, &yield);
+        Verify("Notice Give Status", Test_Case.expected, retval, EQUAL);
+        Verify("Yield Requested", (unsigned long)pdFALSE, (unsigned long)yield, EQUAL);
+    }
+
+    // Creating Threads
+    Print("Creating Threads for Test");
+    notice_test_takes = 0;
+    notice_test_value = 0;
+    {
+        thread_function_t waiter_thread_config = ConfigureThread("Waiter", SDD_049_Waiter, THREAD_PRIORITY_HIGH, 128);
+        retval = CreateThread(&notice_test_waiter, waiter_thread_config);
+        Verify("Thread Creation Status", THREAD_SUCCESS, retval, EQUAL);
+        if (retval != THREAD_SUCCESS) goto Early_Fail_Jump;
+    }
+    {
+        thread_function_t test_thread_config = ConfigureThread("TestName", SDD_049_Thread, THREAD_PRIORITY_MEDIUM, 256);
+        retval = CreateThread(&test_handle, test_thread_config);
+        Verify("Thread Creation Status", THREAD_SUCCESS, retval, EQUAL);
+    }
+
+    // Starting Thread Scheduler
+    Print("Starting Thread Scheduler...");
+    StartThreadScheduler();
+
+    // Delete Threads
+    Print("Deleting Threads...");
+    DeleteThread(&test_handle);
+
+    Early_Fail_Jump:
+
+    DeleteThread(&notice_test_waiter);
+
+    TestPostamble();
+}
\ No newline at end of file
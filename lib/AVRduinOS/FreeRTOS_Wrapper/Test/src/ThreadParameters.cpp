@@ -0,0 +1,117 @@
+/**
+ ********************************************************************************
+ * @file    ThreadParameters.cpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Unit Tests for Thread Parameters in the FreeRTOS Wrapper
+ * @version 1.0
+ * @date    2024-03-18
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#include "ThreadParameters.hpp"
+
+#include "FreeRTOS_Wrapper.h"
+
+#include "thread_test_utilities.hpp"
+#include "test_utilities.hpp"
+
+#define SDD_031_INSTANCES 3
+
+test_results_t SDD_030() {
+    const char *testDescription = "This function will verify that " \
+        "the ConfigureThreadWithParameters function stores the parameters " \
+        "pointer and that ConfigureThread leaves it NULL.";
+    
+    const char *testPreconditionsList[] = {"Valid Thread Name", 
+                                           "Valid Thread Function",
+                                           "Valid Thread Priority",
+                                           "Valid Stack Size"};
+    const char *testResultsList[] = {"Parameters are NULL when configured without parameters", 
+                                     "Parameters match when configured with parameters"};
+
+    TestPreamble(testDescription, NULL, testPreconditionsList, testResultsList);
+
+    // Test Configuration without Parameters
+    {
+        Print("Configuring Thread without Parameters");
+        thread_function_t thread_config = ConfigureThread("TestName", Valid_Function, THREAD_PRIORITY_MEDIUM, 128);
+        Verify("Thread Valid Status", THREAD_STRUCT_VALID, thread_config.valid, EQUAL);
+        Verify("Thread Parameters", 0ul, (unsigned long)(uintptr_t)thread_config.parameters, EQUAL);
+    }
+
+    // Test Configuration with Parameters
+    {
+        Print("Configuring Thread with Parameters");
+        bool context = false;
+        thread_function_t thread_config = ConfigureThreadWithParameters("TestName", Valid_Function, THREAD_PRIORITY_MEDIUM, 128, &context);
+        Verify("Thread Valid Status", THREAD_STRUCT_VALID, thread_config.valid, EQUAL);
+        Verify("Thread Parameters", (unsigned long)(uintptr_t)&context, (unsigned long)(uintptr_t)thread_config.parameters, EQUAL);
+    }
+
+    TestPostamble();
+}
+
+void SDD_031_Thread(void *params) {
+    bool *started_indicators = (bool *)params;
+
+    // Allow every instance to run once
+    ThreadDelay(1000);
+
+    for (int i = 0; i < SDD_031_INSTANCES; i++) {
+        Print("Checking Instance %d...", i);
+        Verify("Instance Started", true, started_indicators[i], EQUAL);
+    }
+
+    StopThreadScheduler();
+}
+
+test_results_t SDD_031() {
+    const char *testDescription = "This function will verify that " \
+        "the CreateThread function passes the configured parameters to " \
+        "the loop function, so that one loop function can serve several threads.";
+    
+    const char *testForLoopSets[] = {"Thread Instances (0, 1, 2)"};
+    const char *testPreconditionsList[] = {"Valid Thread Configuration with Parameters"};
+    const char *testResultsList[] = {"Each instance receives its own parameters"};
+
+    TestPreamble(testDescription, testForLoopSets, testPreconditionsList, testResultsList);
+
+    bool started_indicators[SDD_031_INSTANCES] = {false};
+    thread_handle_t handles[SDD_031_INSTANCES] = {NULL};
+
+    // Creating Instances of the same Loop Function
+    for (int i = 0; i < SDD_031_INSTANCES; i++) {
+        Print("Creating Instance %d", i);
+        thread_function_t thread_config = ConfigureThreadWithParameters("TestName", ThreadParameter_Test, THREAD_PRIORITY_MEDIUM, 128, &started_indicators[i]);
+        Verify("Thread Valid Status", THREAD_STRUCT_VALID, thread_config.valid, EQUAL);
+
+        thread_return_t retval = CreateThread(&handles[i], thread_config);
+        Verify("Thread Creation Status", THREAD_SUCCESS, retval, EQUAL);
+    }
+
+    // Configuring Test Thread
+    Print("Configuring Parallel Thread for Test");
+    thread_function_t test_thread_config = ConfigureThreadWithParameters("TestName", SDD_031_Thread, THREAD_PRIORITY_HIGH, 128, started_indicators);
+    Verify("Thread Valid Status", THREAD_STRUCT_VALID, test_thread_config.valid, EQUAL);
+    
+    // Creating Test Thread
+    Print("Creating Parallel Thread for Test");
+    thread_handle_t test_handle = NULL; 
+    thread_return_t retval = CreateThread(&test_handle, test_thread_config);
+    Verify("Thread Creation Status", THREAD_SUCCESS, retval, EQUAL);
+
+    // Starting Thread Scheduler
+    Print("Starting Thread Scheduler...");
+    StartThreadScheduler();
+
+    // Delete Threads
+    Print("Deleting Threads...");
+    for (thread_handle_t &handle : handles) {
+        if (handle != NULL) DeleteThread(&handle);
+    }
+    DeleteThread(&test_handle);
+
+    TestPostamble();
+}
\ No newline at end of file
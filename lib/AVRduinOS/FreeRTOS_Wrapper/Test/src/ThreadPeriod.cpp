@@ -0,0 +1,345 @@
+/**
+ ********************************************************************************
+ * @file    ThreadPeriod.cpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Unit Tests for the Periodic Thread Functions in the FreeRTOS Wrapper
+ * @version 1.0
+ * @date    2024-03-18
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#include "ThreadPeriod.hpp"
+
+#include "FreeRTOS_Wrapper.h"
+
+#include "thread_test_utilities.hpp"
+#include "test_utilities.hpp"
+
+#define PERIOD_TEST_CYCLES 20
+
+test_results_t SDD_032() {
+    const char *testDescription = "This function will verify that " \
+        "the ThreadPeriodInit function throws an error if the period " \
+        "struct is NULL or the period is shorter than one tick.";
+    
+    const char *testResultsList[] = {"Error is thrown when NULL period struct", 
+                                     "Error is thrown when period is shorter than one tick",
+                                     "No Error is thrown when valid period"};
+
+    TestPreamble(testDescription, NULL, NULL, testResultsList);
+
+    // Test NULL Period Struct
+    {
+        Print("Initializing NULL Period");
+        thread_return_t retval = ThreadPeriodInit(NULL, 100);
+        Verify("Period Init Status", THREAD_SUCCESS, retval, NOT_EQUAL);
+    }
+
+    // Test Zero Period
+    {
+        Print("Initializing Period of 0 ms");
+        thread_period_t period;
+        thread_return_t retval = ThreadPeriodInit(&period, 0);
+        Verify("Period Init Status", THREAD_SUCCESS, retval, NOT_EQUAL);
+    }
+
+    // Test Valid Period
+    {
+        Print("Initializing Period of 100 ms");
+        thread_period_t period;
+        thread_return_t retval = ThreadPeriodInit(&period, 100);
+        Verify("Period Init Status", THREAD_SUCCESS, retval, EQUAL);
+        Verify("Period Ticks", (unsigned long)pdMS_TO_TICKS(100), (unsigned long)period.period, EQUAL);
+        Verify("Period Overruns", 0ul, (unsigned long)period.overruns, EQUAL);
+    }
+
+    TestPostamble();
+}
+
+void SDD_033_Thread(void *params __attribute__((unused))) {
+    thread_time_t period_set[] = {100, 500};
+
+    for (thread_time_t period_ms : period_set) {
+        Print("Starting %u ms Period Test...", period_ms);
+
+        thread_period_t period;
+        ThreadPeriodInit(&period, period_ms);
+        thread_time_t start_time = ThreadTime();
+
+        for (int cycle = 0; cycle < PERIOD_TEST_CYCLES; cycle++) {
+            // Vary the work done in each cycle to expose any drift
+            ThreadDelay((cycle % 4) * THREAD_MILLISEC);
+            ThreadPeriodWait(&period);
+        }
+
+        thread_time_t elapsed = ThreadTime() - start_time;
+        unsigned long expected = PERIOD_TEST_CYCLES * THREAD_MILLISEC * period.period;
+        Verify_Margin("Elapsed Milliseconds", expected, (unsigned long)elapsed, (unsigned long)THREAD_MILLISEC);
+        Verify("Period Cycles", (unsigned long)PERIOD_TEST_CYCLES, (unsigned long)period.cycles, EQUAL);
+        Verify("Period Overruns", 0ul, (unsigned long)period.overruns, EQUAL);
+    }
+
+    StopThreadScheduler();
+}
+
+test_results_t SDD_033() {
+    const char *testDescription = "This function will verify that " \
+        "the ThreadPeriodWait function keeps a periodic loop at its " \
+        "period without accumulating drift.";
+    
+    const char *testForLoopSets[] = {"Periods (100, 500)"};
+    const char *testPreconditionsList[] = {"Valid Thread", 
+                                           "Cycle work shorter than the period"};
+    const char *testResultsList[] = {"Elapsed time is the period times the cycle count within one tick",
+                                     "No overruns are counted"};
+
+    TestPreamble(testDescription, testForLoopSets, testPreconditionsList, testResultsList);
+
+    // Configuring Test Thread
+    Print("Configuring Periodic Thread for Test");
+    thread_function_t test_thread_config = ConfigureThread("TestName", SDD_033_Thread, THREAD_PRIORITY_HIGH, 128);
+    Verify("Thread Valid Status", THREAD_STRUCT_VALID, test_thread_config.valid, EQUAL);
+    
+    // Creating Test Thread
+    Print("Creating Periodic Thread for Test");
+    thread_handle_t test_handle = NULL; 
+    thread_return_t retval = CreateThread(&test_handle, test_thread_config);
+    Verify("Thread Creation Status", THREAD_SUCCESS, retval, EQUAL);
+
+    // Starting Thread Scheduler
+    Print("Starting Thread Scheduler...");
+    StartThreadScheduler();
+
+    // Delete Thread
+    Print("Deleting Threads...");
+    DeleteThread(&test_handle);
+
+    TestPostamble();
+}
+
+void SDD_034_Thread(void *params __attribute__((unused))) {
+    Print("Starting Overloaded Period Test...");
+
+    thread_period_t period;
+    ThreadPeriodInit(&period, 100);
+
+    // Work for three periods in the first cycle
+    ThreadDelay(3 * THREAD_MILLISEC * period.period);
+    thread_return_t retval = ThreadPeriodWait(&period);
+    Verify("Period Wait Status", THREAD_PERIOD_OVERRUN, retval, EQUAL);
+    Verify("Period Overruns", 1ul, (unsigned long)period.overruns, EQUAL);
+    Verify_Margin("Worst Lateness", 2ul * THREAD_MILLISEC * period.period, (unsigned long)period.worst_lateness, (unsigned long)THREAD_MILLISEC);
+
+    StopThreadScheduler();
+}
+
+test_results_t SDD_034() {
+    const char *testDescription = "This function will verify that " \
+        "the ThreadPeriodWait function counts an overrun and records the " \
+        "lateness when a cycle takes longer than the period.";
+    
+    const char *testPreconditionsList[] = {"Valid Thread", 
+                                           "Cycle work three times the period"};
+    const char *testResultsList[] = {"Overrun is returned and counted",
+                                     "Worst lateness is two periods within one tick"};
+
+    TestPreamble(testDescription, NULL, testPreconditionsList, testResultsList);
+
+    // Configuring Test Thread
+    Print("Configuring Overloaded Thread for Test");
+    thread_function_t test_thread_config = ConfigureThread("TestName", SDD_034_Thread, THREAD_PRIORITY_HIGH, 128);
+    Verify("Thread Valid Status", THREAD_STRUCT_VALID, test_thread_config.valid, EQUAL);
+    
+    // Creating Test Thread
+    Print("Creating Overloaded Thread for Test");
+    thread_handle_t test_handle = NULL; 
+    thread_return_t retval = CreateThread(&test_handle, test_thread_config);
+    Verify("Thread Creation Status", THREAD_SUCCESS, retval, EQUAL);
+
+    // Starting Thread Scheduler
+    Print("Starting Thread Scheduler...");
+    StartThreadScheduler();
+
+    // Delete Thread
+    Print("Deleting Threads...");
+    DeleteThread(&test_handle);
+
+    TestPostamble();
+}
+
+#if (THREAD_DEADLINE_MONITOR_THREADS > 0)
+
+#define DEADLINE_TEST_PERIOD_MS   300
+#define DEADLINE_TEST_DEADLINE_MS 150
+#define DEADLINE_TEST_CYCLES      8
+
+static volatile unsigned long deadline_test_hooks = 0;
+
+thread_deadline_action_t SDD_061_Hook(thread_handle_t thread __attribute__((unused)),
+                                      thread_period_t *period __attribute__((unused))) {
+    deadline_test_hooks++;
+    return DEADLINE_CONTINUE;
+}
+
+void SDD_061_Thread(void *params __attribute__((unused))) {
+    thread_period_t period;
+
+    // Registration Tests
+    Print("Registering a Null Period");
+    thread_return_t retval = ThreadDeadlineRegister(NULL, DEADLINE_TEST_DEADLINE_MS, NULL);
+    Verify("Deadline Register Status", THREAD_MEMORY_INVALID, retval, EQUAL);
+
+    Print("Registering a Deadline longer than the Period");
+    ThreadPeriodInit(&period, DEADLINE_TEST_PERIOD_MS);
+    retval = ThreadDeadlineRegister(&period, 2 * DEADLINE_TEST_PERIOD_MS, NULL);
+    Verify("Deadline Register Status", THREAD_PERIOD_INVALID, retval, EQUAL);
+
+    Print("Starting Overloaded Deadline Test...");
+    deadline_test_hooks = 0;
+    uint32_t start_misses = ThreadDeadlineMisses();
+    ThreadPeriodInit(&period, DEADLINE_TEST_PERIOD_MS);
+    retval = ThreadDeadlineRegister(&period, DEADLINE_TEST_DEADLINE_MS, SDD_061_Hook);
+    Verify("Deadline Register Status", THREAD_SUCCESS, retval, EQUAL);
+
+    for (int cycle = 0; cycle < DEADLINE_TEST_CYCLES; cycle++) {
+        // Every other cycle works past the deadline but within the period
+        bool overloaded = (cycle % 2) == 1;
+        uint32_t misses = period.misses;
+        ThreadDelay(overloaded ? (3 * DEADLINE_TEST_PERIOD_MS) / 4 : DEADLINE_TEST_PERIOD_MS / 6);
+
+        // The miss is counted when the thread is switched back in, before the cycle ends
+        Verify("Misses before Wait", (unsigned long)(misses + (overloaded ? 1 : 0)), (unsigned long)period.misses, EQUAL);
+        retval = ThreadPeriodWait(&period);
+        Verify("Period Wait Status", overloaded ? THREAD_PERIOD_DEADLINE_MISSED : THREAD_SUCCESS, retval, EQUAL);
+    }
+
+    Verify("Deadline Misses", (unsigned long)DEADLINE_TEST_CYCLES / 2, (unsigned long)period.misses, EQUAL);
+    Verify("Total Deadline Misses", (unsigned long)DEADLINE_TEST_CYCLES / 2, (unsigned long)(ThreadDeadlineMisses() - start_misses), EQUAL);
+    Verify("Deadline Hook Calls", (unsigned long)DEADLINE_TEST_CYCLES / 2, deadline_test_hooks, EQUAL);
+    Verify("Period Skips", 0ul, (unsigned long)period.skips, EQUAL);
+    Verify("Period Overruns", 0ul, (unsigned long)period.overruns, EQUAL);
+
+    StopThreadScheduler();
+}
+
+test_results_t SDD_061() {
+    const char *testDescription = "This function will verify that " \
+        "the deadline monitor counts every cycle of a periodic thread " \
+        "that ends past its deadline, once and as soon as the thread " \
+        "is switched back in, and calls the deadline hook for it.";
+    
+    const char *testPreconditionsList[] = {"Deadline Monitor Enabled",
+                                           "Valid Thread",
+                                           "Every other cycle works three quarters of the period"};
+    const char *testResultsList[] = {"Error is thrown when NULL period or deadline past the period",
+                                     "Miss is counted before the cycle ends",
+                                     "Deadline missed is returned for overloaded cycles only",
+                                     "Hook is called once per miss and no overrun is counted"};
+
+    TestPreamble(testDescription, NULL, testPreconditionsList, testResultsList);
+
+    // Configuring Test Thread
+    Print("Configuring Periodic Thread for Test");
+    thread_function_t test_thread_config = ConfigureThread("TestName", SDD_061_Thread, THREAD_PRIORITY_HIGH, 192);
+    Verify("Thread Valid Status", THREAD_STRUCT_VALID, test_thread_config.valid, EQUAL);
+    
+    // Creating Test Thread
+    Print("Creating Periodic Thread for Test");
+    thread_handle_t test_handle = NULL; 
+    thread_return_t retval = CreateThread(&test_handle, test_thread_config);
+    Verify("Thread Creation Status", THREAD_SUCCESS, retval, EQUAL);
+
+    // Starting Thread Scheduler
+    Print("Starting Thread Scheduler...");
+    StartThreadScheduler();
+
+    // Delete Thread
+    Print("Deleting Threads...");
+    DeleteThread(&test_handle);
+
+    TestPostamble();
+}
+
+thread_deadline_action_t SDD_062_Hook(thread_handle_t thread __attribute__((unused)),
+                                      thread_period_t *period __attribute__((unused))) {
+    deadline_test_hooks++;
+    return DEADLINE_SKIP;
+}
+
+void SDD_062_Thread(void *params __attribute__((unused))) {
+    Print("Starting Starved Deadline Test...");
+
+    thread_period_t period;
+    deadline_test_hooks = 0;
+    ThreadPeriodInit(&period, DEADLINE_TEST_PERIOD_MS);
+    ThreadDeadlineRegister(&period, DEADLINE_TEST_DEADLINE_MS, SDD_062_Hook);
+
+    unsigned long missed = 0;
+    for (int cycle = 0; cycle < DEADLINE_TEST_CYCLES; cycle++) {
+        ThreadDelay(DEADLINE_TEST_PERIOD_MS / 6);
+        if (ThreadPeriodWait(&period) == THREAD_PERIOD_DEADLINE_MISSED)
+            missed++;
+    }
+
+    // Skipping the release after the starved cycle keeps it from overrunning
+    Verify("Deadline Missed Returns", 1ul, missed, EQUAL);
+    Verify("Deadline Misses", 1ul, (unsigned long)period.misses, EQUAL);
+    Verify("Deadline Hook Calls", 1ul, deadline_test_hooks, EQUAL);
+    Verify("Period Skips", 1ul, (unsigned long)period.skips, EQUAL);
+    Verify("Period Overruns", 0ul, (unsigned long)period.overruns, EQUAL);
+
+    StopThreadScheduler();
+}
+
+test_results_t SDD_062() {
+    const char *testDescription = "This function will verify that " \
+        "a periodic thread starved past its deadline by a busy higher " \
+        "priority thread is counted as missed and that a deadline hook " \
+        "returning DEADLINE_SKIP drops the next release instead of " \
+        "letting the late cycle overrun.";
+    
+    const char *testPreconditionsList[] = {"Deadline Monitor Enabled",
+                                           "Periodic Thread at Medium Priority",
+                                           "Overload Thread at High Priority busy for 500 ms in the third cycle"};
+    const char *testResultsList[] = {"One miss is counted and returned",
+                                     "One release is skipped",
+                                     "No overrun is counted"};
+
+    TestPreamble(testDescription, NULL, testPreconditionsList, testResultsList);
+
+    // Starts mid cycle and spins for more than a period
+    static overload_test_t overload = {650, 500};
+
+    // Configuring Test Threads
+    Print("Configuring Periodic and Overload Threads for Test");
+    thread_function_t thread_configs[] = {
+        ConfigureThread("Periodic", SDD_062_Thread, THREAD_PRIORITY_MEDIUM, 192),
+        ConfigureThreadWithParameters("Overload", Overload_Test, THREAD_PRIORITY_HIGH, 128, &overload),
+    };
+    Verify("Periodic Valid Status", THREAD_STRUCT_VALID, thread_configs[0].valid, EQUAL);
+    Verify("Overload Valid Status", THREAD_STRUCT_VALID, thread_configs[1].valid, EQUAL);
+
+    // Creating Test Threads
+    Print("Creating Periodic and Overload Threads for Test");
+    thread_handle_t periodic_handle = NULL;
+    thread_handle_t overload_handle = NULL;
+    thread_return_t retval = CreateThread(&periodic_handle, thread_configs[0]);
+    Verify("Periodic Creation Status", THREAD_SUCCESS, retval, EQUAL);
+    retval = CreateThread(&overload_handle, thread_configs[1]);
+    Verify("Overload Creation Status", THREAD_SUCCESS, retval, EQUAL);
+
+    // Starting Thread Scheduler
+    Print("Starting Thread Scheduler...");
+    StartThreadScheduler();
+
+    // Delete Threads
+    Print("Deleting Threads...");
+    DeleteThread(&periodic_handle);
+    DeleteThread(&overload_handle);
+
+    TestPostamble();
+}
+
+#endif // THREAD_DEADLINE_MONITOR_THREADS
\ No newline at end of file
@@ -0,0 +1,142 @@
+/**
+ ********************************************************************************
+ * @file    ThreadStack.cpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Unit Tests for the Stack Monitor Functions in the FreeRTOS Wrapper
+ * @version 1.0
+ * @date    2024-03-18
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#include "ThreadStack.hpp"
+
+#include "FreeRTOS_Wrapper.h"
+
+#include "thread_test_utilities.hpp"
+#include "test_utilities.hpp"
+
+#if (THREAD_STACK_MONITOR_THREADS > 0)
+
+#define STACK_TEST_STACK_SIZE 128
+
+static volatile bool stack_test_reported = false;
+
+static const thread_stack_report_t *FindStackReport(const thread_stack_report_t *reports, UBaseType_t count, thread_handle_t thread) {
+    for (UBaseType_t i = 0; i < count; i++) {
+        if (reports[i].thread == thread)
+            return &reports[i];
+    }
+    return NULL;
+}
+
+test_results_t SDD_041() {
+    const char *testDescription = "This function will verify that " \
+        "ThreadStackReport reports the stack size, high water mark and " \
+        "suggested size of a thread from CreateThread until it is deleted.";
+    
+    const char *testPreconditionsList[] = {"Valid Thread with Stack Size 128"};
+    const char *testResultsList[] = {"Thread is reported with its stack size",
+                                     "High water mark is within the stack",
+                                     "Suggested size covers the stack used",
+                                     "Thread is no longer reported once deleted",
+                                     "Thread deleted through the kernel is no longer reported"};
+
+    TestPreamble(testDescription, NULL, testPreconditionsList, testResultsList);
+
+    // Creating Thread
+    Print("Creating Thread with Stack Size 128");
+    thread_function_t thread_config = ConfigureThread("TestName", Valid_Function, THREAD_PRIORITY_MEDIUM, STACK_TEST_STACK_SIZE);
+    thread_handle_t handle = NULL;
+    thread_return_t retval = CreateThread(&handle, thread_config);
+    Verify("Thread Creation Status", THREAD_SUCCESS, retval, EQUAL);
+
+    // Reporting Stack Use
+    Print("Reporting Stack Use");
+    thread_stack_report_t reports[THREAD_STACK_MONITOR_THREADS];
+    UBaseType_t count = THREAD_STACK_MONITOR_THREADS;
+    retval = ThreadStackReport(reports, &count);
+    Verify("Stack Report Status", THREAD_SUCCESS, retval, EQUAL);
+
+    const thread_stack_report_t *report = FindStackReport(reports, count, handle);
+    Verify("Thread Reported", true, report != NULL, EQUAL);
+    if (report != NULL) {
+        unsigned long used = report->stack_size - report->high_water_mark;
+        Verify("Stack Size", (unsigned long)THREAD_STACK_DEPTH(STACK_TEST_STACK_SIZE), (unsigned long)report->stack_size, EQUAL);
+        Verify("High Water Mark", (unsigned long)THREAD_STACK_DEPTH(STACK_TEST_STACK_SIZE), (unsigned long)report->high_water_mark, LESS_THAN);
+        Verify("Suggested Size", used, (unsigned long)report->suggested_size, GREATER_THAN);
+    }
+
+    // Deleting Thread
+    Print("Deleting Thread");
+    DeleteThread(&handle);
+    count = THREAD_STACK_MONITOR_THREADS;
+    ThreadStackReport(reports, &count);
+    Verify("Thread Reported", false, FindStackReport(reports, count, handle) != NULL, EQUAL);
+
+    // Deleting Thread through the Kernel
+    Print("Deleting Thread through the Kernel");
+    retval = CreateThread(&handle, thread_config);
+    Verify("Thread Creation Status", THREAD_SUCCESS, retval, EQUAL);
+    vTaskDelete(handle);
+    count = THREAD_STACK_MONITOR_THREADS;
+    ThreadStackReport(reports, &count);
+    Verify("Thread Reported", false, FindStackReport(reports, count, handle) != NULL, EQUAL);
+
+    TestPostamble();
+}
+
+void SDD_042_Report(const thread_stack_report_t *reports, UBaseType_t count) {
+    stack_test_reported = (reports != NULL && count > 0);
+}
+
+void SDD_042_Thread(void *params __attribute__((unused))) {
+    ThreadDelay(300);
+    Verify("Monitor Reported", true, stack_test_reported, EQUAL);
+
+    StopThreadScheduler();
+}
+
+test_results_t SDD_042() {
+    const char *testDescription = "This function will verify that " \
+        "the ThreadStackMonitor thread hands the stack reports to its " \
+        "callback every period.";
+    
+    const char *testPreconditionsList[] = {"Monitor Thread with a 100 ms period"};
+    const char *testResultsList[] = {"Callback receives the reports of the registered threads"};
+
+    TestPreamble(testDescription, NULL, testPreconditionsList, testResultsList);
+
+    stack_test_reported = false;
+    static thread_stack_monitor_t monitor = { 100, SDD_042_Report };
+
+    // Configuring Threads
+    Print("Configuring Threads for Test");
+    thread_function_t monitor_config = ConfigureThreadWithParameters("Monitor", ThreadStackMonitor, THREAD_PRIORITY_LOW, 256, &monitor);
+    Verify("Thread Valid Status", THREAD_STRUCT_VALID, monitor_config.valid, EQUAL);
+    thread_function_t test_thread_config = ConfigureThread("TestName", SDD_042_Thread, THREAD_PRIORITY_HIGH, 128);
+    Verify("Thread Valid Status", THREAD_STRUCT_VALID, test_thread_config.valid, EQUAL);
+
+    // Creating Threads
+    Print("Creating Threads for Test");
+    thread_handle_t monitor_handle = NULL;
+    thread_handle_t test_handle = NULL;
+    thread_return_t retval = CreateThread(&monitor_handle, monitor_config);
+    Verify("Thread Creation Status", THREAD_SUCCESS, retval, EQUAL);
+    retval = CreateThread(&test_handle, test_thread_config);
+    Verify("Thread Creation Status", THREAD_SUCCESS, retval, EQUAL);
+
+    // Starting Thread Scheduler
+    Print("Starting Thread Scheduler...");
+    StartThreadScheduler();
+
+    // Delete Threads
+    Print("Deleting Threads...");
+    DeleteThread(&monitor_handle);
+    DeleteThread(&test_handle);
+
+    TestPostamble();
+}
+
+#endif // THREAD_STACK_MONITOR_THREADS
\ No newline at end of file
@@ -0,0 +1,116 @@
+/**
+ ********************************************************************************
+ * @file    ThreadStats.cpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Unit Tests for the Run Time Statistics Functions in the FreeRTOS Wrapper
+ * @version 1.0
+ * @date    2024-03-18
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#include "ThreadStats.hpp"
+
+#include "FreeRTOS_Wrapper.h"
+
+#include "thread_test_utilities.hpp"
+#include "test_utilities.hpp"
+
+#if (THREAD_STATS_ENABLED == 1)
+
+#define STATS_TEST_BUSY_MS 300
+
+static thread_handle_t stats_test_busy_handle = NULL;
+
+void SDD_040_Busy(void *params __attribute__((unused))) {
+    // Spin for half of every period so the CPU load settles near 50 percent
+    while (true) {
+        thread_time_t start_time = ThreadTime();
+        while (ThreadTime() - start_time < STATS_TEST_BUSY_MS);
+        ThreadDelay(STATS_TEST_BUSY_MS);
+    }
+}
+
+void SDD_040_Thread(void *params __attribute__((unused))) {
+    thread_stats_window_t window = { 0, 0 };
+    thread_stats_window_t dump_window = { 0, 0 };
+    ThreadStatsCpuLoad(&window);
+    ThreadStatsCpuLoad(&dump_window);
+    uint32_t switches = ThreadStatsSwitches();
+    ThreadDelay(10 * STATS_TEST_BUSY_MS);
+
+    Print("Measuring CPU Load...");
+    uint8_t load = ThreadStatsCpuLoad(&window);
+    Verify_Margin("CPU Load Percent", 50ul, (unsigned long)load, 10ul);
+    Verify("Context Switches", (unsigned long)switches, (unsigned long)ThreadStatsSwitches(), GREATER_THAN);
+
+    Print("Reading Thread Statistics...");
+    thread_stats_t stats[THREAD_STATS_MAX_THREADS];
+    UBaseType_t count = THREAD_STATS_MAX_THREADS;
+    thread_return_t retval = ThreadStatsGet(stats, &count);
+    Verify("Stats Status", THREAD_SUCCESS, retval, EQUAL);
+    for (UBaseType_t i = 0; i < count; i++) {
+        if (stats[i].thread == stats_test_busy_handle) {
+            Verify("Busy Thread Run Time", 0ul, (unsigned long)stats[i].run_time, GREATER_THAN);
+            Verify("Busy Thread Switches", 0ul, (unsigned long)stats[i].switches, GREATER_THAN);
+        }
+    }
+
+    Print("Dumping Thread Statistics...");
+    uint8_t buffer[THREAD_STATS_DUMP_SIZE(THREAD_STATS_MAX_THREADS)];
+    size_t size = 0;
+    retval = ThreadStatsDump(buffer, &size, NULL);
+    Verify("Dump Status with Empty Buffer", THREAD_SUCCESS, retval, NOT_EQUAL);
+    size = sizeof(buffer);
+    retval = ThreadStatsDump(buffer, &size, &dump_window);
+    Verify("Dump Status", THREAD_SUCCESS, retval, EQUAL);
+    Verify("Dump Size", (unsigned long)THREAD_STATS_DUMP_SIZE(count), (unsigned long)size, EQUAL);
+    Verify_Margin("Dump CPU Load Percent", (unsigned long)load, (unsigned long)buffer[9], 10ul);
+
+    StopThreadScheduler();
+}
+
+test_results_t SDD_040() {
+    const char *testDescription = "This function will verify that " \
+        "the statistics functions report the CPU load, context switches " \
+        "and per-thread run time of a thread that is busy half of the time.";
+    
+    const char *testPreconditionsList[] = {"THREAD_STATS_ENABLED with the kernel hooks included",
+                                           "Busy thread spinning for half of every period"};
+    const char *testResultsList[] = {"CPU load is 50 percent within 10 percent",
+                                     "Context switches are counted",
+                                     "Busy thread run time and switches are reported",
+                                     "Dump fills the buffer with every thread",
+                                     "Dump reports the same CPU load over its own window"};
+
+    TestPreamble(testDescription, NULL, testPreconditionsList, testResultsList);
+
+    // Configuring Threads
+    Print("Configuring Threads for Test");
+    thread_function_t busy_thread_config = ConfigureThread("Busy", SDD_040_Busy, THREAD_PRIORITY_LOW, 128);
+    Verify("Thread Valid Status", THREAD_STRUCT_VALID, busy_thread_config.valid, EQUAL);
+    thread_function_t test_thread_config = ConfigureThread("TestName", SDD_040_Thread, THREAD_PRIORITY_HIGH, 256);
+    Verify("Thread Valid Status", THREAD_STRUCT_VALID, test_thread_config.valid, EQUAL);
+    
+    // Creating Threads
+    Print("Creating Threads for Test");
+    thread_handle_t test_handle = NULL; 
+    thread_return_t retval = CreateThread(&stats_test_busy_handle, busy_thread_config);
+    Verify("Thread Creation Status", THREAD_SUCCESS, retval, EQUAL);
+    retval = CreateThread(&test_handle, test_thread_config);
+    Verify("Thread Creation Status", THREAD_SUCCESS, retval, EQUAL);
+
+    // Starting Thread Scheduler
+    Print("Starting Thread Scheduler...");
+    StartThreadScheduler();
+
+    // Delete Threads
+    Print("Deleting Threads...");
+    DeleteThread(&stats_test_busy_handle);
+    DeleteThread(&test_handle);
+
+    TestPostamble();
+}
+
+#endif // THREAD_STATS_ENABLED
\ No newline at end of file
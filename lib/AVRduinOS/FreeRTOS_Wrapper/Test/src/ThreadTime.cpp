@@ -0,0 +1,95 @@
+/**
+ ********************************************************************************
+ * @file    ThreadTime.cpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Unit Tests for the Microsecond Time Functions in the FreeRTOS Wrapper
+ * @version 1.0
+ * @date    2024-03-18
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#include "ThreadTime.hpp"
+
+#include "FreeRTOS_Wrapper.h"
+
+#include "thread_test_utilities.hpp"
+#include "test_utilities.hpp"
+
+#if (THREAD_TIME_MICROS_ENABLED == 1)
+
+#define TIME_TEST_READINGS 1000
+
+void SDD_057_Thread(void *params __attribute__((unused))) {
+    // Sub-Tick Test
+    Print("Timing a 100 us Busy Wait...");
+    uint32_t start_time = ThreadTimeMicros();
+    delayMicroseconds(100);
+    uint32_t end_time = ThreadTimeMicros();
+    Verify_Margin("Busy Wait Microseconds", 100ul, (unsigned long)(end_time - start_time), 20ul);
+
+    // Monotonic Test
+    Print("Reading the Time %u Times...", TIME_TEST_READINGS);
+    unsigned long backward_steps = 0;
+    uint32_t previous = ThreadTimeMicros();
+    for (unsigned int i = 0; i < TIME_TEST_READINGS; i++) {
+        uint32_t now = ThreadTimeMicros();
+        if (now - previous >= 0x80000000UL)
+            backward_steps++;
+        previous = now;
+    }
+    Verify("Backward Steps", 0ul, backward_steps, EQUAL);
+
+    // Delay Test
+    Print("Timing a 1000 ms ThreadDelay...");
+    unsigned long start_millis = millis();
+    uint64_t start_time_64 = ThreadTimeMicros64();
+    start_time = ThreadTimeMicros();
+    ThreadDelay(1000);
+    end_time = ThreadTimeMicros();
+    uint64_t end_time_64 = ThreadTimeMicros64();
+    unsigned long end_millis = millis();
+    Verify_Margin("Delay Microseconds", (end_millis - start_millis) * 1000ul, (unsigned long)(end_time - start_time), 2000ul);
+    Verify_Margin("Delay Microseconds 64", (unsigned long)(end_time - start_time), (unsigned long)(end_time_64 - start_time_64), 100ul);
+    Verify_Margin("Low Word of 64-bit Time", (unsigned long)end_time, (unsigned long)(uint32_t)end_time_64, 100ul);
+
+    StopThreadScheduler();
+}
+
+test_results_t SDD_057() {
+    const char *testDescription = "This function will verify that " \
+        "ThreadTimeMicros resolves times shorter than a tick, never " \
+        "steps backward and agrees with millis() and ThreadTimeMicros64.";
+    
+    const char *testForLoopSets[] = {"Readings (1000)"};
+    const char *testPreconditionsList[] = {"Microsecond Time Enabled", "Scheduler Running"};
+    const char *testResultsList[] = {"A 100 us wait is timed within 20 us.",
+                                     "No reading is below the one before.",
+                                     "A 1000 ms delay agrees with millis() within 2 ms."};
+
+    TestPreamble(testDescription, testForLoopSets, testPreconditionsList, testResultsList);
+
+    // Configuring Test Thread
+    Print("Configuring Thread for Test");
+    thread_function_t test_thread_config = ConfigureThread("TestName", SDD_057_Thread, THREAD_PRIORITY_HIGH, 192);
+    Verify("Thread Valid Status", THREAD_STRUCT_VALID, test_thread_config.valid, EQUAL);
+    
+    // Creating Test Thread
+    Print("Creating Thread for Test");
+    thread_handle_t test_handle = NULL; 
+    thread_return_t retval = CreateThread(&test_handle, test_thread_config);
+    Verify("Thread Creation Status", THREAD_SUCCESS, retval, EQUAL);
+
+    // Starting Thread Scheduler
+    Print("Starting Thread Scheduler...");
+    StartThreadScheduler();
+
+    // Delete Thread
+    Print("Deleting Thread...");
+    DeleteThread(&test_handle);
+
+    TestPostamble();
+}
+
+#endif // THREAD_TIME_MICROS_ENABLED
\ No newline at end of file
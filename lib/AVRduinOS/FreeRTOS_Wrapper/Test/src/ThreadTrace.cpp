@@ -0,0 +1,125 @@
+/**
+ ********************************************************************************
+ * @file    ThreadTrace.cpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Unit Tests for the Trace Recorder in the FreeRTOS Wrapper
+ * @version 1.0
+ * @date    2024-03-18
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#include "ThreadTrace.hpp"
+
+#include "FreeRTOS_Wrapper.h"
+
+#include "thread_test_utilities.hpp"
+#include "test_utilities.hpp"
+
+#if (THREAD_TRACE_ENABLED == 1)
+
+static uint8_t trace_test_buffer[THREAD_TRACE_RECORDS * THREAD_TRACE_RECORD_SIZE];
+
+static uint32_t TraceTestTime(const uint8_t *record) {
+    return (uint32_t)record[2] | ((uint32_t)record[3] << 8) | ((uint32_t)record[4] << 16) | ((uint32_t)record[5] << 24);
+}
+
+static void TraceTestFlush() {
+    while (ThreadTraceRead(trace_test_buffer, THREAD_TRACE_RECORDS) != 0);
+}
+
+test_results_t SDD_043() {
+    const char *testDescription = "This function will verify that " \
+        "the trace recorder captures user marks and queue events in order " \
+        "with increasing timestamps.";
+    
+    const char *testPreconditionsList[] = {"THREAD_TRACE_ENABLED with the kernel hooks included"};
+    const char *testResultsList[] = {"Records start and end with the user marks",
+                                     "Queue send and receive are recorded between the marks",
+                                     "Timestamps never decrease"};
+
+    TestPreamble(testDescription, NULL, testPreconditionsList, testResultsList);
+
+    Print("Creating Queue for Test");
+    thread_queue_handle_t queue = NULL;
+    thread_return_t retval = CreateQueue(&queue, 1, sizeof(uint8_t));
+    Verify("Queue Creation Status", THREAD_SUCCESS, retval, EQUAL);
+
+    // Recording Events
+    Print("Recording Marks and Queue Events");
+    TraceTestFlush();
+    ThreadTraceStart();
+    ThreadTraceMark(1);
+    uint8_t item = 42;
+    QueueSend(&queue, &item, 0);
+    QueueReceive(&queue, &item, 0);
+    ThreadTraceMark(2);
+    ThreadTraceStop();
+
+    // Reading Records
+    Print("Reading Records");
+    uint8_t count = ThreadTraceRead(trace_test_buffer, THREAD_TRACE_RECORDS);
+    Verify("Record Count", 4ul, (unsigned long)count, GREATER_THAN_OR_EQUAL);
+
+    const uint8_t *first = &trace_test_buffer[0];
+    const uint8_t *last = &trace_test_buffer[(count - 1) * THREAD_TRACE_RECORD_SIZE];
+    Verify("First Event", THREAD_TRACE_MARK, first[0], EQUAL);
+    Verify("First Mark", 1, first[1], EQUAL);
+    Verify("Last Event", THREAD_TRACE_MARK, last[0], EQUAL);
+    Verify("Last Mark", 2, last[1], EQUAL);
+
+    bool sent = false;
+    bool received = false;
+    bool ordered = true;
+    for (uint8_t i = 0; i < count; i++) {
+        const uint8_t *record = &trace_test_buffer[i * THREAD_TRACE_RECORD_SIZE];
+        sent |= (record[0] == THREAD_TRACE_QUEUE_SEND);
+        received |= (record[0] == THREAD_TRACE_QUEUE_RECEIVE);
+        if (i > 0 && TraceTestTime(record) < TraceTestTime(record - THREAD_TRACE_RECORD_SIZE))
+            ordered = false;
+    }
+    Verify("Queue Send Recorded", true, sent, EQUAL);
+    Verify("Queue Receive Recorded", true, received, EQUAL);
+    Verify("Timestamps Ordered", true, ordered, EQUAL);
+
+    DeleteQueue(&queue);
+
+    TestPostamble();
+}
+
+test_results_t SDD_044() {
+    const char *testDescription = "This function will verify that " \
+        "the trace recorder drops records once the buffer is full and " \
+        "reports how many were dropped.";
+    
+    const char *testPreconditionsList[] = {"THREAD_TRACE_ENABLED with the kernel hooks included"};
+    const char *testResultsList[] = {"Buffer holds THREAD_TRACE_RECORDS records",
+                                     "Next record after draining is an overflow with the dropped count"};
+
+    TestPreamble(testDescription, NULL, testPreconditionsList, testResultsList);
+
+    // Overfilling the Buffer
+    Print("Recording %d Marks", THREAD_TRACE_RECORDS + 5);
+    TraceTestFlush();
+    ThreadTraceStart();
+    for (int i = 0; i < THREAD_TRACE_RECORDS + 5; i++)
+        ThreadTraceMark((uint8_t)i);
+
+    uint8_t count = ThreadTraceRead(trace_test_buffer, THREAD_TRACE_RECORDS);
+    Verify("Record Count", (unsigned long)THREAD_TRACE_RECORDS, (unsigned long)count, EQUAL);
+
+    // Recording after Draining
+    Print("Recording after Draining");
+    ThreadTraceMark(0xFF);
+    ThreadTraceStop();
+    count = ThreadTraceRead(trace_test_buffer, THREAD_TRACE_RECORDS);
+    Verify("Record Count", 2ul, (unsigned long)count, EQUAL);
+    Verify("Overflow Event", THREAD_TRACE_OVERFLOW, trace_test_buffer[0], EQUAL);
+    Verify("Dropped Records", 5, trace_test_buffer[1], EQUAL);
+    Verify("Mark Event", THREAD_TRACE_MARK, trace_test_buffer[THREAD_TRACE_RECORD_SIZE], EQUAL);
+
+    TestPostamble();
+}
+
+#endif // THREAD_TRACE_ENABLED
\ No newline at end of file
@@ -0,0 +1,198 @@
+/**
+ ********************************************************************************
+ * @file    Timer.cpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Unit Tests for the Software Timer Functions in the FreeRTOS Wrapper
+ * @version 1.0
+ * @date    2024-03-18
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#include "Timer.hpp"
+
+#include "FreeRTOS_Wrapper.h"
+
+#include "thread_test_utilities.hpp"
+#include "test_utilities.hpp"
+
+#if (configUSE_TIMERS == 1)
+#define TIMER_TEST_PERIOD 60
+#define TIMER_TEST_RUNS 5
+
+static thread_timer_handle_t timer_test_one_shot = NULL;
+static thread_timer_handle_t timer_test_reload = NULL;
+static volatile unsigned long timer_test_one_shot_runs = 0;
+static volatile unsigned long timer_test_reload_runs = 0;
+
+void Timer_Test_Callback(thread_timer_handle_t timer) {
+    volatile unsigned long &runs = *(volatile unsigned long *)TimerContext(timer);
+    runs++;
+}
+
+test_results_t SDD_052() {
+    const char *testDescription = "This function will verify that " \
+        "the timer creation functions throw an error if the handle, " \
+        "callback or period is invalid, and that a created timer keeps " \
+        "its period and context.";
+    
+    const char *testResultsList[] = {"Error is thrown when NULL handle pointer",
+                                     "Error is thrown when not NULL handle",
+                                     "Error is thrown when NULL callback",
+                                     "Error is thrown when period below one tick",
+                                     "Timer is created stopped with its period and context"};
+
+    TestPreamble(testDescription, NULL, NULL, testResultsList);
+
+    unsigned long runs = 0;
+
+    struct test_case_data {
+        bool null_pointer;
+        thread_timer_handle_t handle;
+        thread_time_t period;
+        thread_timer_callback_t callback;
+        thread_return_t expected;
+        const char *case_name;
+    } Test_Cases[] = {
+        {true,  NULL,                           100,                    Timer_Test_Callback,    THREAD_HANDLE_INVALID,      "NULL Handle Pointer (Invalid)"},
+        {false, (thread_timer_handle_t)0x1234,  100,                    Timer_Test_Callback,    THREAD_HANDLE_INVALID,      "non-NULL Handle (Invalid)"},
+        {false, NULL,                           100,                    NULL,                   THREAD_FUNCTION_INVALID,    "NULL Callback (Invalid)"},
+        {false, NULL,                           0,                      Timer_Test_Callback,    THREAD_TIMER_INVALID,       "Zero Period (Invalid)"},
+        {false, NULL,                           THREAD_MILLISEC - 1,    Timer_Test_Callback,    THREAD_TIMER_INVALID,       "Period below one Tick (Invalid)"},
+        {false, NULL,                           100,                    Timer_Test_Callback,    THREAD_SUCCESS,             "Valid Inputs (Valid)"}
+    };
+
+    for (test_case_data Test_Case : Test_Cases) {
+        Print("Creating Timer with %s", Test_Case.case_name);
+        thread_timer_handle_t handle = Test_Case.handle;
+        thread_return_t retval = CreateTimer(Test_Case.null_pointer ? NULL : &handle, "Timer", Test_Case.period, AUTO_RELOAD, Test_Case.callback, &runs);
+        Verify("Timer Creation Status", Test_Case.expected, retval, EQUAL);
+        if (retval == THREAD_SUCCESS) {
+            Verify("Timer Active", false, TimerActive(&handle), EQUAL);
+            Verify_Margin("Timer Period", (unsigned long)Test_Case.period, (unsigned long)TimerPeriod(&handle), (unsigned long)THREAD_MILLISEC);
+            Verify("Timer Context", (unsigned long)(uintptr_t)&runs, (unsigned long)(uintptr_t)TimerContext(handle), EQUAL);
+            Print("Deleting Timer...");
+            Verify("Timer Delete Status", THREAD_SUCCESS, DeleteTimer(&handle, 0), EQUAL);
+            Verify("Timer Handle", 0ul, (unsigned long)(uintptr_t)handle, EQUAL);
+        }
+    }
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+    {
+        THREAD_TIMER_STATIC_MEMORY(timer_test_memory);
+        thread_timer_handle_t handle = NULL;
+
+        Print("Creating Static Timer with NULL Memory (Invalid)");
+        thread_return_t retval = CreateStaticTimer(&handle, "Timer", 100, ONE_SHOT, Timer_Test_Callback, &runs, NULL);
+        Verify("Timer Creation Status", THREAD_MEMORY_INVALID, retval, EQUAL);
+        Print("Creating Static Timer");
+        retval = CreateStaticTimer(&handle, "Timer", 100, ONE_SHOT, Timer_Test_Callback, &runs, &timer_test_memory);
+        Verify("Timer Creation Status", THREAD_SUCCESS, retval, EQUAL);
+        if (retval == THREAD_SUCCESS) {
+            Verify("Timer Context", (unsigned long)(uintptr_t)&runs, (unsigned long)(uintptr_t)TimerContext(handle), EQUAL);
+            Print("Deleting Timer...");
+            DeleteTimer(&handle, 0);
+        }
+    }
+#endif // configSUPPORT_STATIC_ALLOCATION
+
+    TestPostamble();
+}
+
+void SDD_053_Thread(void *params __attribute__((unused))) {
+    Print("Starting One-Shot and Auto-Reload Timers...");
+    Verify("Timer Start Status", THREAD_SUCCESS, TimerStart(&timer_test_one_shot, 100), EQUAL);
+    Verify("Timer Start Status", THREAD_SUCCESS, TimerStart(&timer_test_reload, 100), EQUAL);
+
+    ThreadDelay(TIMER_TEST_RUNS * TIMER_TEST_PERIOD + TIMER_TEST_PERIOD / 2);
+    Verify("One-Shot Runs", 1ul, timer_test_one_shot_runs, EQUAL);
+    Verify("One-Shot Active", false, TimerActive(&timer_test_one_shot), EQUAL);
+    Verify_Margin("Auto-Reload Runs", (unsigned long)TIMER_TEST_RUNS, timer_test_reload_runs, 1ul);
+    Verify("Auto-Reload Active", true, TimerActive(&timer_test_reload), EQUAL);
+
+    Print("Doubling the Auto-Reload Period...");
+    Verify("Timer Change Status", THREAD_SUCCESS, TimerChangePeriod(&timer_test_reload, 2 * TIMER_TEST_PERIOD, 100), EQUAL);
+    timer_test_reload_runs = 0;
+    ThreadDelay(TIMER_TEST_RUNS * 2 * TIMER_TEST_PERIOD + TIMER_TEST_PERIOD);
+    Verify_Margin("Auto-Reload Runs", (unsigned long)TIMER_TEST_RUNS, timer_test_reload_runs, 1ul);
+
+    Print("Stopping the Auto-Reload Timer from an Interrupt...");
+    thread_isr_yield_t yield = THREAD_ISR_YIELD_INIT;
+    EnterThreadCritical();
+    thread_return_t retval = TimerStopFromISR(&timer_test_reload, &yield);
+    ExitThreadCritical();
+    Verify("Timer Stop Status", THREAD_SUCCESS, retval, EQUAL);
+    ThreadDelay(TIMER_TEST_PERIOD);
+    timer_test_reload_runs = 0;
+    ThreadDelay(4 * TIMER_TEST_PERIOD);
+    Verify("Auto-Reload Runs", 0ul, timer_test_reload_runs, EQUAL);
+    Verify("Auto-Reload Active", false, TimerActive(&timer_test_reload), EQUAL);
+
+    Print("Restarting the One-Shot Timer from an Interrupt...");
+    yield = THREAD_ISR_YIELD_INIT;
+    EnterThreadCritical();
+    retval = TimerStartFromISR(&timer_test_one_shot, &yield);
+    ExitThreadCritical();
+    Verify("Timer Start Status", THREAD_SUCCESS, retval, EQUAL);
+    ThreadDelay(2 * TIMER_TEST_PERIOD);
+    Verify("One-Shot Runs", 2ul, timer_test_one_shot_runs, EQUAL);
+
+    StopThreadScheduler();
+}
+
+test_results_t SDD_053() {
+    const char *testDescription = "This function will verify that " \
+        "a one-shot timer runs its callback once, that an auto-reload " \
+        "timer runs every period, follows a change of period and stops, " \
+        "and that timers are started and stopped from an interrupt.";
+    
+    const char *testPreconditionsList[] = {"One-shot and auto-reload timers of 60 ms",
+                                           "Medium priority thread commanding the timers"};
+    const char *testResultsList[] = {"The one-shot timer runs once and stops",
+                                     "The auto-reload timer runs once per period",
+                                     "The auto-reload timer runs once per changed period",
+                                     "A stopped timer no longer runs",
+                                     "A timer started from an interrupt runs"};
+
+    TestPreamble(testDescription, NULL, testPreconditionsList, testResultsList);
+
+    thread_handle_t test_handle = NULL;
+
+    // Creating Timers
+    Print("Creating Timers");
+    timer_test_one_shot_runs = 0;
+    timer_test_reload_runs = 0;
+    thread_return_t retval = CreateTimer(&timer_test_one_shot, "OneShot", TIMER_TEST_PERIOD, ONE_SHOT, Timer_Test_Callback, (void *)&timer_test_one_shot_runs);
+    Verify("Timer Creation Status", THREAD_SUCCESS, retval, EQUAL);
+    if (retval != THREAD_SUCCESS) goto Early_Fail_Jump;
+    retval = CreateTimer(&timer_test_reload, "Reload", TIMER_TEST_PERIOD, AUTO_RELOAD, Timer_Test_Callback, (void *)&timer_test_reload_runs);
+    Verify("Timer Creation Status", THREAD_SUCCESS, retval, EQUAL);
+    if (retval != THREAD_SUCCESS) goto Early_Fail_Jump;
+
+    // Creating Test Thread
+    Print("Creating Thread for Test");
+    {
+        thread_function_t test_thread_config = ConfigureThread("TestName", SDD_053_Thread, THREAD_PRIORITY_MEDIUM, 256);
+        retval = CreateThread(&test_handle, test_thread_config);
+        Verify("Thread Creation Status", THREAD_SUCCESS, retval, EQUAL);
+    }
+
+    // Starting Thread Scheduler
+    Print("Starting Thread Scheduler...");
+    StartThreadScheduler();
+
+    // Delete Thread
+    Print("Deleting Threads...");
+    DeleteThread(&test_handle);
+
+    Early_Fail_Jump:
+
+    // Delete Timers, carried out by the daemon once the scheduler next starts
+    Print("Deleting Timers...");
+    DeleteTimer(&timer_test_one_shot, 0);
+    DeleteTimer(&timer_test_reload, 0);
+
+    TestPostamble();
+}
+#endif // configUSE_TIMERS
\ No newline at end of file
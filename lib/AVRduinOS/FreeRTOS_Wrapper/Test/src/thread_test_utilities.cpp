@@ -16,6 +16,9 @@
 
 #include <Arduino.h>
 
+thread_event_group_handle_t delay_test_events = NULL;
+volatile thread_time_t delay_test_time = 0;
+
 void Valid_Function(void *params) {
     for (;;) continue;
 }
@@ -25,21 +28,34 @@ void Valid_Function2(void *params) {
 }
 
 void ThreadDelay_Test(void *params) {
-    bool &delay_indicator = test_booleans[0];
-    bool &start_indicator = test_booleans[1];
-
-    delay_indicator = false;
-    start_indicator = false;
-
-    delay_test_time = 0;
     for (;;) {
-        if (start_indicator) {
-            delay_indicator = true;
-            start_indicator = false;
+        // Blocks until a test asks for a delay, clearing the request
+        if (EventGroupWait(&delay_test_events, DELAY_TEST_START, WAIT_ALL, true, 1000, NULL) == THREAD_SUCCESS) {
             ThreadDelay(delay_test_time);
-            delay_indicator = false;
+            EventGroupSet(&delay_test_events, DELAY_TEST_DONE);
         }
+    }
+}
+
+void ThreadParameter_Test(void *params) {
+    bool &started_indicator = *(bool *)params;
 
+    started_indicator = true;
+    for (;;) {
+        ThreadDelay(1000);
+    }
+}
+
+void Overload_Test(void *params) {
+    const overload_test_t &overload = *(const overload_test_t *)params;
+
+    ThreadDelay(overload.start_ms);
+
+    // Spins rather than blocks, starving every lower priority thread
+    thread_time_t start_time = ThreadTime();
+    while (ThreadTime() - start_time < overload.busy_ms) continue;
+
+    for (;;) {
         ThreadDelay(1000);
     }
 }
\ No newline at end of file
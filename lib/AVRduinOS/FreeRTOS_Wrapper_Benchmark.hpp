@@ -0,0 +1,19 @@
+/**
+ ********************************************************************************
+ * @file    FreeRTOS_Wrapper_Benchmark.hpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Function Wrapper Benchmarks for FreeRTOS
+ * @version 1.0
+ * @date    2024-03-18
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#ifndef __FREERTOS_WRAPPER_BENCHMARK_H__
+#define __FREERTOS_WRAPPER_BENCHMARK_H__
+
+#include "benchmark_utilities.hpp"
+#include "WrapperLatency.hpp"
+
+#endif // __FREERTOS_WRAPPER_BENCHMARK_H__
\ No newline at end of file
@@ -15,7 +15,24 @@
 
 #include "ConfigureThread.hpp"
 #include "CreateThread.hpp"
+#include "CreateStaticThread.hpp"
 #include "DeleteThread.hpp"
 #include "ThreadDelay.hpp"
+#include "ThreadTime.hpp"
+#include "ThreadParameters.hpp"
+#include "ThreadPeriod.hpp"
+#include "Queue.hpp"
+#include "PooledThread.hpp"
+#include "ThreadStats.hpp"
+#include "Schedule.hpp"
+#include "ThreadStack.hpp"
+#include "ThreadTrace.hpp"
+#include "Mutex.hpp"
+#include "Semaphore.hpp"
+#include "ThreadNotice.hpp"
+#include "EventGroup.hpp"
+#include "Timer.hpp"
+#include "Buffer.hpp"
+#include "TestRegistry.hpp"
 
 #endif // __FREERTOS_WRAPPER_TEST_H__
\ No newline at end of file
@@ -0,0 +1,186 @@
+/**
+ ********************************************************************************
+ * @file    BlockPool.hpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Fixed-Block Memory Pool
+ * @version 1.0
+ * @date    2024-03-18
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#ifndef __BLOCK_POOL_HPP__
+#define __BLOCK_POOL_HPP__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(__AVR__)
+  #include <avr/interrupt.h>
+  #include <avr/io.h>
+#endif // __AVR__
+
+/**
+ ********************************************************************************
+ * @brief   Pool of fixed-size blocks with constant-time allocate and free
+ ********************************************************************************
+ * @tparam  BlockSize  Usable size of each block in bytes
+ * @tparam  Count      Number of blocks in the pool
+ ********************************************************************************
+ * @note    Free blocks are chained through their own first bytes, so the pool
+ *          costs no RAM beyond the blocks, a bit per block and a few counters.
+ *          The bit marks a block as handed out, so a block freed twice is
+ *          rejected instead of corrupting the free list.
+ *          Allocate and Free only hold interrupts off for a handful of
+ *          instructions, which makes them safe to call from both threads and
+ *          ISRs. On the host a spin lock takes the place of the interrupt lock.
+ *          Blocks are aligned for any type, so a block may hold a thread
+ *          control block, a queue or a message.
+ ********************************************************************************
+**/
+template <size_t BlockSize, size_t Count>
+class BlockPool {
+    static_assert(BlockSize > 0, "BlockPool block size must not be zero");
+    static_assert(Count > 0, "BlockPool must hold at least one block");
+
+public:
+    BlockPool() : free_list(NULL), used(0), peak(0), failures(0), lock(false) {
+        for (size_t i = 0; i < Count; i++) {
+            blocks[i].next = (i + 1 < Count) ? &blocks[i + 1] : NULL;
+        }
+        for (size_t i = 0; i < sizeof(allocated); i++) {
+            allocated[i] = 0;
+        }
+        free_list = &blocks[0];
+    }
+
+    BlockPool(const BlockPool &) = delete;
+    BlockPool &operator=(const BlockPool &) = delete;
+
+    /**
+     ****************************************************************************
+     * @brief   Take a block from the pool
+     ****************************************************************************
+     * @return  void *  NULL if the pool is exhausted
+     ****************************************************************************
+    **/
+    void *Allocate() {
+        lock_state_t state = Lock();
+        block_t *block = free_list;
+        if (block != NULL) {
+            free_list = block->next;
+            allocated[Index(block) / 8] |= (uint8_t)(1 << (Index(block) % 8));
+            if (++used > peak) peak = used;
+        }
+        else {
+            failures++;
+        }
+        Unlock(state);
+        return block;
+    }
+
+    /**
+     ****************************************************************************
+     * @brief   Return a block to the pool
+     ****************************************************************************
+     * @param[in]     memory  TYPE: void *
+     ****************************************************************************
+     * @return  bool  false if the memory is not a block of this pool or the
+     *                block is already free
+     ****************************************************************************
+    **/
+    bool Free(void *memory) {
+        if (!Owns(memory))
+            return false;
+
+        block_t *block = (block_t *)memory;
+        const size_t index = Index(block);
+        const uint8_t bit = (uint8_t)(1 << (index % 8));
+        lock_state_t state = Lock();
+        const bool handed_out = (allocated[index / 8] & bit) != 0;
+        if (handed_out) {
+            allocated[index / 8] &= (uint8_t)~bit;
+            block->next = free_list;
+            free_list = block;
+            used--;
+        }
+        Unlock(state);
+        return handed_out;
+    }
+
+    /**
+     ****************************************************************************
+     * @brief   Check whether a pointer is the start of a block of this pool
+     ****************************************************************************
+     * @param[in]     memory  TYPE: const void *
+     ****************************************************************************
+     * @return  bool
+     ****************************************************************************
+    **/
+    bool Owns(const void *memory) const {
+        const uint8_t *address = (const uint8_t *)memory;
+        const uint8_t *start = (const uint8_t *)&blocks[0];
+        if (address < start || address >= start + sizeof(blocks))
+            return false;
+        return (size_t)(address - start) % sizeof(block_t) == 0;
+    }
+
+    size_t Used() const { return used; }
+    size_t Available() const { return Count - used; }
+    size_t Peak() const { return peak; }
+    size_t Failures() const { return failures; }
+    static constexpr size_t Size() { return BlockSize; }
+    static constexpr size_t Capacity() { return Count; }
+
+private:
+    union block_t {
+        block_t *next;
+        uint8_t data[BlockSize];
+        long double align_double;
+        long long align_integer;
+        void *align_pointer;
+    };
+
+    size_t Index(const block_t *block) const {
+        return (size_t)(block - &blocks[0]);
+    }
+
+#if defined(__AVR__)
+    typedef uint8_t lock_state_t;
+
+    lock_state_t Lock() {
+        lock_state_t state = SREG;
+        cli();
+        return state;
+    }
+
+    void Unlock(lock_state_t state) {
+        // Keeps the stores of the critical section ahead of the interrupt enable
+        __asm__ __volatile__ ("" ::: "memory");
+        SREG = state;
+    }
+#else
+    typedef bool lock_state_t;
+
+    lock_state_t Lock() {
+        while (__atomic_test_and_set(&lock, __ATOMIC_ACQUIRE)) continue;
+        return true;
+    }
+
+    void Unlock(lock_state_t) {
+        __atomic_clear(&lock, __ATOMIC_RELEASE);
+    }
+#endif // __AVR__
+
+    block_t blocks[Count];
+    uint8_t allocated[(Count + 7) / 8];
+    block_t *free_list;
+    volatile size_t used;
+    volatile size_t peak;
+    volatile size_t failures;
+    bool lock;
+};
+
+#endif // __BLOCK_POOL_HPP__
\ No newline at end of file
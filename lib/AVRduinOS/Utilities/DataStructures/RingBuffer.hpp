@@ -0,0 +1,128 @@
+/**
+ ********************************************************************************
+ * @file    RingBuffer.hpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Lock-Free Single-Producer Single-Consumer Ring Buffer
+ * @version 1.0
+ * @date    2024-03-18
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#ifndef __RING_BUFFER_HPP__
+#define __RING_BUFFER_HPP__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ ********************************************************************************
+ * @brief   Lock-free ring buffer for one producer and one consumer
+ ********************************************************************************
+ * @tparam  T         Item type, copied in and out by value
+ * @tparam  Capacity  Number of items, a power of two no larger than 128
+ ********************************************************************************
+ * @note    The producer only writes the head index and the consumer only
+ *          writes the tail index. Both are single bytes, which the AVR reads
+ *          and writes atomically, so neither side needs a critical section.
+ *          One side may run in an ISR and the other in a thread.
+ *          The indices run freely and wrap at 256, which the power-of-two
+ *          capacity divides evenly, so a full buffer holds Capacity items.
+ ********************************************************************************
+**/
+template <typename T, uint8_t Capacity>
+class RingBuffer {
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0,
+                  "RingBuffer capacity must be a power of two");
+    static_assert(Capacity <= 128,
+                  "RingBuffer capacity must fit single-byte indices");
+
+public:
+    RingBuffer() : head(0), tail(0) {}
+
+    /**
+     ****************************************************************************
+     * @brief   Copy an item into the buffer (producer side)
+     ****************************************************************************
+     * @param[in]     item  TYPE: const T &
+     ****************************************************************************
+     * @return  bool  false if the buffer is full
+     ****************************************************************************
+    **/
+    bool Push(const T &item) {
+        uint8_t local_head = __atomic_load_n(&head, __ATOMIC_RELAXED);
+        if ((uint8_t)(local_head - __atomic_load_n(&tail, __ATOMIC_ACQUIRE)) >= Capacity)
+            return false;
+
+        buffer[local_head & (Capacity - 1)] = item;
+        __atomic_store_n(&head, (uint8_t)(local_head + 1), __ATOMIC_RELEASE);
+        return true;
+    }
+
+    /**
+     ****************************************************************************
+     * @brief   Copy an item out of the buffer and remove it (consumer side)
+     ****************************************************************************
+     * @param[out]    item  TYPE: T &
+     ****************************************************************************
+     * @return  bool  false if the buffer is empty
+     ****************************************************************************
+    **/
+    bool Pop(T &item) {
+        uint8_t local_tail = __atomic_load_n(&tail, __ATOMIC_RELAXED);
+        if (local_tail == __atomic_load_n(&head, __ATOMIC_ACQUIRE))
+            return false;
+
+        item = buffer[local_tail & (Capacity - 1)];
+        __atomic_store_n(&tail, (uint8_t)(local_tail + 1), __ATOMIC_RELEASE);
+        return true;
+    }
+
+    /**
+     ****************************************************************************
+     * @brief   Copy the oldest item out of the buffer without removing it
+     *          (consumer side)
+     ****************************************************************************
+     * @param[out]    item  TYPE: T &
+     ****************************************************************************
+     * @return  bool  false if the buffer is empty
+     ****************************************************************************
+    **/
+    bool Peek(T &item) const {
+        uint8_t local_tail = __atomic_load_n(&tail, __ATOMIC_RELAXED);
+        if (local_tail == __atomic_load_n(&head, __ATOMIC_ACQUIRE))
+            return false;
+
+        item = buffer[local_tail & (Capacity - 1)];
+        return true;
+    }
+
+    /**
+     ****************************************************************************
+     * @brief   Get the number of items in the buffer
+     ****************************************************************************
+     * @return  uint8_t
+     ****************************************************************************
+     * @note    While the count is taken the other side can only add items, if
+     *          it is the producer, or remove them, if it is the consumer. So the
+     *          count is a lower bound for the consumer and an upper bound for
+     *          the producer, which is what makes Empty() and Full() safe to act
+     *          on from their own side.
+     ****************************************************************************
+    **/
+    uint8_t Count() const {
+        return (uint8_t)(__atomic_load_n(&head, __ATOMIC_ACQUIRE) - __atomic_load_n(&tail, __ATOMIC_ACQUIRE));
+    }
+
+    bool Empty() const { return Count() == 0; }
+    bool Full() const { return Count() >= Capacity; }
+    static constexpr uint8_t Size() { return Capacity; }
+
+private:
+    T buffer[Capacity];
+    uint8_t head;
+    uint8_t tail;
+};
+
+#endif // __RING_BUFFER_HPP__
\ No newline at end of file
@@ -0,0 +1,313 @@
+/**
+ ********************************************************************************
+ * @file    test_log.cpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Compact Binary Test Log
+ * @version 1.0
+ * @date    2024-03-18
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#include "test_log.hpp"
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <Arduino.h>
+#include <Arduino_FreeRTOS.h>
+
+#if (TEST_LOG_COMPACT == 1)
+
+static_assert(TEST_LOG_STRINGS >= 12 && TEST_LOG_STRINGS <= 32, "TEST_LOG_STRINGS must be from 12 to 32");
+
+typedef struct __test_log_slot {
+    const char *text;
+    size_t length;
+    uint16_t hash;
+} test_log_slot_t;
+
+static test_log_slot_t log_strings[TEST_LOG_STRINGS];
+static uint8_t log_victim = 0;
+static uint32_t log_pinned = 0;
+
+// Records from several threads must not interleave, so the scheduler is
+// held while a record and the strings it refers to are sent
+static void TestLogBegin() {
+    vTaskSuspendAll();
+    log_pinned = 0;
+}
+
+static void TestLogEnd() {
+    xTaskResumeAll();
+}
+
+static void TestLogSend(uint8_t type, uint8_t *frame, uint8_t length) {
+    frame[0] = TEST_LOG_SYNC;
+    frame[1] = type;
+    frame[2] = length;
+
+    uint8_t checksum = type + length;
+    for (uint8_t i = 0; i < length; i++)
+        checksum += frame[3 + i];
+    frame[3 + length] = checksum;
+
+    Serial.write(frame, 3 + length + 1);
+}
+
+static uint8_t TestLogPut(uint8_t *payload, uint8_t length, uint32_t word) {
+    if (length + 4 > TEST_LOG_PAYLOAD)
+        return length;
+    payload[length++] = (uint8_t)(word);
+    payload[length++] = (uint8_t)(word >> 8);
+    payload[length++] = (uint8_t)(word >> 16);
+    payload[length++] = (uint8_t)(word >> 24);
+    return length;
+}
+
+static uint32_t TestLogFloat(double value) {
+    float real = (float)value;
+    uint32_t word;
+    memcpy(&word, &real, sizeof(word));
+    return word;
+}
+
+// Slot of a string, sending the string first if no slot holds it. Buffers are
+// reused with new contents, so a slot only matches the same text at the same
+// address. Slots referred to by the record being built are never replaced.
+static uint8_t TestLogReference(const char *text) {
+    if (text == NULL)
+        text = "(null)";
+
+    size_t length = 0;
+    uint16_t hash = 0;
+    for (const char *c = text; *c != '\0'; c++, length++)
+        hash = hash * 31 + (uint8_t)*c;
+
+    for (uint8_t slot = 0; slot < TEST_LOG_STRINGS; slot++) {
+        if (log_strings[slot].text == text && log_strings[slot].length == length && log_strings[slot].hash == hash) {
+            log_pinned |= (1UL << slot);
+            return slot;
+        }
+    }
+
+    uint8_t slot = log_victim;
+    while (log_pinned & (1UL << slot))
+        slot = (slot + 1) % TEST_LOG_STRINGS;
+    log_victim = (slot + 1) % TEST_LOG_STRINGS;
+    log_strings[slot] = { text, length, hash };
+    log_pinned |= (1UL << slot);
+
+    uint8_t frame[3 + TEST_LOG_PAYLOAD + 1];
+    uint8_t type = TEST_LOG_STRING;
+    do {
+        uint8_t chunk = (length < TEST_LOG_PAYLOAD - 1) ? length : TEST_LOG_PAYLOAD - 1;
+        frame[3] = slot;
+        memcpy(&frame[4], text, chunk);
+        TestLogSend(type, frame, chunk + 1);
+        text += chunk;
+        length -= chunk;
+        type = TEST_LOG_STRING_MORE;
+    } while (length > 0);
+
+    return slot;
+}
+
+void TestLogPrint(uint8_t type, const char *fmt, va_list args) {
+    uint8_t frame[3 + TEST_LOG_PAYLOAD + 1];
+    uint8_t *payload = &frame[3];
+    uint8_t length = 0;
+
+    TestLogBegin();
+    payload[length++] = TestLogReference(fmt);
+
+    // Walk the format as printf would, so the expander can read the arguments back
+    for (const char *c = fmt; *c != '\0'; c++) {
+        if (*c != '%')
+            continue;
+        if (*++c == '%')
+            continue;
+
+        while (*c != '\0' && strchr("-+ #0123456789.*", *c) != NULL) {
+            if (*c == '*')
+                length = TestLogPut(payload, length, (uint32_t)va_arg(args, int));
+            c++;
+        }
+
+        uint8_t longs = 0;
+        char size = '\0';
+        while (*c != '\0' && strchr("hlLjzt", *c) != NULL) {
+            if (*c == 'l')
+                longs++;
+            else if (*c != 'h')
+                size = *c;
+            c++;
+        }
+        if (*c == '\0')
+            break;
+
+        uint32_t word;
+        switch (*c) {
+            case 'd':
+            case 'i':
+                if (size == 'z') word = (uint32_t)va_arg(args, size_t);
+                else if (size == 'j') word = (uint32_t)va_arg(args, intmax_t);
+                else if (size == 't') word = (uint32_t)va_arg(args, ptrdiff_t);
+                else if (longs >= 2) word = (uint32_t)va_arg(args, long long);
+                else if (longs == 1) word = (uint32_t)va_arg(args, long);
+                else word = (uint32_t)va_arg(args, int);
+                break;
+            case 'u':
+            case 'o':
+            case 'x':
+            case 'X':
+                if (size == 'z') word = (uint32_t)va_arg(args, size_t);
+                else if (size == 'j') word = (uint32_t)va_arg(args, uintmax_t);
+                else if (size == 't') word = (uint32_t)va_arg(args, ptrdiff_t);
+                else if (longs >= 2) word = (uint32_t)va_arg(args, unsigned long long);
+                else if (longs == 1) word = (uint32_t)va_arg(args, unsigned long);
+                else word = (uint32_t)va_arg(args, unsigned int);
+                break;
+            case 'c':
+                word = (uint32_t)va_arg(args, int);
+                break;
+            case 'p':
+                word = (uint32_t)(uintptr_t)va_arg(args, void *);
+                break;
+            case 'f':
+            case 'F':
+            case 'e':
+            case 'E':
+            case 'g':
+            case 'G':
+            case 'a':
+            case 'A':
+                word = (size == 'L') ? TestLogFloat((double)va_arg(args, long double)) : TestLogFloat(va_arg(args, double));
+                break;
+            case 's':
+                word = TestLogReference(va_arg(args, const char *));
+                break;
+            case 'n':
+                (void)va_arg(args, void *);
+                continue;
+            default:
+                continue;
+        }
+        length = TestLogPut(payload, length, word);
+    }
+
+    TestLogSend(type, frame, length);
+    TestLogEnd();
+}
+
+void TestLogLine() {
+    uint8_t frame[3 + 1];
+
+    TestLogBegin();
+    TestLogSend(TEST_LOG_LINE, frame, 0);
+    TestLogEnd();
+}
+
+void TestLogPreamble(const char *testName,
+                     const char *testFile,
+                     const char *testDescription,
+                     string_array_t testForLoopSets,
+                     string_array_t testPreconditionsList,
+                     string_array_t testResultsList) {
+    uint8_t frame[3 + 3 + 1];
+
+    TestLogBegin();
+    frame[3] = TestLogReference(testName);
+    frame[4] = TestLogReference(testFile);
+    frame[5] = TestLogReference(testDescription);
+    TestLogSend(TEST_LOG_PREAMBLE, frame, 3);
+    TestLogEnd();
+
+    const string_array_t *conditions[] = {&testForLoopSets, &testPreconditionsList, &testResultsList};
+    for (uint8_t section = TEST_LOG_FOR; section <= TEST_LOG_EXPECTED; section++) {
+        if (conditions[section]->array == NULL)
+            continue;
+        for (size_t i = 0; i < conditions[section]->size; i++) {
+            TestLogBegin();
+            frame[3] = section;
+            frame[4] = TestLogReference(conditions[section]->array[i]);
+            TestLogSend(TEST_LOG_CONDITION, frame, 2);
+            TestLogEnd();
+        }
+    }
+
+    TestLogBegin();
+    TestLogSend(TEST_LOG_PREAMBLE_END, frame, 0);
+    TestLogEnd();
+}
+
+void TestLogPostamble(const char *testName, test_results_t results) {
+    uint8_t frame[3 + 7 + 1];
+
+    TestLogBegin();
+    frame[3] = TestLogReference(testName);
+    frame[4] = (uint8_t)(results.total);
+    frame[5] = (uint8_t)(results.total >> 8);
+    frame[6] = (uint8_t)(results.passed);
+    frame[7] = (uint8_t)(results.passed >> 8);
+    frame[8] = (uint8_t)(results.failed);
+    frame[9] = (uint8_t)(results.failed >> 8);
+    TestLogSend(TEST_LOG_POSTAMBLE, frame, 7);
+    TestLogEnd();
+}
+
+static uint32_t TestLogValue(verify_kind_t kind, verify_value_t value) {
+    switch (kind) {
+        case VERIFY_INT:
+            return (uint32_t)value.integer;
+        case VERIFY_UNSIGNED:
+            return (uint32_t)value.natural;
+        case VERIFY_DOUBLE:
+            return TestLogFloat(value.real);
+        case VERIFY_TEXT:
+            return TestLogReference(value.text);
+        default:
+            return 0;
+    }
+}
+
+void TestLogVerify(const char *testFile,
+                   int lineNumber,
+                   const char *valueName,
+                   verification_type_t type,
+                   verify_kind_t kind,
+                   bool passed,
+                   unsigned int testNumber,
+                   verify_value_t expected,
+                   verify_value_t actual,
+                   verify_value_t parameter) {
+    uint8_t frame[3 + 21 + 1];
+    uint8_t *payload = &frame[3];
+
+    TestLogBegin();
+    payload[0] = (uint8_t)type;
+    payload[1] = (uint8_t)kind;
+    payload[2] = passed ? 1 : 0;
+    payload[3] = (uint8_t)(testNumber);
+    payload[4] = (uint8_t)(testNumber >> 8);
+    payload[5] = (uint8_t)(lineNumber);
+    payload[6] = (uint8_t)(lineNumber >> 8);
+    payload[7] = TestLogReference(valueName);
+    payload[8] = TestLogReference(testFile);
+    uint8_t length = 9;
+    length = TestLogPut(payload, length, TestLogValue(kind, expected));
+    length = TestLogPut(payload, length, TestLogValue(kind, actual));
+    if (type == WITHIN_PERCENT)
+        length = TestLogPut(payload, length, TestLogFloat(parameter.real));
+    else if (kind == VERIFY_TEXT)
+        length = TestLogPut(payload, length, 0);
+    else
+        length = TestLogPut(payload, length, TestLogValue(kind, parameter));
+    TestLogSend(TEST_LOG_VERIFY, frame, length);
+    TestLogEnd();
+}
+
+#endif // TEST_LOG_COMPACT
\ No newline at end of file
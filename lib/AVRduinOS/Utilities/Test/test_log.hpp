@@ -0,0 +1,129 @@
+/**
+ ********************************************************************************
+ * @file    test_log.hpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Compact Binary Test Log
+ * @version 1.0
+ * @date    2024-03-18
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+ * @note    With TEST_LOG_COMPACT set to 1 the test utilities send numbered
+ *          binary records instead of formatted text. The report text lives in
+ *          tools/test_log_expand.py, which rebuilds it on the host.
+ *
+ *          Records use the frame of the thread trace:
+ *
+ *              0xA5, type, length, payload[length], checksum
+ *
+ *          where the checksum is the 8-bit sum of type, length and payload.
+ *          Strings are sent once into one of TEST_LOG_STRINGS slots and later
+ *          records refer to the slot. Numbers are 4 bytes, little endian.
+ ********************************************************************************
+**/
+
+#ifndef __TEST_LOG_HPP__
+#define __TEST_LOG_HPP__
+
+#include <stdarg.h>
+#include <stdint.h>
+
+#include "test_utilities.hpp"
+
+#define TEST_LOG_SYNC 0xA5
+
+// Record types, shared with tools/test_log_expand.py
+#define TEST_LOG_STRING       0x10
+#define TEST_LOG_STRING_MORE  0x11
+#define TEST_LOG_PRINT        0x12
+#define TEST_LOG_BANNER       0x13
+#define TEST_LOG_LINE         0x14
+#define TEST_LOG_PREAMBLE     0x15
+#define TEST_LOG_CONDITION    0x16
+#define TEST_LOG_PREAMBLE_END 0x17
+#define TEST_LOG_POSTAMBLE    0x18
+#define TEST_LOG_VERIFY       0x19
+
+/**
+ ********************************************************************************
+ * @brief   Number of string slots, more than the strings one record refers to
+ ********************************************************************************
+**/
+#ifndef TEST_LOG_STRINGS
+  #define TEST_LOG_STRINGS 16
+#endif // TEST_LOG_STRINGS
+
+/**
+ ********************************************************************************
+ * @brief   Largest record payload, limiting the arguments of one Print
+ ********************************************************************************
+**/
+#define TEST_LOG_PAYLOAD 48
+
+typedef enum __test_log_condition {
+    TEST_LOG_FOR = 0,
+    TEST_LOG_WITH,
+    TEST_LOG_EXPECTED
+} test_log_condition_t;
+
+/**
+ ********************************************************************************
+ * @brief   Send a Print or Banner record, arguments packed by the format
+ ********************************************************************************
+ * @param[in]     type    TYPE: uint8_t, TEST_LOG_PRINT or TEST_LOG_BANNER
+ * @param[in]     fmt     TYPE: const char *
+ * @param[in]     args    TYPE: va_list
+ ********************************************************************************
+ * @note    Integers are cut to 4 bytes and doubles sent as floats. Arguments
+ *          that do not fit in TEST_LOG_PAYLOAD are dropped.
+ ********************************************************************************
+**/
+void TestLogPrint(uint8_t type, const char *fmt, va_list args);
+
+/**
+ ********************************************************************************
+ * @brief   Send a horizontal rule record
+ ********************************************************************************
+**/
+void TestLogLine();
+
+/**
+ ********************************************************************************
+ * @brief   Send the records of a test preamble
+ ********************************************************************************
+**/
+void TestLogPreamble(const char *testName,
+                     const char *testFile,
+                     const char *testDescription,
+                     string_array_t testForLoopSets,
+                     string_array_t testPreconditionsList,
+                     string_array_t testResultsList);
+
+/**
+ ********************************************************************************
+ * @brief   Send the record of a test postamble
+ ********************************************************************************
+**/
+void TestLogPostamble(const char *testName, test_results_t results);
+
+/**
+ ********************************************************************************
+ * @brief   Send the record of one verification
+ ********************************************************************************
+ * @param[in]     parameter   TYPE: verify_value_t, the percent of a
+ *                            WITHIN_PERCENT check as a double, otherwise the
+ *                            margin as the kind of the values
+ ********************************************************************************
+**/
+void TestLogVerify(const char *testFile,
+                   int lineNumber,
+                   const char *valueName,
+                   verification_type_t type,
+                   verify_kind_t kind,
+                   bool passed,
+                   unsigned int testNumber,
+                   verify_value_t expected,
+                   verify_value_t actual,
+                   verify_value_t parameter);
+
+#endif // __TEST_LOG_HPP__
\ No newline at end of file
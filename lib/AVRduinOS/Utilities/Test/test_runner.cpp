@@ -0,0 +1,202 @@
+/**
+ ********************************************************************************
+ * @file    test_runner.cpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Table-Driven Unit Test Runner
+ * @version 1.0
+ * @date    2024-03-18
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#include "test_runner.hpp"
+
+#include <stdint.h>
+#include <string.h>
+
+#include <Arduino.h>
+
+#if defined(__AVR__)
+  #include <avr/io.h>
+  #include <avr/wdt.h>
+#else
+  #include <poll.h>
+  #include <signal.h>
+  #include <sys/wait.h>
+  #include <unistd.h>
+#endif // __AVR__
+
+typedef struct __test_run {
+    test_results_t results;
+    unsigned long elapsed;
+    bool finished;
+} test_run_t;
+
+typedef struct __test_summary {
+    test_results_t points;
+    unsigned int tests;
+    unsigned int failed_tests;
+    unsigned long elapsed;
+} test_summary_t;
+
+static bool TestSelected(const char *name, const char *filter) {
+    if (filter == NULL || *filter == '\0')
+        return true;
+
+    while (true) {
+        const char *end = strchr(filter, ',');
+        size_t length = (end != NULL) ? (size_t)(end - filter) : strlen(filter);
+        if (length > 0 && strncmp(name, filter, length) == 0)
+            return true;
+        if (end == NULL)
+            return false;
+        filter = end + 1;
+    }
+}
+
+static void TestReport(const char *name, test_run_t run, test_summary_t *summary) {
+    // A test that never returned counts as one failed test point
+    if (!run.finished)
+        run.results = test_results_t{0, 1, 1};
+
+    bool passed = run.finished && run.results.failed == 0;
+    summary->tests++;
+    summary->failed_tests += passed ? 0 : 1;
+    summary->points.passed += run.results.passed;
+    summary->points.failed += run.results.failed;
+    summary->points.total += run.results.total;
+    summary->elapsed += run.elapsed;
+
+    Print("%-16s %-4s %4u passed %4u failed %8lu ms", name, passed ? "PASS" : (run.finished ? "FAIL" : "DNF"),
+          run.results.passed, run.results.failed, run.elapsed);
+}
+
+static void TestSummary(const test_summary_t *summary) {
+    PrintLine();
+    Print("%u Tests, %u Failed", summary->tests, summary->failed_tests);
+    Print("%u Test Points, %u Passed, %u Failed", summary->points.total, summary->points.passed, summary->points.failed);
+    Print("%lu ms", summary->elapsed);
+    PrintLine();
+}
+
+#if defined(__AVR__)
+
+#define TEST_RUNNER_MAGIC 0x5452
+
+typedef struct __test_runner_state {
+    uint16_t magic;
+    uint16_t next;
+    uint16_t running;
+    test_summary_t summary;
+    uint16_t check;
+} test_runner_state_t;
+
+// Survives the watchdog resets between tests
+static test_runner_state_t runner_state __attribute__((section(".noinit")));
+
+// The watchdog stays on after it resets the MCU, so it is turned off before the
+// core starts up
+static void TestRunnerWatchdogOff() __attribute__((naked, used, section(".init3")));
+static void TestRunnerWatchdogOff() {
+    MCUSR = 0;
+    wdt_disable();
+}
+
+test_results_t RunTests(const test_case_t *tests, size_t count, const char *filter) {
+    if (runner_state.magic != TEST_RUNNER_MAGIC || runner_state.check != (uint16_t)~TEST_RUNNER_MAGIC) {
+        memset(&runner_state, 0, sizeof(runner_state));
+        runner_state.magic = TEST_RUNNER_MAGIC;
+        runner_state.check = (uint16_t)~TEST_RUNNER_MAGIC;
+    }
+
+    // The last boot ended inside this test
+    if (runner_state.running != 0 && runner_state.running <= count) {
+        TestReport(tests[runner_state.running - 1].name, test_run_t{{0, 0, 0}, 0, false}, &runner_state.summary);
+        runner_state.running = 0;
+    }
+
+    for (size_t i = runner_state.next; i < count; i++) {
+        if (!TestSelected(tests[i].name, filter))
+            continue;
+
+        runner_state.next = i + 1;
+        runner_state.running = i + 1;
+        unsigned long start = millis();
+        test_results_t results = tests[i].function();
+        test_run_t run = { results, millis() - start, true };
+        runner_state.running = 0;
+        TestReport(tests[i].name, run, &runner_state.summary);
+
+        // The next test gets a fresh kernel
+        if (runner_state.next < count) {
+            Serial.flush();
+            wdt_enable(WDTO_15MS);
+            while (true) continue;
+        }
+    }
+
+    TestSummary(&runner_state.summary);
+    runner_state.magic = 0;
+    return runner_state.summary.points;
+}
+
+#else
+
+static test_run_t TestRunIsolated(test_function_t function) {
+    test_run_t run = { {0, 0, 0}, 0, false };
+    unsigned long start = millis();
+
+    int channel[2];
+    pid_t child = -1;
+    if (pipe(channel) == 0) {
+        child = fork();
+        if (child < 0) {
+            close(channel[0]);
+            close(channel[1]);
+        }
+    }
+
+    // Without a process of its own the test shares the kernel with the runner
+    if (child < 0) {
+        run.results = function();
+        run.elapsed = millis() - start;
+        run.finished = true;
+        return run;
+    }
+
+    if (child == 0) {
+        close(channel[0]);
+        test_results_t results = function();
+        ssize_t written = write(channel[1], &results, sizeof(results));
+        _exit(written == (ssize_t)sizeof(results) ? 0 : 1);
+    }
+
+    close(channel[1]);
+    struct pollfd waiting = { channel[0], POLLIN, 0 };
+    if (poll(&waiting, 1, (int)TEST_TIMEOUT_MS) > 0 &&
+        read(channel[0], &run.results, sizeof(run.results)) == (ssize_t)sizeof(run.results))
+        run.finished = true;
+    else
+        kill(child, SIGKILL);
+    waitpid(child, NULL, 0);
+    close(channel[0]);
+
+    run.elapsed = millis() - start;
+    return run;
+}
+
+test_results_t RunTests(const test_case_t *tests, size_t count, const char *filter) {
+    test_summary_t summary = { {0, 0, 0}, 0, 0, 0 };
+
+    for (size_t i = 0; i < count; i++) {
+        if (!TestSelected(tests[i].name, filter))
+            continue;
+        TestReport(tests[i].name, TestRunIsolated(tests[i].function), &summary);
+    }
+
+    TestSummary(&summary);
+    return summary.points;
+}
+
+#endif // __AVR__
\ No newline at end of file
@@ -0,0 +1,57 @@
+/**
+ ********************************************************************************
+ * @file    test_runner.hpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Table-Driven Unit Test Runner
+ * @version 1.0
+ * @date    2024-03-18
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#ifndef __TEST_RUNNER_HPP__
+#define __TEST_RUNNER_HPP__
+
+#include <stddef.h>
+
+#include "test_utilities.hpp"
+
+/**
+ ********************************************************************************
+ * @brief   Milliseconds a test may run on the host before it is stopped
+ ********************************************************************************
+**/
+#ifndef TEST_TIMEOUT_MS
+  #define TEST_TIMEOUT_MS 60000UL
+#endif // TEST_TIMEOUT_MS
+
+typedef struct __test_case {
+    const char *name;
+    test_function_t function;
+} test_case_t;
+
+#define TEST_CASE(function) { #function, function }
+
+/**
+ ********************************************************************************
+ * @brief   Run the tests of a table and report their results
+ ********************************************************************************
+ * @param[in]     tests   TYPE: const test_case_t *
+ * @param[in]     count   TYPE: size_t
+ * @param[in]     filter  TYPE: const char *, comma separated name prefixes,
+ *                        NULL or empty to run every test
+ ********************************************************************************
+ * @return  test_results_t, the test points of every test run
+ ********************************************************************************
+ * @note    Each test starts from a fresh kernel. On the board the runner keeps
+ *          its progress in .noinit memory and resets the MCU through the
+ *          watchdog after each test, so setup() must call RunTests before
+ *          anything else. A test that resets the board is counted as failed.
+ *          On the host each test runs in its own process and is stopped
+ *          after TEST_TIMEOUT_MS.
+ ********************************************************************************
+**/
+test_results_t RunTests(const test_case_t *tests, size_t count, const char *filter);
+
+#endif // __TEST_RUNNER_HPP__
\ No newline at end of file
@@ -17,16 +17,75 @@
 #include <string.h>
 #include <ctype.h>
 
+#if defined(__AVR__)
+  #include <avr/pgmspace.h>
+#endif // __AVR__
+
+#include "test_log.hpp"
+
+// Report text of the utilities themselves stays in flash on the AVR, and is
+// left to the host expander altogether in the compact log
+#if (TEST_LOG_COMPACT == 1)
+  #define PrintFlash(fmt, ...) do {} while (0)
+  #define report_text(str) do {} while (0)
+#elif defined(__AVR__)
+  #define PrintFlash(fmt, ...) __PrintFlash(PSTR(fmt), ##__VA_ARGS__)
+  #define report_text(str) verify_output(F(str))
+#else
+  #define PrintFlash(fmt, ...) Print(fmt, ##__VA_ARGS__)
+  #define report_text(str) verify_output(str)
+#endif // TEST_LOG_COMPACT
+
+// Tables of report text, read by PrintFlash with FLASH_STRING on the AVR
+#if defined(__AVR__)
+  #define FLASH_TABLE PROGMEM
+  #define FLASH_STRING "%S"
+#else
+  #define FLASH_TABLE
+  #define FLASH_STRING "%s"
+#endif // __AVR__
+
 void PrintLine();
 void BlockPrint(const char *content);
 inline void PrintPass(int testNumber);
 inline void PrintFail(int testNumber, int lineNumber, const char *fileName);
 
+#if (TEST_LOG_COMPACT == 0) && defined(__AVR__)
+static void __PrintFlash(const char *fmt, ...) {
+    va_list args;
+    va_list length_args;
+    va_start(args, fmt);
+    va_copy(length_args, args);
+    char temp[1];
+    unsigned const int contentLength = vsnprintf_P(temp, 0, fmt, length_args) + 1;
+    va_end(length_args);
+    char content[contentLength + 1];
+    vsnprintf_P(content, contentLength, fmt, args);
+    va_end(args);
+
+    if (strlen(content) <= MAX_LINE_LENGTH) {
+        verify_output(content);
+        verify_output('\n');
+    }
+    else {
+        BlockPrint(content);
+    }
+}
+#endif // TEST_LOG_COMPACT
+
 void Banner(const char* fmt, ...) {
     va_list args;
     va_start(args, fmt);
+#if (TEST_LOG_COMPACT == 1)
+    TestLogPrint(TEST_LOG_BANNER, fmt, args);
+    va_end(args);
+#else
+    // The length is measured on a copy, as a va_list cannot be walked twice
+    va_list length_args;
+    va_copy(length_args, args);
     char temp[1];
-    unsigned const int contentLength = vsnprintf(temp, 0, fmt, args) + 1;
+    unsigned const int contentLength = vsnprintf(temp, 0, fmt, length_args) + 1;
+    va_end(length_args);
     char content[contentLength + 1];
     vsnprintf(content, contentLength, fmt, args);
     va_end(args);
@@ -52,13 +111,22 @@ void Banner(const char* fmt, ...) {
     }
 
     PrintLine();
+#endif // TEST_LOG_COMPACT
 }
 
 void Print(const char* fmt, ...) {
     va_list args;
     va_start(args, fmt);
+#if (TEST_LOG_COMPACT == 1)
+    TestLogPrint(TEST_LOG_PRINT, fmt, args);
+    va_end(args);
+#else
+    // The length is measured on a copy, as a va_list cannot be walked twice
+    va_list length_args;
+    va_copy(length_args, args);
     char temp[1];
-    unsigned const int contentLength = vsnprintf(temp, 0, fmt, args) + 1;
+    unsigned const int contentLength = vsnprintf(temp, 0, fmt, length_args) + 1;
+    va_end(length_args);
     char content[contentLength + 1];
     vsnprintf(content, contentLength, fmt, args);
     va_end(args);
@@ -70,6 +138,7 @@ void Print(const char* fmt, ...) {
     else {
         BlockPrint(content);
     }
+#endif // TEST_LOG_COMPACT
 }
 
 void __TestPreamble(const char *testName, 
@@ -78,490 +147,165 @@ void __TestPreamble(const char *testName,
                     string_array_t testForLoopSets, 
                     string_array_t testPreconditionsList,
                     string_array_t testResultsList) {
+#if (TEST_LOG_COMPACT == 1)
+    TestLogPreamble(testName, testFile, testDescription, testForLoopSets, testPreconditionsList, testResultsList);
+#else
     PrintLine();
-    verify_output("\n");
+    report_text("\n");
 
-    Print("\tTest Name: %s", testName);
-    Print("\tFile: %s", testFile);
-    verify_output("\n");
+    PrintFlash("\tTest Name: %s", testName);
+    PrintFlash("\tFile: %s", testFile);
+    report_text("\n");
     
-    verify_output("\tFUNCTIONAL DESCRIPTION:\n");
-    Print("%s", testDescription);
-    verify_output("\n");
+    report_text("\tFUNCTIONAL DESCRIPTION:\n");
+    PrintFlash("%s", testDescription);
+    report_text("\n");
 
-    verify_output("\tCONDITIONS:\n");
+    report_text("\tCONDITIONS:\n");
     if (testForLoopSets.array != NULL) {
-        verify_output("\tFOR:\n");
+        report_text("\tFOR:\n");
         for (size_t i = 0; i < testForLoopSets.size; i++) {
-            Print("\t\t- %s", testForLoopSets.array[i]);
+            PrintFlash("\t\t- %s", testForLoopSets.array[i]);
         }
-        verify_output("\n");
+        report_text("\n");
     }
     if (testPreconditionsList.array != NULL) {
-        verify_output("\tWITH:\n");
+        report_text("\tWITH:\n");
         for (size_t i = 0; i < testPreconditionsList.size; i++) {
-            Print("\t\t- %s", testPreconditionsList.array[i]);
+            PrintFlash("\t\t- %s", testPreconditionsList.array[i]);
         }
-        verify_output("\n");
+        report_text("\n");
     }
     if (testResultsList.array != NULL) {
-        verify_output("\tExpected Results:\n");
+        report_text("\tExpected Results:\n");
         for (size_t i = 0; i < testResultsList.size; i++) {
-            Print("\t\t- %s", testResultsList.array[i]);
+            PrintFlash("\t\t- %s", testResultsList.array[i]);
         }
-        verify_output("\n");
+        report_text("\n");
     }
 
     PrintLine();
+#endif // TEST_LOG_COMPACT
 }
 
 void __TestPostamble(const char *testName, 
                      test_results_t results) {
+#if (TEST_LOG_COMPACT == 1)
+    TestLogPostamble(testName, results);
+#else
     PrintLine();
-    verify_output("\n");
+    report_text("\n");
 
-    Print("Test Results for %s:", testName);
-    Print("\t%d Test Points\n", results.total);
+    PrintFlash("Test Results for %s:", testName);
+    PrintFlash("\t%d Test Points\n", results.total);
 
-    Print("\t%d Passed\n", results.passed);
-    Print("\t%d Failed\n", results.failed);
+    PrintFlash("\t%d Passed\n", results.passed);
+    PrintFlash("\t%d Failed\n", results.failed);
 
     PrintLine();
+#endif // TEST_LOG_COMPACT
 }
 
-void __Verify(const char *testFile,
-              const int lineNumber,
-              const char *valueName,
-              int expected,
-              int actual,
-              test_results_t *results,
-              verification_type_t type,
-              double percent,
-              int margin) {
-    results->total++;
-    bool passed = false;
-    verify_output("\n");
+bool __VerifyCompare(verification_type_t type,
+                     const char *expected,
+                     const char *actual,
+                     double,
+                     const char *) {
     switch (type) {
-        case EQUAL:
-            Print("Verifying %s is equal to %d...\n", valueName, expected);
-            if (expected == actual) {
-                Print("The expected value of ==%d has been verified.", expected);
-                results->passed++;
-                passed = true;
-            }
-            else {
-                Print("The expected value of ==%d has not been verified.", expected);
-                Print("The actual value was %d.", actual);
-                results->failed++;
-            }
-            break;
-        case NOT_EQUAL:
-            Print("Verifying %s is not equal to %d...\n", valueName, expected);
-            if (expected != actual) {
-                Print("The expected value of !=%d has been verified.", expected);
-                results->passed++;
-                passed = true;
-            }
-            else {
-                Print("The expected value of !=%d has not been verified.", expected);
-                Print("The actual value was %d.", actual);
-                results->failed++;
-            }
-            break;
-        case GREATER_THAN:
-            Print("Verifying %s is greater than %d...\n", valueName, expected);
-            if (actual > expected) {
-                Print("The expected value of >%d has been verified.", expected);
-                results->passed++;
-                passed = true;
-            }
-            else {
-                Print("The expected value of >%d has not been verified.", expected);
-                Print("The actual value was %d.", actual);
-                results->failed++;
-            }
-            break;
-        case GREATER_THAN_OR_EQUAL:
-            Print("Verifying %s is greater than or equal to %d...\n", valueName, expected);
-            if (actual >= expected) {
-                Print("The expected value of >=%d has been verified.", expected);
-                results->passed++;
-                passed = true;
-            }
-            else {
-                Print("The expected value of >=%d has not been verified.", expected);
-                Print("The actual value was %d.", actual);
-                results->failed++;
-            }
-            break;
-        case LESS_THAN:
-            Print("Verifying %s is less than %d...\n", valueName, expected);
-            if (actual < expected) {
-                Print("The expected value of <%d has been verified.", expected);
-                results->passed++;
-                passed = true;
-            }
-            else {
-                Print("The expected value of <%d has not been verified.", expected);
-                Print("The actual value was %d.", actual);
-                results->failed++;
-            }
-            break;
-        case LESS_THAN_OR_EQUAL:
-            Print("Verifying %s is less than or equal to %d...\n", valueName, expected);
-            if (actual <= expected) {
-                Print("The expected value of <=%d has been verified.", expected);
-                results->passed++;
-                passed = true;
-            }
-            else {
-                Print("The expected value of <=%d has not been verified.", expected);
-                Print("The actual value was %d.", actual);
-                results->failed++;
-            }
-            break;
-        case WITHIN_PERCENT:
-            Print("Verifying %s is within %.2lf%% of %d...\n", valueName, percent * 100, expected);
-            if (actual >= expected * (1 - percent) && actual <= expected * (1 + percent)) {
-                Print("The expected value of %d +/- %.2lf has been verified.", expected, percent * 100);
-                results->passed++;
-                passed = true;
-            }
-            else {
-                Print("The expected value of %d +/- %.2lf has not been verified.", expected, percent * 100);
-                Print("The actual value was %d.", actual);
-                results->failed++;
-            }
-            break;
-        case WITHIN_MARGIN:
-            Print("Verifying %s is within %d of %d...\n", valueName, margin, expected);
-            if (actual >= expected - margin && actual <= expected + margin) {
-                Print("The expected value of %d +/- %d has been verified.", expected, margin);
-                results->passed++;
-                passed = true;
-            }
-            else {
-                Print("The expected value of %d +/- %d has not been verified.", expected, margin);
-                Print("The actual value was %d.", actual);
-                results->failed++;
-            }
-            break;
-        default:
-            Print("Invalid verification type.");
-            results->failed++;
-            break;
+        case EQUAL: return strcmp(expected, actual) == 0;
+        case NOT_EQUAL: return strcmp(expected, actual) != 0;
+        default: return false;
     }
-
-    if (passed) PrintPass(results->total);
-    else PrintFail(results->total, lineNumber, testFile);
-
-    verify_output("\n");
 }
 
-void __Verify(const char *testFile,
-              const int lineNumber,
-              const char *valueName,
-              unsigned long expected,
-              unsigned long actual,
-              test_results_t *results,
-              verification_type_t type,
-              double percent,
-              unsigned long margin) {
-    results->total++;
-    bool passed = false;
-    verify_output("\n");
-    switch (type) {
-        case EQUAL:
-            Print("Verifying %s is equal to %lu...\n", valueName, expected);
-            if (expected == actual) {
-                Print("The expected value of ==%lu has been verified.", expected);
-                results->passed++;
-                passed = true;
-            }
-            else {
-                Print("The expected value of ==%lu has not been verified.", expected);
-                Print("The actual value was %lu.", actual);
-                results->failed++;
-            }
-            break;
-        case NOT_EQUAL:
-            Print("Verifying %s is not equal to %lu...\n", valueName, expected);
-            if (expected != actual) {
-                Print("The expected value of !=%lu has been verified.", expected);
-                results->passed++;
-                passed = true;
-            }
-            else {
-                Print("The expected value of !=%lu has not been verified.", expected);
-                Print("The actual value was %lu.", actual);
-                results->failed++;
-            }
-            break;
-        case GREATER_THAN:
-            Print("Verifying %s is greater than %lu...\n", valueName, expected);
-            if (actual > expected) {
-                Print("The expected value of >%lu has been verified.", expected);
-                results->passed++;
-                passed = true;
-            }
-            else {
-                Print("The expected value of >%lu has not been verified.", expected);
-                Print("The actual value was %lu.", actual);
-                results->failed++;
-            }
-            break;
-        case GREATER_THAN_OR_EQUAL:
-            Print("Verifying %s is greater than or equal to %lu...\n", valueName, expected);
-            if (actual >= expected) {
-                Print("The expected value of >=%lu has been verified.", expected);
-                results->passed++;
-                passed = true;
-            }
-            else {
-                Print("The expected value of >=%lu has not been verified.", expected);
-                Print("The actual value was %lu.", actual);
-                results->failed++;
-            }
-            break;
-        case LESS_THAN:
-            Print("Verifying %s is less than %lu...\n", valueName, expected);
-            if (actual < expected) {
-                Print("The expected value of <%lu has been verified.", expected);
-                results->passed++;
-                passed = true;
-            }
-            else {
-                Print("The expected value of <%lu has not been verified.", expected);
-                Print("The actual value was %lu.", actual);
-                results->failed++;
-            }
-            break;
-        case LESS_THAN_OR_EQUAL:
-            Print("Verifying %s is less than or equal to %lu...\n", valueName, expected);
-            if (actual <= expected) {
-                Print("The expected value of <=%lu has been verified.", expected);
-                results->passed++;
-                passed = true;
-            }
-            else {
-                Print("The expected value of <=%lu has not been verified.", expected);
-                Print("The actual value was %lu.", actual);
-                results->failed++;
-            }
-            break;
-        case WITHIN_PERCENT:
-            Print("Verifying %s is within %.2lf%% of %lu...\n", valueName, percent * 100, expected);
-            if (actual >= expected * (1 - percent) && actual <= expected * (1 + percent)) {
-                Print("The expected value of %lu +/- %.2lf has been verified.", expected, percent * 100);
-                results->passed++;
-                passed = true;
-            }
-            else {
-                Print("The expected value of %lu +/- %.2lf has not been verified.", expected, percent * 100);
-                Print("The actual value was %lu.", actual);
-                results->failed++;
-            }
-            break;
-        case WITHIN_MARGIN:
-            Print("Verifying %s is within %lu of %lu...\n", valueName, margin, expected);
-            if (actual >= expected - margin && actual <= expected + margin) {
-                Print("The expected value of %lu +/- %lu has been verified.", expected, margin);
-                results->passed++;
-                passed = true;
-            }
-            else {
-                Print("The expected value of %lu +/- %lu has not been verified.", expected, margin);
-                Print("The actual value was %lu.", actual);
-                results->failed++;
-            }
-            break;
-        default:
-            Print("Invalid verification type.");
-            results->failed++;
-            break;
+#if (TEST_LOG_COMPACT == 0)
+// Words and symbols of the comparisons, indexed by verification_type_t
+static const char verify_words[LESS_THAN_OR_EQUAL + 1][25] FLASH_TABLE = {
+    "equal to", "not equal to", "greater than",
+    "greater than or equal to", "less than", "less than or equal to"
+};
+static const char verify_symbols[LESS_THAN_OR_EQUAL + 1][3] FLASH_TABLE = {
+    "==", "!=", ">", ">=", "<", "<="
+};
+static const char verify_verdicts[2][23] FLASH_TABLE = {
+    "has not been verified.", "has been verified."
+};
+
+static const char *VerifyText(char *buffer, size_t size, verify_kind_t kind, verify_value_t value) {
+    switch (kind) {
+        case VERIFY_INT: snprintf(buffer, size, "%ld", value.integer); break;
+        case VERIFY_UNSIGNED: snprintf(buffer, size, "%lu", value.natural); break;
+        case VERIFY_DOUBLE: snprintf(buffer, size, "%.2f", value.real); break;
+        default: return value.text;
     }
-
-    if (passed) PrintPass(results->total);
-    else PrintFail(results->total, lineNumber, testFile);
-
-    verify_output("\n");
+    return buffer;
 }
-
-void __Verify(const char *testFile,
-              const int lineNumber,
-              const char *valueName,
-              double expected,
-              double actual,
-              test_results_t *results,
-              verification_type_t type,
-              double percent,
-              double margin) {
+#endif // TEST_LOG_COMPACT
+
+void __VerifyReport(const char *testFile,
+                    const int lineNumber,
+                    const char *valueName,
+                    verification_type_t type,
+                    verify_kind_t kind,
+                    bool passed,
+                    verify_value_t expected,
+                    verify_value_t actual,
+                    verify_value_t parameter,
+                    test_results_t *results) {
     results->total++;
-    bool passed = false;
-    switch (type) {
-        case EQUAL:
-            Print("Verifying %s is equal to %.2lf...\n", valueName, expected);
-            if (expected == actual) {
-                Print("The expected value of ==%.2lf has been verified.", expected);
-                passed = true;
-            }
-            else {
-                Print("The expected value of ==%.2lf has not been verified.", expected);
-                Print("The actual value was %.2lf.", actual);
-            }
-            break;
-        case NOT_EQUAL:
-            Print("Verifying %s is not equal to %.2lf...\n", valueName, expected);
-            if (expected != actual) {
-                Print("The expected value of !=%.2lf has been verified.", expected);
-                passed = true;
-            }
-            else {
-                Print("The expected value of !=%.2lf has not been verified.", expected);
-                Print("The actual value was %.2lf.", actual);
-            }
-            break;
-        case GREATER_THAN:
-            Print("Verifying %s is greater than %.2lf...\n", valueName, expected);
-            if (actual > expected) {
-                Print("The expected value of >%.2lf has been verified.", expected);
-                passed = true;
-            }
-            else {
-                Print("The expected value of >%.2lf has not been verified.", expected);
-                Print("The actual value was %.2lf.", actual);
-            }
-            break;
-        case GREATER_THAN_OR_EQUAL:
-            Print("Verifying %s is greater than or equal to %.2lf...\n", valueName, expected);
-            if (actual >= expected) {
-                Print("The expected value of >=%.2lf has been verified.", expected);
-                passed = true;
-            }
-            else {
-                Print("The expected value of >=%.2lf has not been verified.", expected);
-                Print("The actual value was %.2lf.", actual);
-            }
-            break;
-        case LESS_THAN:
-            Print("Verifying %s is less than %.2lf...\n", valueName, expected);
-            if (actual < expected) {
-                Print("The expected value of <%.2lf has been verified.", expected);
-                passed = true;
-            }
-            else {
-                Print("The expected value of <%.2lf has not been verified.", expected);
-                Print("The actual value was %.2lf.", actual);
-            }
-            break;
-        case LESS_THAN_OR_EQUAL:
-            Print("Verifying %s is less than or equal to %.2lf...\n", valueName, expected);
-            if (actual <= expected) {
-                Print("The expected value of <=%.2lf has been verified.", expected);
-                passed = true;
-            }
-            else {
-                Print("The expected value of <=%.2lf has not been verified.", expected);
-                Print("The actual value was %.2lf.", actual);
-            }
-            break;
-        case WITHIN_PERCENT:
-            Print("Verifying %s is within %.2lf%% of %.2lf...\n", valueName, percent * 100, expected);
-            if (actual >= expected * (1 - percent) && actual <= expected * (1 + percent)) {
-                Print("The expected value of %.2lf +/- %.2lf has been verified.", expected, percent * 100);
-                results->passed++;
-                passed = true;
-            }
-            else {
-                Print("The expected value of %.2lf +/- %.2lf has not been verified.", expected, percent * 100);
-                Print("The actual value was %.2lf.", actual);
-                results->failed++;
-            }
-            break;
-        case WITHIN_MARGIN:
-            Print("Verifying %s is within %.2lf of %.2lf...\n", valueName, margin, expected);
-            if (actual >= expected - margin && actual <= expected + margin) {
-                Print("The expected value of %.2lf +/- %.2lf has been verified.", expected, margin);
-                results->passed++;
-                passed = true;
-            }
-            else {
-                Print("The expected value of %.2lf +/- %.2lf has not been verified.", expected, margin);
-                Print("The actual value was %.2lf.", actual);
-                results->failed++;
-            }
-            break;
-        default:
-            Print("Invalid verification type.");
-            break;
+    if (passed) results->passed++;
+    else results->failed++;
+
+#if (TEST_LOG_COMPACT == 1)
+    TestLogVerify(testFile, lineNumber, valueName, type, kind, passed, results->total,
+                  expected, actual, parameter);
+#else
+    char expected_buffer[24];
+    char actual_buffer[24];
+    char margin_buffer[24];
+    const char *expected_text = VerifyText(expected_buffer, sizeof(expected_buffer), kind, expected);
+    const char *actual_text = VerifyText(actual_buffer, sizeof(actual_buffer), kind, actual);
+    const char *quote = (kind == VERIFY_TEXT) ? "\"" : "";
+    const bool valid = (kind == VERIFY_TEXT) ? (type == EQUAL || type == NOT_EQUAL) : (type <= WITHIN_MARGIN);
+
+    report_text("\n");
+    if (!valid) {
+        PrintFlash("Invalid verification type.");
     }
-
-    if (passed) {
-        PrintPass(results->total);
-        results->passed++;
+    else if (type == WITHIN_PERCENT) {
+        PrintFlash("Verifying %s is within %.2f%% of %s...\n", valueName, parameter.real * 100, expected_text);
+        PrintFlash("The expected value of %s +/- %.2f " FLASH_STRING, expected_text, parameter.real * 100,
+                   verify_verdicts[passed]);
     }
-    else {
-        PrintFail(results->total, lineNumber, testFile);
-        results->failed++;
-    }
-
-    verify_output("\n");
-}
-
-void __Verify(const char *testFile,
-              const int lineNumber,
-              const char *valueName,
-              const char *expected,
-              const char *actual,
-              test_results_t *results,
-              verification_type_t type) {
-    results->total++;
-    bool passed = false;
-    switch (type) {
-        case EQUAL:
-            Print("Verifying %s is equal to \"%s\"...\n", valueName, expected);
-            if (strcmp(expected, actual) == 0) {
-                Print("The expected value of ==\"%s\" has been verified.", expected);
-                passed = true;
-            }
-            else {
-                Print("The expected value of ==\"%s\" has not been verified.", expected);
-                Print("The actual value was %s.", actual);
-            }
-            break;
-        case NOT_EQUAL:
-            Print("Verifying %s is not equal to \"%s\"...\n", valueName, expected);
-            if (strcmp(expected, actual) != 0) {
-                Print("The expected value of !=%s has been verified.", expected);
-                passed = true;
-            }
-            else {
-                Print("The expected value of !=%s has not been verified.", expected);
-                Print("The actual value was %s.", actual);
-            }
-            break;
-        default:
-            Print("Invalid verification type.");
-            break;
-    }
-
-    if (passed) {
-        PrintPass(results->total);
-        results->passed++;
+    else if (type == WITHIN_MARGIN) {
+        const char *margin_text = VerifyText(margin_buffer, sizeof(margin_buffer), kind, parameter);
+        PrintFlash("Verifying %s is within %s of %s...\n", valueName, margin_text, expected_text);
+        PrintFlash("The expected value of %s +/- %s " FLASH_STRING, expected_text, margin_text,
+                   verify_verdicts[passed]);
     }
     else {
-        PrintFail(results->total, lineNumber, testFile);
-        results->failed++;
+        PrintFlash("Verifying %s is " FLASH_STRING " %s%s%s...\n", valueName, verify_words[type],
+                   quote, expected_text, quote);
+        PrintFlash("The expected value of " FLASH_STRING "%s%s%s " FLASH_STRING, verify_symbols[type],
+                   quote, expected_text, quote, verify_verdicts[passed]);
     }
+    if (valid && !passed) PrintFlash("The actual value was %s.", actual_text);
 
-    verify_output("\n");
+    if (passed) PrintPass(results->total);
+    else PrintFail(results->total, lineNumber, testFile);
+    report_text("\n");
+#endif // TEST_LOG_COMPACT
 }
 
 void PrintLine() {
+#if (TEST_LOG_COMPACT == 1)
+    TestLogLine();
+#else
     for (uint8_t i = 0; i < MAX_LINE_LENGTH; i++) {
         verify_output('-');
     }
     verify_output('\n');
+#endif // TEST_LOG_COMPACT
 }
 
 void BlockPrint(const char *content) {
@@ -596,9 +340,9 @@ void BlockPrint(const char *content) {
 
 
 inline void PrintPass(int testNumber) {
-    Print("\t(X) Pass\t( ) Fail\t[%d]", testNumber);
+    PrintFlash("\t(X) Pass\t( ) Fail\t[%d]", testNumber);
 }
 
 inline void PrintFail(int testNumber, int lineNumber, const char *fileName) {
-    Print("\t( ) Pass\t(X) Fail\t[%d] [line %d in %s]", testNumber, lineNumber, fileName);
+    PrintFlash("\t( ) Pass\t(X) Fail\t[%d] [line %d in %s]", testNumber, lineNumber, fileName);
 }
\ No newline at end of file
@@ -16,6 +16,18 @@
 #include <Arduino.h>
 
 #define MAX_LINE_LENGTH 80
+
+/**
+ ********************************************************************************
+ * @brief   Send the test report as compact binary records, see test_log.hpp
+ ********************************************************************************
+ * @note    Expand a capture with tools/test_log_expand.py.
+ ********************************************************************************
+**/
+#ifndef TEST_LOG_COMPACT
+  #define TEST_LOG_COMPACT 0
+#endif // TEST_LOG_COMPACT
+
 typedef enum __verification_type {
     EQUAL,
     NOT_EQUAL,
@@ -52,43 +64,145 @@ void __TestPreamble(const char *testName,
 void __TestPostamble(const char *testName, 
                      test_results_t results);
 
-void __Verify(const char *testFile,
-              const int lineNumber,
-              const char *valueName,
-              int expected,
-              int actual,
-              test_results_t *results,
-              verification_type_t type,
-              double percent = 0,
-              int margin = 0);
-              
-void __Verify(const char *testFile,
-              const int lineNumber,
-              const char *valueName,
-              unsigned long expected,
-              unsigned long actual,
-              test_results_t *results,
-              verification_type_t type,
-              double percent = 0,
-              unsigned long margin = 0);
+typedef enum __verify_kind {
+    VERIFY_INT = 0,
+    VERIFY_UNSIGNED,
+    VERIFY_DOUBLE,
+    VERIFY_TEXT
+} verify_kind_t;
 
+typedef union __verify_value {
+    long integer;
+    unsigned long natural;
+    double real;
+    const char *text;
+} verify_value_t;
+
+/**
+ ********************************************************************************
+ * @brief   Count and report one verification, shared by every kind of value
+ ********************************************************************************
+ * @param[in]     parameter   TYPE: verify_value_t, the percent of a
+ *                            WITHIN_PERCENT check as a double, otherwise the
+ *                            margin as the kind of the values
+ ********************************************************************************
+**/
+void __VerifyReport(const char *testFile,
+                    const int lineNumber,
+                    const char *valueName,
+                    verification_type_t type,
+                    verify_kind_t kind,
+                    bool passed,
+                    verify_value_t expected,
+                    verify_value_t actual,
+                    verify_value_t parameter,
+                    test_results_t *results);
+
+bool __VerifyCompare(verification_type_t type,
+                     const char *expected,
+                     const char *actual,
+                     double percent,
+                     const char *margin);
+
+/**
+ ********************************************************************************
+ * @brief   Compare two values of one kind
+ ********************************************************************************
+ * @note    Instantiated once for each kind a test image verifies, so the
+ *          double comparisons only cost flash when a test compares doubles.
+ ********************************************************************************
+**/
+template <typename T>
+bool __VerifyCompare(verification_type_t type, T expected, T actual, double percent, T margin) {
+    switch (type) {
+        case EQUAL: return actual == expected;
+        case NOT_EQUAL: return actual != expected;
+        case GREATER_THAN: return actual > expected;
+        case GREATER_THAN_OR_EQUAL: return actual >= expected;
+        case LESS_THAN: return actual < expected;
+        case LESS_THAN_OR_EQUAL: return actual <= expected;
+        case WITHIN_PERCENT:
+            return (double)actual >= (double)expected * (1 - percent) &&
+                   (double)actual <= (double)expected * (1 + percent);
+        case WITHIN_MARGIN:
+            // Only the larger value is subtracted from, so unsigned values cannot wrap
+            return (actual >= expected) ? (actual - expected <= margin) : (expected - actual <= margin);
+        default: return false;
+    }
+}
+
+// Kind each argument type is verified as, enumerations and bools included.
+// Integers wider than long, such as uint64_t on the AVR, would be truncated
+// and must be cast or split by the test.
+template <typename T> struct __verify_type {
+    static_assert(sizeof(T) <= sizeof(long), "Verify would truncate this integer, cast it to unsigned long");
+    static constexpr verify_kind_t kind = VERIFY_INT;
+};
+template <> struct __verify_type<unsigned long> { static constexpr verify_kind_t kind = VERIFY_UNSIGNED; };
+template <> struct __verify_type<unsigned long long> {
+    static_assert(sizeof(unsigned long long) <= sizeof(unsigned long), "Verify would truncate this integer, cast it to unsigned long");
+    static constexpr verify_kind_t kind = VERIFY_UNSIGNED;
+};
+template <> struct __verify_type<float> { static constexpr verify_kind_t kind = VERIFY_DOUBLE; };
+template <> struct __verify_type<double> { static constexpr verify_kind_t kind = VERIFY_DOUBLE; };
+template <> struct __verify_type<char *> { static constexpr verify_kind_t kind = VERIFY_TEXT; };
+template <> struct __verify_type<const char *> { static constexpr verify_kind_t kind = VERIFY_TEXT; };
+
+// Storage of each kind, mixed arguments are widened to the later kind
+template <verify_kind_t kind> struct __verify_storage;
+template <> struct __verify_storage<VERIFY_INT> {
+    typedef long type;
+    template <typename T> static type Cast(T value) { return (type)value; }
+    static verify_value_t Pack(type value) { verify_value_t packed; packed.integer = value; return packed; }
+};
+template <> struct __verify_storage<VERIFY_UNSIGNED> {
+    typedef unsigned long type;
+    template <typename T> static type Cast(T value) { return (type)value; }
+    static verify_value_t Pack(type value) { verify_value_t packed; packed.natural = value; return packed; }
+};
+template <> struct __verify_storage<VERIFY_DOUBLE> {
+    typedef double type;
+    template <typename T> static type Cast(T value) { return (type)value; }
+    static verify_value_t Pack(type value) { verify_value_t packed; packed.real = value; return packed; }
+};
+template <> struct __verify_storage<VERIFY_TEXT> {
+    typedef const char *type;
+    static type Cast(const char *value) { return value; }
+    static type Cast(char *value) { return value; }
+    template <typename T> static type Cast(T) { return NULL; }
+    static verify_value_t Pack(type value) { verify_value_t packed; packed.text = value; return packed; }
+};
+
+constexpr verify_kind_t __VerifyKind(verify_kind_t a, verify_kind_t b) {
+    return (a > b) ? a : b;
+}
+
+template <typename E, typename A, typename M = int>
 void __Verify(const char *testFile,
               const int lineNumber,
               const char *valueName,
-              double expected,
-              double actual,
+              E expected,
+              A actual,
               test_results_t *results,
               verification_type_t type,
               double percent = 0,
-              double margin = 0);
+              M margin = 0) {
+    static_assert((__verify_type<E>::kind == VERIFY_TEXT) == (__verify_type<A>::kind == VERIFY_TEXT),
+                  "Verify compares text only with text");
+    typedef __verify_storage<__VerifyKind(__verify_type<E>::kind, __verify_type<A>::kind)> value;
 
-void __Verify(const char *testFile,
-              const int lineNumber,
-              const char *valueName,
-              const char *expected,
-              const char *actual,
-              test_results_t *results,
-              verification_type_t type);
+    const typename value::type expected_value = value::Cast(expected);
+    const typename value::type actual_value = value::Cast(actual);
+    const typename value::type margin_value = value::Cast(margin);
+    verify_value_t parameter;
+    if (type == WITHIN_PERCENT) parameter.real = percent;
+    else parameter = value::Pack(margin_value);
+
+    __VerifyReport(testFile, lineNumber, valueName, type,
+                   __VerifyKind(__verify_type<E>::kind, __verify_type<A>::kind),
+                   __VerifyCompare(type, expected_value, actual_value, percent, margin_value),
+                   value::Pack(expected_value), value::Pack(actual_value), parameter, results);
+}
 
 void Banner(const char* fmt, ...)
         __attribute__((format(printf, 1, 2)));
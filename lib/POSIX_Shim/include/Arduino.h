@@ -0,0 +1,111 @@
+/**
+ ********************************************************************************
+ * @file    Arduino.h
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Arduino Core Shim for Host Builds
+ * @version 1.0
+ * @date    2024-03-18
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+ * @note    Only the parts of the Arduino core used by AVRduinOS are provided.
+ *          Serial writes to standard output.
+ ********************************************************************************
+**/
+
+#ifndef __POSIX_SHIM_ARDUINO_H__
+#define __POSIX_SHIM_ARDUINO_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef __cplusplus
+  extern "C" {
+#endif // __cplusplus
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+
+/**
+ ********************************************************************************
+ * @brief   Milliseconds since the program started
+ ********************************************************************************
+ * @return  unsigned long
+ ********************************************************************************
+**/
+unsigned long millis(void);
+
+/**
+ ********************************************************************************
+ * @brief   Microseconds since the program started
+ ********************************************************************************
+ * @return  unsigned long
+ ********************************************************************************
+**/
+unsigned long micros(void);
+
+/**
+ ********************************************************************************
+ * @brief   Busy wait, as the Arduino core does
+ ********************************************************************************
+ * @param[in]     ms      TYPE: unsigned long
+ ********************************************************************************
+**/
+void delay(unsigned long ms);
+
+/**
+ ********************************************************************************
+ * @brief   Busy wait for a number of microseconds
+ ********************************************************************************
+ * @param[in]     us      TYPE: unsigned int
+ ********************************************************************************
+**/
+void delayMicroseconds(unsigned int us);
+
+void setup(void);
+void loop(void);
+
+#ifdef __cplusplus
+  }
+
+class HardwareSerial {
+public:
+    void begin(unsigned long baud);
+    void end();
+    int available();
+    void flush();
+
+    size_t write(uint8_t c);
+    size_t write(const uint8_t *buffer, size_t size);
+    size_t write(const char *str);
+
+    size_t print(const char *str);
+    size_t print(char c);
+    size_t print(int number, int base = DEC);
+    size_t print(unsigned int number, int base = DEC);
+    size_t print(long number, int base = DEC);
+    size_t print(unsigned long number, int base = DEC);
+    size_t print(double number, int digits = 2);
+
+    template <typename T>
+    size_t println(T value) {
+        size_t count = print(value);
+        return count + print('\n');
+    }
+    size_t println() { return print('\n'); }
+
+    operator bool() { return true; }
+};
+
+extern HardwareSerial Serial;
+#endif // __cplusplus
+
+#endif // __POSIX_SHIM_ARDUINO_H__
\ No newline at end of file
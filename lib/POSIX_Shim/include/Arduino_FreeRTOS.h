@@ -0,0 +1,19 @@
+/**
+ ********************************************************************************
+ * @file    Arduino_FreeRTOS.h
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Arduino_FreeRTOS Shim over the FreeRTOS POSIX Port
+ * @version 1.0
+ * @date    2024-03-18
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#ifndef __POSIX_SHIM_ARDUINO_FREERTOS_H__
+#define __POSIX_SHIM_ARDUINO_FREERTOS_H__
+
+#include <FreeRTOS.h>
+#include <task.h>
+
+#endif // __POSIX_SHIM_ARDUINO_FREERTOS_H__
\ No newline at end of file
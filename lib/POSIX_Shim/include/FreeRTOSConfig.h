@@ -0,0 +1,99 @@
+/**
+ ********************************************************************************
+ * @file    FreeRTOSConfig.h
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   FreeRTOS Configuration for the POSIX Port
+ * @version 1.0
+ * @date    2024-03-18
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+ * @note    Mirrors the options of Arduino_FreeRTOS on the ATmega2560 where the
+ *          wrapper depends on them. The tick is 1 ms instead of the 15 ms
+ *          watchdog tick, and every thread runs on a pthread.
+ ********************************************************************************
+**/
+
+#ifndef FREERTOS_CONFIG_H
+#define FREERTOS_CONFIG_H
+
+#ifndef __ASSEMBLER__
+  #ifdef __cplusplus
+    extern "C" {
+  #endif // __cplusplus
+
+void vAssertCalled(const char *file, unsigned long line);
+
+  #ifdef __cplusplus
+    }
+  #endif // __cplusplus
+#endif // __ASSEMBLER__
+
+// Scheduler
+#define configUSE_PREEMPTION                    1
+#define configUSE_PORT_OPTIMISED_TASK_SELECTION 0
+#define configUSE_TICKLESS_IDLE                 0
+#define configTICK_RATE_HZ                      ((TickType_t)1000)
+#define configTICK_TYPE_WIDTH_IN_BITS           TICK_TYPE_WIDTH_32_BITS
+#define configMAX_PRIORITIES                    4
+#define configMAX_TASK_NAME_LEN                 8
+#define configIDLE_SHOULD_YIELD                 1
+#define configUSE_TIME_SLICING                  1
+
+// Stacks are in words of StackType_t, and a pthread needs at least 16 KiB
+#define configSTACK_DEPTH_TYPE                  uint16_t
+#define configMINIMAL_STACK_SIZE                ((configSTACK_DEPTH_TYPE)4096)
+#define configCHECK_FOR_STACK_OVERFLOW          0
+
+// Memory, heap_3 forwards to malloc as on the board
+#define configSUPPORT_STATIC_ALLOCATION         1
+#define configSUPPORT_DYNAMIC_ALLOCATION        1
+#define configKERNEL_PROVIDED_STATIC_MEMORY     1
+#define configTOTAL_HEAP_SIZE                   ((size_t)(256 * 1024))
+#define configUSE_MALLOC_FAILED_HOOK            0
+
+// Hooks, the idle hook runs loop() as Arduino_FreeRTOS does
+#define configUSE_IDLE_HOOK                     1
+#define configUSE_TICK_HOOK                     0
+#define configUSE_DAEMON_TASK_STARTUP_HOOK      0
+
+// Features
+#define configUSE_TASK_NOTIFICATIONS            1
+#define configTASK_NOTIFICATION_ARRAY_ENTRIES   1
+#define configUSE_MUTEXES                       1
+#define configUSE_RECURSIVE_MUTEXES             1
+#define configUSE_COUNTING_SEMAPHORES           1
+#define configQUEUE_REGISTRY_SIZE               0
+#define configUSE_QUEUE_SETS                    0
+#define configUSE_TRACE_FACILITY                0
+#define configGENERATE_RUN_TIME_STATS           0
+#define configUSE_STATS_FORMATTING_FUNCTIONS    0
+#define configUSE_CO_ROUTINES                   0
+
+// Software timers
+#define configUSE_TIMERS                        1
+#define configTIMER_TASK_PRIORITY               (configMAX_PRIORITIES - 1)
+#define configTIMER_QUEUE_LENGTH                10
+#define configTIMER_TASK_STACK_DEPTH            configMINIMAL_STACK_SIZE
+
+// Optional functions
+#define INCLUDE_vTaskPrioritySet                1
+#define INCLUDE_uxTaskPriorityGet               1
+#define INCLUDE_vTaskDelete                     1
+#define INCLUDE_vTaskSuspend                    1
+#define INCLUDE_xTaskDelayUntil                 1
+#define INCLUDE_vTaskDelay                      1
+#define INCLUDE_xTaskGetSchedulerState          1
+#define INCLUDE_xTaskGetCurrentTaskHandle       1
+#define INCLUDE_xTaskGetIdleTaskHandle          1
+#define INCLUDE_uxTaskGetStackHighWaterMark     1
+#define INCLUDE_xTaskGetHandle                  1
+#define INCLUDE_eTaskGetState                   1
+#define INCLUDE_xTaskAbortDelay                 1
+#define INCLUDE_xTimerPendFunctionCall          1
+
+#define configASSERT(x) if ((x) == 0) vAssertCalled(__FILE__, __LINE__)
+
+#include "FreeRTOS_Wrapper_Hooks.h"
+
+#endif // FREERTOS_CONFIG_H
\ No newline at end of file
@@ -0,0 +1,131 @@
+/**
+ ********************************************************************************
+ * @file    Arduino.cpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Arduino Core Shim for Host Builds
+ * @version 1.0
+ * @date    2024-03-18
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#include "Arduino.h"
+
+#include <errno.h>
+#include <stdio.h>
+#include <time.h>
+#include <unistd.h>
+
+HardwareSerial Serial;
+
+static uint64_t ShimClockMicros() {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000ULL + (uint64_t)now.tv_nsec / 1000ULL;
+}
+
+// Both clocks count from program start and wrap like the Arduino core
+static const uint64_t shim_start_micros = ShimClockMicros();
+
+unsigned long millis(void) {
+    return (unsigned long)(uint32_t)((ShimClockMicros() - shim_start_micros) / 1000ULL);
+}
+
+unsigned long micros(void) {
+    return (unsigned long)(uint32_t)(ShimClockMicros() - shim_start_micros);
+}
+
+void delay(unsigned long ms) {
+    unsigned long start = millis();
+    while ((uint32_t)(millis() - start) < ms) continue;
+}
+
+void delayMicroseconds(unsigned int us) {
+    unsigned long start = micros();
+    while ((uint32_t)(micros() - start) < us) continue;
+}
+
+void HardwareSerial::begin(unsigned long baud __attribute__((unused))) {}
+
+void HardwareSerial::end() {}
+
+int HardwareSerial::available() {
+    return 0;
+}
+
+void HardwareSerial::flush() {}
+
+size_t HardwareSerial::write(uint8_t c) {
+    return write(&c, 1);
+}
+
+size_t HardwareSerial::write(const uint8_t *buffer, size_t size) {
+    // The POSIX port interrupts threads with signals, so retry interrupted writes
+    size_t written = 0;
+    while (written < size) {
+        ssize_t count = ::write(STDOUT_FILENO, buffer + written, size - written);
+        if (count < 0 && errno == EINTR)
+            continue;
+        if (count <= 0)
+            break;
+        written += (size_t)count;
+    }
+    return written;
+}
+
+size_t HardwareSerial::write(const char *str) {
+    return (str != NULL) ? write((const uint8_t *)str, strlen(str)) : 0;
+}
+
+size_t HardwareSerial::print(const char *str) {
+    return write(str);
+}
+
+size_t HardwareSerial::print(char c) {
+    return write((uint8_t)c);
+}
+
+size_t HardwareSerial::print(int number, int base) {
+    return print((long)number, base);
+}
+
+size_t HardwareSerial::print(unsigned int number, int base) {
+    return print((unsigned long)number, base);
+}
+
+size_t HardwareSerial::print(long number, int base) {
+    if (number < 0 && base == DEC)
+        return print('-') + print((unsigned long)0 - (unsigned long)number, base);
+    return print((unsigned long)number, base);
+}
+
+size_t HardwareSerial::print(unsigned long number, int base) {
+    if (base < 2)
+        base = DEC;
+
+    char buffer[8 * sizeof(unsigned long) + 1];
+    char *digit = &buffer[sizeof(buffer) - 1];
+    *digit = '\0';
+    do {
+        unsigned long remainder = number % base;
+        number /= base;
+        *--digit = (char)((remainder < 10) ? '0' + remainder : 'A' + remainder - 10);
+    } while (number != 0);
+    return write(digit);
+}
+
+size_t HardwareSerial::print(double number, int digits) {
+    char buffer[64];
+    snprintf(buffer, sizeof(buffer), "%.*f", digits, number);
+    return write(buffer);
+}
+
+extern "C" void vAssertCalled(const char *file, unsigned long line) {
+    fprintf(stderr, "configASSERT failed at %s:%lu\n", file, line);
+    abort();
+}
+
+extern "C" void vApplicationIdleHook(void) {
+    loop();
+}
\ No newline at end of file
@@ -0,0 +1,22 @@
+/**
+ ********************************************************************************
+ * @file    main.cpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Program Entry for Host Builds
+ * @version 1.0
+ * @date    2024-03-18
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#include "Arduino.h"
+
+int main() {
+    // Unlike Arduino_FreeRTOS, the scheduler is not started after setup(), so a
+    // test run ends once setup() returns. Each test starts its own scheduler.
+    setup();
+
+    Serial.flush();
+    return 0;
+}
\ No newline at end of file
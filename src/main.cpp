@@ -1,27 +1,50 @@
+#include <stdlib.h>
+
 #include <Arduino.h>
 #include <Arduino_FreeRTOS.h>
 
 #include "FreeRTOS_Wrapper_Test.hpp"
+#include "FreeRTOS_Wrapper_Benchmark.hpp"
+
+#if defined(AVRDUINOS_SIMAVR)
+  #include <avr/sleep.h>
+#endif // AVRDUINOS_SIMAVR
+
+// Comma separated name prefixes of the tests to run, such as "SDD_025,SDD_03"
+#ifndef TEST_FILTER
+  #define TEST_FILTER ""
+#endif // TEST_FILTER
 
 void setup() {
   // put your setup code here, to run once:
   Serial.begin(115200);
   while (!Serial && millis() < 5000) continue;
 
-  // SDD_005_010();
-  // SDD_006_010();
-  // SDD_007_010();
-  // SDD_008_010();
-  // SDD_009_010();
-  // SDD_011();
-  // SDD_013_017();
-  // SDD_014_017();
-  // SDD_015_017();
-  // SDD_018();
-  // SDD_020();
-  // SDD_021();
-  // SDD_022();  
-  SDD_025();
+#if defined(AVRDUINOS_BENCHMARK)
+  RunBenchmarks();
+  #if defined(AVRDUINOS_SIMAVR)
+    // simavr exits once the CPU sleeps with interrupts disabled
+    Serial.flush();
+    set_sleep_mode(SLEEP_MODE_PWR_DOWN);
+    sleep_enable();
+    cli();
+    sleep_cpu();
+  #endif // AVRDUINOS_SIMAVR
+  return;
+#endif // AVRDUINOS_BENCHMARK
+
+  const char *filter = TEST_FILTER;
+#if !defined(__AVR__)
+  if (getenv("TEST_FILTER") != NULL)
+    filter = getenv("TEST_FILTER");
+#endif // __AVR__
+
+  test_results_t results = RunTests(FreeRTOS_Wrapper_Tests, FreeRTOS_Wrapper_Test_Count, filter);
+#if !defined(__AVR__)
+  exit((results.failed == 0) ? 0 : 1);
+#else
+  (void)results;
+#endif // __AVR__
 }
 
 void loop() {
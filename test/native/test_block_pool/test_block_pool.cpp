@@ -0,0 +1,149 @@
+/**
+ ********************************************************************************
+ * @file    test_block_pool.cpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Host Unit Tests for the Fixed-Block Memory Pool
+ * @version 1.0
+ * @date    2024-03-18
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <unity.h>
+
+#include "BlockPool.hpp"
+
+#define STRESS_ROUNDS 200000UL
+
+void setUp() {}
+void tearDown() {}
+
+void test_block_pool_hands_out_every_block_once() {
+    static BlockPool<24, 8> pool;
+    void *blocks[8];
+
+    for (int i = 0; i < 8; i++) {
+        blocks[i] = pool.Allocate();
+        TEST_ASSERT_NOT_NULL(blocks[i]);
+        TEST_ASSERT_TRUE(pool.Owns(blocks[i]));
+        for (int j = 0; j < i; j++) {
+            TEST_ASSERT_TRUE(blocks[i] != blocks[j]);
+        }
+        // The whole block is usable, including the free-list link
+        memset(blocks[i], 0xA5, 24);
+    }
+    TEST_ASSERT_EQUAL_UINT(8, pool.Used());
+    TEST_ASSERT_EQUAL_UINT(0, pool.Available());
+    TEST_ASSERT_NULL(pool.Allocate());
+    TEST_ASSERT_EQUAL_UINT(1, pool.Failures());
+
+    for (int i = 0; i < 8; i++) {
+        TEST_ASSERT_TRUE(pool.Free(blocks[i]));
+    }
+    TEST_ASSERT_EQUAL_UINT(0, pool.Used());
+    TEST_ASSERT_EQUAL_UINT(8, pool.Peak());
+}
+
+void test_block_pool_reuses_freed_block() {
+    static BlockPool<16, 4> pool;
+
+    void *first = pool.Allocate();
+    TEST_ASSERT_TRUE(pool.Free(first));
+    TEST_ASSERT_EQUAL_PTR(first, pool.Allocate());
+    TEST_ASSERT_EQUAL_UINT(1, pool.Used());
+    TEST_ASSERT_EQUAL_UINT(1, pool.Peak());
+}
+
+void test_block_pool_rejects_foreign_memory() {
+    static BlockPool<16, 4> pool;
+    static uint8_t foreign[16];
+
+    uint8_t *block = (uint8_t *)pool.Allocate();
+    TEST_ASSERT_FALSE(pool.Free(foreign));
+    TEST_ASSERT_FALSE(pool.Free(block + 1));
+    TEST_ASSERT_FALSE(pool.Free(NULL));
+    TEST_ASSERT_EQUAL_UINT(1, pool.Used());
+}
+
+void test_block_pool_rejects_double_free() {
+    static BlockPool<16, 4> pool;
+
+    void *first = pool.Allocate();
+    TEST_ASSERT_NOT_NULL(pool.Allocate());
+    TEST_ASSERT_TRUE(pool.Free(first));
+    TEST_ASSERT_FALSE(pool.Free(first));
+    TEST_ASSERT_EQUAL_UINT(1, pool.Used());
+
+    // The free list still holds each block once
+    TEST_ASSERT_EQUAL_PTR(first, pool.Allocate());
+    TEST_ASSERT_NOT_NULL(pool.Allocate());
+    TEST_ASSERT_NOT_NULL(pool.Allocate());
+    TEST_ASSERT_NULL(pool.Allocate());
+    TEST_ASSERT_EQUAL_UINT(4, pool.Used());
+}
+
+void test_block_pool_aligns_blocks() {
+    static BlockPool<3, 4> pool;
+
+    for (int i = 0; i < 4; i++) {
+        uintptr_t address = (uintptr_t)pool.Allocate();
+        TEST_ASSERT_EQUAL_UINT(0, address % alignof(void *));
+        TEST_ASSERT_EQUAL_UINT(0, address % alignof(long long));
+    }
+}
+
+static BlockPool<sizeof(uint32_t), 8> stress_pool;
+
+static void *stress_worker(void *id) {
+    uint32_t owner = (uint32_t)(uintptr_t)id;
+    uint32_t *held[3] = {NULL};
+
+    for (unsigned long round = 0; round < STRESS_ROUNDS; round++) {
+        uint32_t *&slot = held[round % 3];
+        if (slot != NULL) {
+            // Nobody else may have been given this block while it was held
+            if (*slot != owner) return (void *)1;
+            stress_pool.Free(slot);
+            slot = NULL;
+        }
+        slot = (uint32_t *)stress_pool.Allocate();
+        if (slot != NULL) *slot = owner;
+        if (round % 64 == 0) sched_yield();
+    }
+    for (uint32_t *block : held) {
+        if (block != NULL) stress_pool.Free(block);
+    }
+    return NULL;
+}
+
+void test_block_pool_two_thread_stress() {
+    pthread_t first, second;
+    void *first_result = NULL, *second_result = NULL;
+
+    TEST_ASSERT_EQUAL_INT(0, pthread_create(&first, NULL, stress_worker, (void *)1));
+    TEST_ASSERT_EQUAL_INT(0, pthread_create(&second, NULL, stress_worker, (void *)2));
+    pthread_join(first, &first_result);
+    pthread_join(second, &second_result);
+
+    TEST_ASSERT_NULL(first_result);
+    TEST_ASSERT_NULL(second_result);
+    TEST_ASSERT_EQUAL_UINT(0, stress_pool.Used());
+    TEST_ASSERT_LESS_OR_EQUAL(6, stress_pool.Peak());
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_block_pool_hands_out_every_block_once);
+    RUN_TEST(test_block_pool_reuses_freed_block);
+    RUN_TEST(test_block_pool_rejects_foreign_memory);
+    RUN_TEST(test_block_pool_rejects_double_free);
+    RUN_TEST(test_block_pool_aligns_blocks);
+    RUN_TEST(test_block_pool_two_thread_stress);
+    return UNITY_END();
+}
\ No newline at end of file
@@ -0,0 +1,138 @@
+/**
+ ********************************************************************************
+ * @file    test_ring_buffer.cpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Host Unit Tests for the SPSC Ring Buffer
+ * @version 1.0
+ * @date    2024-03-18
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdint.h>
+
+#include <atomic>
+
+#include <unity.h>
+
+#include "RingBuffer.hpp"
+
+#define STRESS_ITEMS 2000000UL
+
+void setUp() {}
+void tearDown() {}
+
+void test_ring_buffer_starts_empty() {
+    RingBuffer<uint16_t, 8> ring;
+    uint16_t item = 0;
+
+    TEST_ASSERT_TRUE(ring.Empty());
+    TEST_ASSERT_EQUAL_UINT8(0, ring.Count());
+    TEST_ASSERT_FALSE(ring.Pop(item));
+    TEST_ASSERT_FALSE(ring.Peek(item));
+}
+
+void test_ring_buffer_holds_capacity_items() {
+    RingBuffer<uint16_t, 8> ring;
+
+    for (uint16_t i = 0; i < 8; i++) {
+        TEST_ASSERT_TRUE(ring.Push(i));
+    }
+    TEST_ASSERT_TRUE(ring.Full());
+    TEST_ASSERT_EQUAL_UINT8(8, ring.Count());
+    TEST_ASSERT_FALSE(ring.Push(8));
+}
+
+void test_ring_buffer_is_fifo_across_wrap() {
+    RingBuffer<uint32_t, 4> ring;
+    uint32_t item = 0;
+
+    // Enough rounds for the single-byte indices to wrap several times
+    for (uint32_t i = 0; i < 1000; i++) {
+        TEST_ASSERT_TRUE(ring.Push(i));
+        TEST_ASSERT_TRUE(ring.Push(i + 1000000));
+        TEST_ASSERT_TRUE(ring.Peek(item));
+        TEST_ASSERT_EQUAL_UINT32(i, item);
+        TEST_ASSERT_TRUE(ring.Pop(item));
+        TEST_ASSERT_EQUAL_UINT32(i, item);
+        TEST_ASSERT_TRUE(ring.Pop(item));
+        TEST_ASSERT_EQUAL_UINT32(i + 1000000, item);
+    }
+    TEST_ASSERT_TRUE(ring.Empty());
+}
+
+void test_ring_buffer_supports_largest_capacity() {
+    RingBuffer<uint8_t, 128> ring;
+    uint8_t item = 0;
+
+    for (int round = 0; round < 4; round++) {
+        for (int i = 0; i < 128; i++) {
+            TEST_ASSERT_TRUE(ring.Push((uint8_t)i));
+        }
+        TEST_ASSERT_FALSE(ring.Push(0));
+        TEST_ASSERT_EQUAL_UINT8(128, ring.Count());
+        for (int i = 0; i < 128; i++) {
+            TEST_ASSERT_TRUE(ring.Pop(item));
+            TEST_ASSERT_EQUAL_UINT8(i, item);
+        }
+        TEST_ASSERT_TRUE(ring.Empty());
+    }
+}
+
+static RingBuffer<uint32_t, 16> stress_ring;
+
+// Set once the consumer is done, so a consumer that gave up on a mismatch
+// does not leave the producer spinning on a full ring
+static std::atomic<bool> stress_stop(false);
+
+static void *stress_producer(void *) {
+    for (uint32_t i = 0; i < STRESS_ITEMS && !stress_stop.load(); ) {
+        if (stress_ring.Push(i)) i++;
+        else sched_yield();
+    }
+    return NULL;
+}
+
+static void *stress_consumer(void *result) {
+    uint32_t expected = 0;
+    uint32_t item = 0;
+    while (expected < STRESS_ITEMS) {
+        if (!stress_ring.Pop(item)) {
+            sched_yield();
+            continue;
+        }
+        if (item != expected) break;
+        expected++;
+    }
+    *(uint32_t *)result = expected;
+    stress_stop.store(true);
+    return NULL;
+}
+
+void test_ring_buffer_two_thread_stress() {
+    uint32_t received = 0;
+    pthread_t producer, consumer;
+
+    stress_stop.store(false);
+    TEST_ASSERT_EQUAL_INT(0, pthread_create(&consumer, NULL, stress_consumer, &received));
+    TEST_ASSERT_EQUAL_INT(0, pthread_create(&producer, NULL, stress_producer, NULL));
+    pthread_join(producer, NULL);
+    pthread_join(consumer, NULL);
+
+    // Every item arrived exactly once and in order
+    TEST_ASSERT_EQUAL_UINT32(STRESS_ITEMS, received);
+    TEST_ASSERT_TRUE(stress_ring.Empty());
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_ring_buffer_starts_empty);
+    RUN_TEST(test_ring_buffer_holds_capacity_items);
+    RUN_TEST(test_ring_buffer_is_fifo_across_wrap);
+    RUN_TEST(test_ring_buffer_supports_largest_capacity);
+    RUN_TEST(test_ring_buffer_two_thread_stress);
+    return UNITY_END();
+}
\ No newline at end of file
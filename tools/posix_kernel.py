@@ -0,0 +1,32 @@
+"""
+PlatformIO pre-script for the posix env.
+
+The FreeRTOS-Kernel repository carries every port and an example with its own
+main(), so only the portable kernel sources, the GCC POSIX port and heap_3 are
+built. The POSIX port headers are added to the include path.
+"""
+
+import os
+
+Import("env")
+
+KERNEL = "FreeRTOS-Kernel"
+POSIX_PORT = "portable/ThirdParty/GCC/Posix"
+KEEP = (POSIX_PORT + "/", "portable/MemMang/heap_3.c")
+
+kernel_dir = os.path.join(env.subst("$PROJECT_LIBDEPS_DIR"), env.subst("$PIOENV"), KERNEL)
+env.Append(CPPPATH=[
+    os.path.join(kernel_dir, POSIX_PORT),
+    os.path.join(kernel_dir, POSIX_PORT, "utils"),
+])
+
+
+def keep_kernel_source(node):
+    path = node.get_path().replace(os.sep, "/")
+    relative = path.split("/" + KERNEL + "/", 1)[-1]
+    if "/" not in relative or relative.startswith(KEEP):
+        return node
+    return None
+
+
+env.AddBuildMiddleware(keep_kernel_source, "*/%s/*" % KERNEL)
@@ -0,0 +1,291 @@
+#!/usr/bin/env python3
+"""
+Expand the compact test log sent with TEST_LOG_COMPACT into the test report.
+
+The stream mixes plain text with frames:
+
+    0xA5, type, length, payload[length], checksum
+
+where the checksum is the 8-bit sum of type, length and payload. Frame types
+and payload layouts mirror test_log.hpp. Strings are sent once into a slot
+and later frames refer to the slot. Bytes outside frames are copied through.
+
+Usage:
+    test_log_expand.py capture.bin
+    test_log_expand.py --port /dev/ttyACM0 --baud 115200
+"""
+
+import argparse
+import re
+import struct
+import sys
+
+FRAME_SYNC = 0xA5
+MAX_LINE_LENGTH = 80
+
+# Mirrors the TEST_LOG_* record types in test_log.hpp
+STRING = 0x10
+STRING_MORE = 0x11
+PRINT = 0x12
+BANNER = 0x13
+LINE = 0x14
+PREAMBLE = 0x15
+CONDITION = 0x16
+PREAMBLE_END = 0x17
+POSTAMBLE = 0x18
+VERIFY = 0x19
+
+CONDITIONS = ("\tFOR:\n", "\tWITH:\n", "\tExpected Results:\n")
+
+# verification_type_t in test_utilities.hpp
+EQUAL, NOT_EQUAL, GREATER_THAN, GREATER_THAN_OR_EQUAL, LESS_THAN, LESS_THAN_OR_EQUAL, WITHIN_PERCENT, WITHIN_MARGIN = range(8)
+COMPARISONS = {
+    EQUAL: ("equal to", "=="),
+    NOT_EQUAL: ("not equal to", "!="),
+    GREATER_THAN: ("greater than", ">"),
+    GREATER_THAN_OR_EQUAL: ("greater than or equal to", ">="),
+    LESS_THAN: ("less than", "<"),
+    LESS_THAN_OR_EQUAL: ("less than or equal to", "<="),
+}
+
+# verify_kind_t in test_utilities.hpp
+INT, UNSIGNED, DOUBLE, TEXT = range(4)
+
+SPECIFIER = re.compile(r"%([-+ #0]*)(\*|\d+)?(?:\.(\*|\d*))?(hh|h|ll|l|L|j|z|t)?([diouxXeEfFgGaAcspn%])")
+
+
+def chunks(read):
+    """Yield ("text", bytes) for plain output and (type, payload) for frames."""
+    buffer = bytearray()
+    while True:
+        data = read(1)
+        if not data:
+            if buffer:
+                yield "text", bytes(buffer)
+            return
+        buffer += data
+
+        start = buffer.find(FRAME_SYNC)
+        if start < 0:
+            yield "text", bytes(buffer)
+            buffer.clear()
+            continue
+        if start > 0:
+            yield "text", bytes(buffer[:start])
+            del buffer[:start]
+        if len(buffer) < 3 or len(buffer) < 3 + buffer[2] + 1:
+            continue
+
+        kind, length = buffer[1], buffer[2]
+        payload, checksum = bytes(buffer[3:3 + length]), buffer[3 + length]
+        if (kind + length + sum(payload)) & 0xFF == checksum:
+            yield kind, payload
+            del buffer[:3 + length + 1]
+        else:
+            # Not a frame after all, so the sync byte was text
+            yield "text", bytes(buffer[:1])
+            del buffer[:1]
+
+
+class Report:
+    def __init__(self, out):
+        self.out = out
+        self.strings = {}
+        self.section = None
+
+    def write(self, text):
+        self.out.write(text)
+
+    def string(self, slot):
+        return self.strings.get(slot, "<string %d>" % slot)
+
+    def line(self):
+        self.write("-" * MAX_LINE_LENGTH + "\n")
+
+    def block(self, content):
+        while len(content) > MAX_LINE_LENGTH:
+            self.write(content[:MAX_LINE_LENGTH] + "\n")
+            content = content[MAX_LINE_LENGTH:]
+        self.write(content)
+
+    def print(self, content):
+        if len(content) <= MAX_LINE_LENGTH:
+            self.write(content + "\n")
+        else:
+            self.block(content)
+
+    def banner(self, content):
+        self.line()
+        if len(content) <= MAX_LINE_LENGTH:
+            padding = (MAX_LINE_LENGTH - len(content)) // 2
+            left = "-" * (padding - 2) + "  " if padding > 2 else " " * padding
+            self.write((left + content + left[::-1])[:MAX_LINE_LENGTH] + "\n")
+        else:
+            self.write("\n")
+            self.block(content)
+            self.write("\n")
+        self.line()
+
+    def format(self, payload):
+        """Rebuild the text of a Print or Banner record."""
+        fmt = self.string(payload[0])
+        words = [struct.unpack_from("<I", payload, offset)[0] for offset in range(1, len(payload) - 3, 4)]
+
+        def take():
+            return words.pop(0) if words else None
+
+        def expand(match):
+            flags, width, precision, _, conversion = match.groups()
+            if conversion == "%":
+                return "%"
+            if conversion == "n":
+                return ""
+            spec = "%" + flags
+            for part, prefix in ((width, ""), (precision, ".")):
+                if part is None:
+                    continue
+                if part == "*":
+                    value = take()
+                    part = "" if value is None else str(struct.unpack("<i", struct.pack("<I", value))[0])
+                spec += prefix + part
+            value = take()
+            if value is None:
+                return "?"
+            if conversion in "di":
+                return (spec + "d") % struct.unpack("<i", struct.pack("<I", value))[0]
+            if conversion == "u":
+                return (spec + "d") % value
+            if conversion in "oxX":
+                return (spec + conversion) % value
+            if conversion == "c":
+                return (spec + "c") % chr(value & 0xFF)
+            if conversion == "p":
+                return (spec + "s") % ("0x%x" % value)
+            if conversion == "s":
+                return (spec + "s") % self.string(value)
+            real = struct.unpack("<f", struct.pack("<I", value))[0]
+            return (spec + (conversion if conversion not in "aA" else "e")) % real
+
+        return SPECIFIER.sub(expand, fmt)
+
+    def value(self, kind, word):
+        if kind == INT:
+            return "%d" % struct.unpack("<i", struct.pack("<I", word))[0]
+        if kind == UNSIGNED:
+            return "%d" % word
+        if kind == DOUBLE:
+            return "%.2f" % struct.unpack("<f", struct.pack("<I", word))[0]
+        return self.string(word)
+
+    def verify(self, payload):
+        check, kind, passed, number, line, name, file = struct.unpack_from("<BBBHHBB", payload)
+        expected_word, actual_word, parameter_word = struct.unpack_from("<III", payload, 9)
+        name, file = self.string(name), self.string(file)
+        expected, actual = self.value(kind, expected_word), self.value(kind, actual_word)
+        verdict = "has been verified." if passed else "has not been verified."
+
+        self.write("\n")
+        if kind == TEXT and check in (EQUAL, NOT_EQUAL):
+            words, symbol = COMPARISONS[check]
+            self.print('Verifying %s is %s "%s"...\n' % (name, words, expected))
+            self.print('The expected value of %s"%s" %s' % (symbol, expected, verdict))
+        elif kind != TEXT and check in COMPARISONS:
+            words, symbol = COMPARISONS[check]
+            self.print("Verifying %s is %s %s...\n" % (name, words, expected))
+            self.print("The expected value of %s%s %s" % (symbol, expected, verdict))
+        elif kind != TEXT and check == WITHIN_PERCENT:
+            percent = "%.2f" % (struct.unpack("<f", struct.pack("<I", parameter_word))[0] * 100)
+            self.print("Verifying %s is within %s%% of %s...\n" % (name, percent, expected))
+            self.print("The expected value of %s +/- %s %s" % (expected, percent, verdict))
+        elif kind != TEXT and check == WITHIN_MARGIN:
+            margin = self.value(kind, parameter_word)
+            self.print("Verifying %s is within %s of %s...\n" % (name, margin, expected))
+            self.print("The expected value of %s +/- %s %s" % (expected, margin, verdict))
+        else:
+            self.print("Invalid verification type.")
+            passed = False
+        if not passed and (kind == TEXT and check in (EQUAL, NOT_EQUAL) or kind != TEXT and check <= WITHIN_MARGIN):
+            self.print("The actual value was %s." % actual)
+
+        if passed:
+            self.print("\t(X) Pass\t( ) Fail\t[%d]" % number)
+        else:
+            self.print("\t( ) Pass\t(X) Fail\t[%d] [line %d in %s]" % (number, line, file))
+        self.write("\n")
+
+    def frame(self, kind, payload):
+        if kind == STRING and payload:
+            self.strings[payload[0]] = payload[1:].decode("ascii", "replace")
+        elif kind == STRING_MORE and payload:
+            self.strings[payload[0]] = self.string(payload[0]) + payload[1:].decode("ascii", "replace")
+        elif kind == PRINT and payload:
+            self.print(self.format(payload))
+        elif kind == BANNER and payload:
+            self.banner(self.format(payload))
+        elif kind == LINE:
+            self.line()
+        elif kind == PREAMBLE and len(payload) >= 3:
+            self.line()
+            self.write("\n")
+            self.print("\tTest Name: %s" % self.string(payload[0]))
+            self.print("\tFile: %s" % self.string(payload[1]))
+            self.write("\n")
+            self.write("\tFUNCTIONAL DESCRIPTION:\n")
+            self.print(self.string(payload[2]))
+            self.write("\n")
+            self.write("\tCONDITIONS:\n")
+            self.section = None
+        elif kind == CONDITION and len(payload) >= 2:
+            if payload[0] != self.section:
+                if self.section is not None:
+                    self.write("\n")
+                self.section = payload[0]
+                self.write(CONDITIONS[self.section] if self.section < len(CONDITIONS) else "")
+            self.print("\t\t- %s" % self.string(payload[1]))
+        elif kind == PREAMBLE_END:
+            if self.section is not None:
+                self.write("\n")
+            self.section = None
+            self.line()
+        elif kind == POSTAMBLE and len(payload) >= 7:
+            total, passed, failed = struct.unpack_from("<HHH", payload, 1)
+            self.line()
+            self.write("\n")
+            self.print("Test Results for %s:" % self.string(payload[0]))
+            self.print("\t%d Test Points\n" % total)
+            self.print("\t%d Passed\n" % passed)
+            self.print("\t%d Failed\n" % failed)
+            self.line()
+        elif kind == VERIFY and len(payload) >= 21:
+            self.verify(payload)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("capture", nargs="?", help="binary capture file, or - for stdin")
+    parser.add_argument("--port", help="read from a serial port instead of a file")
+    parser.add_argument("--baud", type=int, default=115200)
+    args = parser.parse_args()
+
+    if args.port:
+        import serial
+        stream = serial.Serial(args.port, args.baud)
+    elif args.capture in (None, "-"):
+        stream = sys.stdin.buffer
+    else:
+        stream = open(args.capture, "rb")
+
+    report = Report(sys.stdout)
+    try:
+        for kind, payload in chunks(stream.read):
+            if kind == "text":
+                report.write(payload.decode("ascii", "replace"))
+            else:
+                report.frame(kind, payload)
+            sys.stdout.flush()
+    except KeyboardInterrupt:
+        pass
+
+
+if __name__ == "__main__":
+    main()
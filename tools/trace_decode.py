@@ -0,0 +1,162 @@
+#!/usr/bin/env python3
+"""
+Decode the binary trace sent by ThreadTraceDrain into a timeline.
+
+The stream is a sequence of frames:
+
+    0xA5, type, length, payload[length], checksum
+
+where the checksum is the 8-bit sum of type, length and payload. Frames of
+type 0x01 hold packed records of (uint8 event, uint8 object, uint32 time in
+microseconds, little endian); frames of type 0x02 hold a thread id followed
+by the thread name.
+
+Usage:
+    trace_decode.py capture.bin
+    trace_decode.py --port /dev/ttyACM0 --baud 115200
+    trace_decode.py capture.bin --csv > timeline.csv
+"""
+
+import argparse
+import struct
+import sys
+
+FRAME_SYNC = 0xA5
+FRAME_RECORDS = 0x01
+FRAME_NAME = 0x02
+RECORD_SIZE = 6
+
+# Mirrors the THREAD_TRACE_* codes in FreeRTOS_Wrapper_Hooks.h
+EVENTS = {
+    0x01: ("SWITCHED_IN", "thread"),
+    0x02: ("SWITCHED_OUT", "thread"),
+    0x03: ("CREATE", "thread"),
+    0x04: ("DELETE", "thread"),
+    0x05: ("DELAY", "thread"),
+    0x06: ("DELAY_UNTIL", "thread"),
+    0x07: ("SUSPEND", "thread"),
+    0x08: ("RESUME", "thread"),
+    0x10: ("NOTIFY", "index"),
+    0x11: ("NOTIFY_FROM_ISR", "index"),
+    0x12: ("NOTIFY_TAKE", "index"),
+    0x13: ("NOTIFY_WAIT", "index"),
+    0x20: ("QUEUE_CREATE", "queue"),
+    0x21: ("QUEUE_SEND", "queue"),
+    0x22: ("QUEUE_SEND_FAILED", "queue"),
+    0x23: ("QUEUE_RECEIVE", "queue"),
+    0x24: ("QUEUE_RECEIVE_FAILED", "queue"),
+    0x25: ("QUEUE_SEND_FROM_ISR", "queue"),
+    0x26: ("QUEUE_RECEIVE_FROM_ISR", "queue"),
+    0x27: ("QUEUE_BLOCK_SEND", "queue"),
+    0x28: ("QUEUE_BLOCK_RECEIVE", "queue"),
+    0x30: ("MARK", "value"),
+    0x3F: ("OVERFLOW", "dropped"),
+}
+
+
+def frames(read):
+    """Yield (type, payload) for every frame with a valid checksum."""
+    while True:
+        byte = read(1)
+        if not byte:
+            return
+        if byte[0] != FRAME_SYNC:
+            continue
+        header = read(2)
+        if len(header) < 2:
+            return
+        kind, length = header
+        body = read(length + 1)
+        if len(body) < length + 1:
+            return
+        payload, checksum = body[:length], body[length]
+        if (kind + length + sum(payload)) & 0xFF != checksum:
+            continue
+        yield kind, payload
+
+
+class Timeline:
+    def __init__(self, csv):
+        self.csv = csv
+        self.names = {}
+        self.start = None
+        self.last = None
+        self.wraps = 0
+        self.running = None
+        self.run_time = {}
+
+    def name(self, kind, obj):
+        if kind == "thread":
+            return self.names.get(obj, "thread %d" % obj)
+        if kind == "queue":
+            return "queue %d" % obj
+        return "%s %d" % (kind, obj)
+
+    def unwrap(self, time):
+        # The target clock is 32 bits of microseconds, so it wraps after ~71 minutes
+        if self.last is not None and time + self.wraps < self.last - (1 << 31):
+            self.wraps += 1 << 32
+        self.last = time + self.wraps
+        if self.start is None:
+            self.start = self.last
+        return self.last - self.start
+
+    def record(self, event, obj, time):
+        time = self.unwrap(time)
+        label, kind = EVENTS.get(event, ("EVENT_0x%02X" % event, "object"))
+
+        if label == "SWITCHED_IN":
+            self.running = (obj, time)
+        elif label == "SWITCHED_OUT" and self.running and self.running[0] == obj:
+            self.run_time[obj] = self.run_time.get(obj, 0) + time - self.running[1]
+            self.running = None
+
+        if self.csv:
+            print("%d,%s,%d,%s" % (time, label, obj, self.name(kind, obj)))
+        else:
+            print("%12.3f ms  %-24s %s" % (time / 1000.0, label, self.name(kind, obj)))
+
+    def summary(self):
+        if self.csv or self.last is None:
+            return
+        total = self.last - self.start
+        print()
+        print("Run time over %.3f ms" % (total / 1000.0))
+        for obj, run in sorted(self.run_time.items(), key=lambda item: -item[1]):
+            share = 100.0 * run / total if total else 0.0
+            print("  %-16s %12.3f ms  %5.1f %%" % (self.name("thread", obj), run / 1000.0, share))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("capture", nargs="?", help="binary capture file, or - for stdin")
+    parser.add_argument("--port", help="read from a serial port instead of a file")
+    parser.add_argument("--baud", type=int, default=115200)
+    parser.add_argument("--csv", action="store_true", help="print time_us,event,object,name rows")
+    args = parser.parse_args()
+
+    if args.port:
+        import serial
+        stream = serial.Serial(args.port, args.baud)
+    elif args.capture in (None, "-"):
+        stream = sys.stdin.buffer
+    else:
+        stream = open(args.capture, "rb")
+
+    timeline = Timeline(args.csv)
+    if args.csv:
+        print("time_us,event,object,name")
+    try:
+        for kind, payload in frames(stream.read):
+            if kind == FRAME_NAME and payload:
+                timeline.names[payload[0]] = payload[1:].decode("ascii", "replace")
+            elif kind == FRAME_RECORDS:
+                for offset in range(0, len(payload) - RECORD_SIZE + 1, RECORD_SIZE):
+                    timeline.record(*struct.unpack_from("<BBI", payload, offset))
+    except KeyboardInterrupt:
+        pass
+    timeline.summary()
+
+
+if __name__ == "__main__":
+    main()